@@ -0,0 +1,91 @@
+# Size report: code and unwind-table bytes of the ara libraries and tools with and without exceptions.
+#
+# Run through the size_report target, or directly:
+#   cmake -DSOURCE_DIR=<source dir> -DBINARY_DIR=<scratch dir> [-DBUILD_TYPE=MinSizeRel]
+#         [-DCXX_COMPILER=g++] [-DSIZE=size] -P cmake/size_report.cmake
+#
+# Configures and builds the tree twice below BINARY_DIR, with ARA_CORE_EXCEPTIONS ON and OFF, and sums the
+# sections reported by `size -A`: code is .text*, unwind is .eh_frame, .eh_frame_hdr and .gcc_except_table*.
+
+if(NOT SOURCE_DIR OR NOT BINARY_DIR)
+    message(FATAL_ERROR "SOURCE_DIR and BINARY_DIR must be set")
+endif()
+if(NOT BUILD_TYPE)
+    set(BUILD_TYPE MinSizeRel)
+endif()
+if(NOT SIZE)
+    set(SIZE size)
+endif()
+set(compiler_args)
+if(CXX_COMPILER)
+    set(compiler_args -DCMAKE_CXX_COMPILER=${CXX_COMPILER})
+endif()
+
+set(files libara_core.a libara_exec.a libara_log.a log_decoder)
+
+# section_sizes(<file> <code var> <unwind var>)
+function(section_sizes file code_var unwind_var)
+    execute_process(COMMAND ${SIZE} -A ${file} OUTPUT_VARIABLE output RESULT_VARIABLE result)
+    if(result)
+        message(FATAL_ERROR "${SIZE} -A ${file} failed")
+    endif()
+    set(code 0)
+    set(unwind 0)
+    string(REGEX MATCHALL "\n\\.[^ \n]+ +[0-9]+" sections "${output}")
+    foreach(section IN LISTS sections)
+        string(REGEX MATCH "^\n(\\.[^ ]+) +([0-9]+)" _ "${section}")
+        set(name ${CMAKE_MATCH_1})
+        set(bytes ${CMAKE_MATCH_2})
+        if(name MATCHES "^\\.text")
+            math(EXPR code "${code} + ${bytes}")
+        elseif(name MATCHES "^\\.(eh_frame|eh_frame_hdr|gcc_except_table)")
+            math(EXPR unwind "${unwind} + ${bytes}")
+        endif()
+    endforeach()
+    set(${code_var} ${code} PARENT_SCOPE)
+    set(${unwind_var} ${unwind} PARENT_SCOPE)
+endfunction()
+
+# pad(<var> <width> <text>), right-aligned
+function(pad var width text)
+    string(LENGTH "${text}" length)
+    while(length LESS width)
+        string(PREPEND text " ")
+        math(EXPR length "${length} + 1")
+    endwhile()
+    set(${var} "${text}" PARENT_SCOPE)
+endfunction()
+
+foreach(mode ON OFF)
+    set(dir ${BINARY_DIR}/exceptions-${mode})
+    execute_process(
+        COMMAND ${CMAKE_COMMAND} -S ${SOURCE_DIR} -B ${dir} -DCMAKE_BUILD_TYPE=${BUILD_TYPE}
+                -DARA_BUILD_TESTS=OFF -DARA_CORE_EXCEPTIONS=${mode} ${compiler_args}
+        OUTPUT_QUIET RESULT_VARIABLE result)
+    if(NOT result)
+        execute_process(COMMAND ${CMAKE_COMMAND} --build ${dir} OUTPUT_QUIET RESULT_VARIABLE result)
+    endif()
+    if(result)
+        message(FATAL_ERROR "building ${dir} failed")
+    endif()
+endforeach()
+
+message("${BUILD_TYPE} build, bytes")
+message("file                 code(exc)  unwind(exc)  code(no-exc)  unwind(no-exc)    saved")
+foreach(file IN LISTS files)
+    section_sizes(${BINARY_DIR}/exceptions-ON/${file} code_on unwind_on)
+    section_sizes(${BINARY_DIR}/exceptions-OFF/${file} code_off unwind_off)
+    math(EXPR saved "${code_on} + ${unwind_on} - ${code_off} - ${unwind_off}")
+    pad(c1 10 ${code_on})
+    pad(u1 12 ${unwind_on})
+    pad(c2 13 ${code_off})
+    pad(u2 15 ${unwind_off})
+    pad(s 8 ${saved})
+    string(LENGTH "${file}" length)
+    set(name "${file}")
+    while(length LESS 20)
+        string(APPEND name " ")
+        math(EXPR length "${length} + 1")
+    endwhile()
+    message("${name} ${c1} ${u1} ${c2} ${u2} ${s}")
+endforeach()
@@ -11,6 +11,7 @@
 #ifndef ARA_COM_COM_ERROR_DOMAIN_H_
 #define ARA_COM_COM_ERROR_DOMAIN_H_
 
+#include <cstdint>
 #include "ara/core/error_domain.h"
 
 namespace ara
@@ -30,6 +31,34 @@ namespace ara
             kNetworkBindingFailure = 3, /*< Local failure has been detected by the network
                                             binding. */
         };
+
+        namespace internal
+        {
+            /**
+             * \brief Holder of the static name and messages of the ComErrorDomain (ID 0x8000000000001267), a
+             * template so that the header can define them.
+             *
+             */
+            template <typename = void>
+            struct ComErrorMessages
+            {
+                static constexpr ara::core::internal::ErrorMessage kMessages[] = {
+                    {static_cast<std::int32_t>(ComErrc::kServiceNotAvailable), "service not available"},
+                    {static_cast<std::int32_t>(ComErrc::kMaxSamplesExceeded), "max samples exceeded"},
+                    {static_cast<std::int32_t>(ComErrc::kNetworkBindingFailure), "network binding failure"},
+                };
+
+                static constexpr ara::core::internal::ErrorMessageTable kTable{
+                    0x8000000000001267ULL, "Com", kMessages, sizeof(kMessages) / sizeof(kMessages[0]),
+                    "unknown com error"};
+            };
+
+            template <typename Dummy>
+            constexpr ara::core::internal::ErrorMessage ComErrorMessages<Dummy>::kMessages[];
+
+            template <typename Dummy>
+            constexpr ara::core::internal::ErrorMessageTable ComErrorMessages<Dummy>::kTable;
+        } // namespace internal
     } // namespace com
     
 } // namespace ara// 
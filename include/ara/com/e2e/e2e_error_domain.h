@@ -11,6 +11,7 @@
 #ifndef ARA_COM_E2E_E2E_ERROR_DOMAIN_H_
 #define ARA_COM_E2E_E2E_ERROR_DOMAIN_H_
 
+#include <cstdint>
 #include "ara/core/error_domain.h"
 
 namespace ara
@@ -39,6 +40,36 @@ namespace ara
                                                 for the buffer, it is not returned by any E2E profile. */
                 no_new_data = 5,            /*< No new data is available. */
             };
+
+            namespace internal
+            {
+                /**
+                 * \brief Holder of the static name and messages of the E2EErrorDomain (ID 0x8000000000001268), a
+                 * template so that the header can define them.
+                 *
+                 */
+                template <typename = void>
+                struct E2EErrorMessages
+                {
+                    static constexpr ara::core::internal::ErrorMessage kMessages[] = {
+                        {static_cast<std::int32_t>(E2EError::repreated), "repeated counter"},
+                        {static_cast<std::int32_t>(E2EError::wrong_sequence_error), "wrong sequence"},
+                        {static_cast<std::int32_t>(E2EError::error), "check failed"},
+                        {static_cast<std::int32_t>(E2EError::not_available), "no data received yet"},
+                        {static_cast<std::int32_t>(E2EError::no_new_data), "no new data"},
+                    };
+
+                    static constexpr ara::core::internal::ErrorMessageTable kTable{
+                        0x8000000000001268ULL, "E2E", kMessages, sizeof(kMessages) / sizeof(kMessages[0]),
+                        "unknown e2e error"};
+                };
+
+                template <typename Dummy>
+                constexpr ara::core::internal::ErrorMessage E2EErrorMessages<Dummy>::kMessages[];
+
+                template <typename Dummy>
+                constexpr ara::core::internal::ErrorMessageTable E2EErrorMessages<Dummy>::kTable;
+            } // namespace internal
         } // namespace e2e
         
     } // namespace com
@@ -11,6 +11,9 @@
 #ifndef ARA_COM_RAW_RAW_ERROR_DOMAIN_H_
 #define ARA_COM_RAW_RAW_ERROR_DOMAIN_H_
 
+#include <cstdint>
+#include "ara/core/error_domain.h"
+
 namespace ara
 {
     namespace com
@@ -33,6 +36,36 @@ namespace ara
                                                 machine. */
                 kStreamAlreadyConnected = 5,/*< The specified connection is already connected. */
             };
+
+            namespace internal
+            {
+                /**
+                 * \brief Holder of the static name and messages of the RawErrorDomain (ID 0x8000000000001269), a
+                 * template so that the header can define them.
+                 *
+                 */
+                template <typename = void>
+                struct RawErrorMessages
+                {
+                    static constexpr ara::core::internal::ErrorMessage kMessages[] = {
+                        {static_cast<std::int32_t>(RawErrc::kStreamNotConnected), "stream not connected"},
+                        {static_cast<std::int32_t>(RawErrc::kCommunicationTimeout), "communication timeout"},
+                        {static_cast<std::int32_t>(RawErrc::kConnectionRefused), "connection refused"},
+                        {static_cast<std::int32_t>(RawErrc::kAddressNotAvailable), "address not available"},
+                        {static_cast<std::int32_t>(RawErrc::kStreamAlreadyConnected), "stream already connected"},
+                    };
+
+                    static constexpr ara::core::internal::ErrorMessageTable kTable{
+                        0x8000000000001269ULL, "Raw", kMessages, sizeof(kMessages) / sizeof(kMessages[0]),
+                        "unknown raw error"};
+                };
+
+                template <typename Dummy>
+                constexpr ara::core::internal::ErrorMessage RawErrorMessages<Dummy>::kMessages[];
+
+                template <typename Dummy>
+                constexpr ara::core::internal::ErrorMessageTable RawErrorMessages<Dummy>::kTable;
+            } // namespace internal
         } // namespace raw
         
     } // namespace com
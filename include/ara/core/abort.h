@@ -12,6 +12,34 @@
 
 #pragma once
 
+#include <type_traits>
+
+/**
+ * \brief Whether errors are reported by throwing exceptions (1) or by calling Abort() (0).
+ *
+ * Set by the ARA_CORE_EXCEPTIONS CMake option, which also builds with -fno-exceptions when off. Defaults to
+ * whether the compiler has exceptions enabled.
+ */
+#ifndef ARA_CORE_EXCEPTIONS
+#if defined(__cpp_exceptions) || defined(__EXCEPTIONS)
+#define ARA_CORE_EXCEPTIONS 1
+#else
+#define ARA_CORE_EXCEPTIONS 0
+#endif
+#endif
+
+/**
+ * \brief try and catch that compile without exceptions: the try block always runs and the handlers never do.
+ *
+ */
+#if ARA_CORE_EXCEPTIONS
+#define ARA_CORE_TRY try
+#define ARA_CORE_CATCH(...) catch (__VA_ARGS__)
+#else
+#define ARA_CORE_TRY if (true)
+#define ARA_CORE_CATCH(...) if (false)
+#endif
+
 namespace ara
 {
 namespace core
@@ -20,6 +48,10 @@ namespace core
     /**
      * \brief The type of a handler for SetAbortHandler().
      * 
+     * From C++17 on, noexcept is part of the function type and thus of the mangled name of
+     * SetAbortHandler(). ara_core and all code calling SetAbortHandler() must therefore be built with the
+     * same choice of C++14 or C++17 and later, otherwise the call does not link.
+     * 
      */
     using AbortHandler = void (*)() noexcept;
 
@@ -64,7 +96,38 @@ namespace core
      * 
      * \param[in] text  a custom text to include in the log message being output
      */
-    void Abort(char const *text) noexcept;
+    [[noreturn]] void Abort(char const *text) noexcept;
+
+    namespace internal
+    {
+        template <typename E>
+        E MakeException(char const *what, std::true_type)
+        {
+            return E(what);
+        }
+
+        template <typename E>
+        E MakeException(char const *, std::false_type)
+        {
+            return E();
+        }
+
+        /**
+         * \brief Throw an exception of type E, or call Abort() in builds without exceptions.
+         *
+         * \tparam E           the exception type, constructed from what if it can be
+         * \param[in] what     a description of the error, a null-terminated string with static storage duration
+         */
+        template <typename E>
+        [[noreturn]] void ThrowOrAbort(char const *what)
+        {
+#if ARA_CORE_EXCEPTIONS
+            throw MakeException<E>(what, std::is_constructible<E, char const *>());
+#else
+            Abort(what);
+#endif
+        }
+    } // namespace internal
 
 } // namespace core
 } // namespace ara
@@ -12,6 +12,8 @@
 
 #pragma once
 
+#include <cstddef>
+
 namespace ara
 {
 namespace core
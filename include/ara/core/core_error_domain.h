@@ -14,6 +14,7 @@
 
 #include "error_domain.h"
 #include "error_code.h"
+#include "exception.h"
 
 namespace ara
 {
@@ -38,15 +39,48 @@ namespace ara
          */
         class CoreException : public Exception
         {
+        public:
             // SWS_CORE_05212
             /**
              * \brief Construct a new CoreException from an ErrorCode.
              * 
              * \param[in] err   the ErrorCode
              */
-            explicit CoreException(ErrorCode err) noexcept;
+            explicit CoreException(ErrorCode err) noexcept : Exception(err)
+            {
+            }
         };
 
+        namespace internal
+        {
+            /**
+             * \brief Holder of the static name and messages of CoreErrorDomain, a template so that the header can
+             * define them.
+             *
+             */
+            template <typename = void>
+            struct CoreErrorMessages
+            {
+                using Errc = CoreErrc;
+
+                static constexpr ErrorMessage kMessages[] = {
+                    {static_cast<std::int32_t>(Errc::kInvalidArgument), "invalid argument"},
+                    {static_cast<std::int32_t>(Errc::kInvalidMetaModelShortname), "invalid meta model shortname"},
+                    {static_cast<std::int32_t>(Errc::kInvalidMetaModelPath), "invalid meta model path"},
+                };
+
+                static constexpr ErrorMessageTable kTable{0x8000000000000014ULL, "Core", kMessages,
+                                                          sizeof(kMessages) / sizeof(kMessages[0]),
+                                                          "unknown core error"};
+            };
+
+            template <typename Dummy>
+            constexpr ErrorMessage CoreErrorMessages<Dummy>::kMessages[];
+
+            template <typename Dummy>
+            constexpr ErrorMessageTable CoreErrorMessages<Dummy>::kTable;
+        } // namespace internal
+
         // SWS_CORE_05221
         /**
          * \brief An error domain for errors originating from the CORE Functional Cluster 
@@ -55,6 +89,7 @@ namespace ara
          */
         class CoreErrorDomain final : public ErrorDomain
         {
+        public:
             // SWS_CORE_05231
             /**
              * \brief Alias for the error code value enumeration.
@@ -74,7 +109,9 @@ namespace ara
              * \brief Default constructor.
              * 
              */
-            constexpr CoreErrorDomain() noexcept;
+            constexpr CoreErrorDomain() noexcept : ErrorDomain(internal::CoreErrorMessages<>::kTable)
+            {
+            }
 
             // SWS_CORE_05242
             /**
@@ -82,7 +119,10 @@ namespace ara
              * 
              * \return char const*  Core
              */
-            char const* Name() const noexcept override;
+            char const* Name() const noexcept override
+            {
+                return internal::CoreErrorMessages<>::kTable.name;
+            }
 
             // SWS_CORE_05243
             /**
@@ -91,7 +131,10 @@ namespace ara
              * \param[in] errorCode     the error code value
              * \return char const*      the text message, never nullptr
              */
-            char const* Message(ErrorDomain::CodeType errorCode) const noexcept override;
+            char const* Message(ErrorDomain::CodeType errorCode) const noexcept override
+            {
+                return internal::CoreErrorMessages<>::kTable.Message(errorCode);
+            }
 
             // SWS_CORE_05244
             /**
@@ -99,16 +142,38 @@ namespace ara
              * 
              * \param[in] errorCode     the ErrorCode instance
              */
-            void ThrowAsException(ErrorCode const &errorCode) const override;
+            void ThrowAsException(ErrorCode const &errorCode) const noexcept(false) override
+            {
+                internal::ThrowOrAbort<CoreException>(errorCode);
+            }
         };
 
+        namespace internal
+        {
+            /**
+             * \brief Holder of the global CoreErrorDomain, a template so that the header can define it.
+             *
+             */
+            template <typename = void>
+            struct CoreErrorDomainInstance
+            {
+                static constexpr CoreErrorDomain kDomain{};
+            };
+
+            template <typename Dummy>
+            constexpr CoreErrorDomain CoreErrorDomainInstance<Dummy>::kDomain;
+        } // namespace internal
+
         // SWS_CORE_05280
         /**
          * \brief Return a reference to the global CoreErrorDomain.
          * 
          * \return constexpr ErrorDomain const&     the CoreErrorDomain
          */
-        constexpr ErrorDomain const& GetCoreErrorDomain() noexcept;
+        constexpr ErrorDomain const& GetCoreErrorDomain() noexcept
+        {
+            return internal::CoreErrorDomainInstance<>::kDomain;
+        }
 
         // SWS_CORE_05290
         /**
@@ -121,7 +186,10 @@ namespace ara
          * 
          * \return constexpr ErrorCode 
          */
-        constexpr ErrorCode MakeErrorCode(CoreErrc code, ErrorDomain::SupportDataType data) noexcept;
+        constexpr ErrorCode MakeErrorCode(CoreErrc code, ErrorDomain::SupportDataType data) noexcept
+        {
+            return ErrorCode(static_cast<ErrorDomain::CodeType>(code), GetCoreErrorDomain(), data);
+        }
 
     } // namespace core
 } // namespace ara
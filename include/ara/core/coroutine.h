@@ -0,0 +1,185 @@
+/**
+ * \file coroutine.h
+ * \author Vincent WANG (vin@misday.com)
+ * \brief C++20 coroutine support for Future: co_await on a Future, and Future as a coroutine return type.
+ * \version 0.1
+ * \date 2021-11-12
+ *
+ * \copyright Copyright (c) 2021
+ *
+ */
+
+#pragma once
+
+#if defined(__cpp_impl_coroutine) && defined(__has_include)
+#if __has_include(<coroutine>)
+#define ARA_CORE_HAS_COROUTINES 1
+#endif
+#endif
+
+#if defined(ARA_CORE_HAS_COROUTINES)
+
+#include <coroutine>
+#include <type_traits>
+#include <utility>
+#include "exception.h"
+#include "executor.h"
+#include "future.h"
+#include "result.h"
+
+namespace ara
+{
+namespace core
+{
+    namespace internal
+    {
+        /**
+         * \brief Awaiter of a Future, resuming with its Result.
+         *
+         * The coroutine is resumed in the context of Promise::set_value() or Promise::SetError(), without a
+         * thread blocking in between and without allocation.
+         *
+         * \tparam T    the type of value
+         * \tparam E    the type of error
+         */
+        template <typename T, typename E>
+        class FutureAwaiter final
+        {
+        public:
+            explicit FutureAwaiter(Future<T, E> &&future) noexcept : future_(std::move(future))
+            {
+            }
+
+            bool await_ready() const noexcept
+            {
+                return !future_.valid() || future_.is_ready();
+            }
+
+            bool await_suspend(std::coroutine_handle<> handle)
+            {
+                return FutureBase<T, E>::Subscribe(future_, Task([handle]() { handle.resume(); }));
+            }
+
+            Result<T, E> await_resume() noexcept
+            {
+                return future_.GetResult();
+            }
+
+        private:
+            Future<T, E> future_;
+        };
+
+        /**
+         * \brief The parts of the promise type of a coroutine returning Future<T, E> that do not depend on
+         * whether T is void.
+         *
+         * The coroutine runs eagerly up to its first suspension. An ara::core::Exception escaping it is
+         * stored as error if E can be constructed from its ErrorCode; any other exception breaks the Promise
+         * (future_errc::broken_promise), as in Future::then(). Nothing propagates to whoever resumed the
+         * coroutine, so the frame always runs to its end and is freed. Builds without exceptions never get
+         * there.
+         *
+         */
+        template <typename T, typename E>
+        class CoroutinePromiseBase
+        {
+        public:
+            Future<T, E> get_return_object()
+            {
+                return promise_.get_future();
+            }
+
+            std::suspend_never initial_suspend() const noexcept
+            {
+                return {};
+            }
+
+            std::suspend_never final_suspend() const noexcept
+            {
+                return {};
+            }
+
+            void unhandled_exception()
+            {
+#if ARA_CORE_EXCEPTIONS
+                Fail(std::is_constructible<E, ErrorCode const &>());
+#else
+                Abort("unhandled exception in coroutine");
+#endif
+            }
+
+        protected:
+            Promise<T, E> promise_;
+
+        private:
+#if ARA_CORE_EXCEPTIONS
+            void Fail(std::true_type)
+            {
+                try
+                {
+                    throw;
+                }
+                catch (Exception const &e)
+                {
+                    promise_.SetError(E(e.Error()));
+                }
+                catch (...)
+                {
+                    promise_.SetError(E(future_errc::broken_promise));
+                }
+            }
+
+            void Fail(std::false_type)
+            {
+                promise_.SetError(E(future_errc::broken_promise));
+            }
+#endif
+        };
+
+        /**
+         * \brief Promise type of a coroutine returning Future<T, E>. co_return takes a T or a Result<T, E>.
+         *
+         */
+        template <typename T, typename E>
+        class CoroutinePromise final : public CoroutinePromiseBase<T, E>
+        {
+        public:
+            template <typename U>
+            void return_value(U &&value)
+            {
+                Settle(this->promise_, std::forward<U>(value));
+            }
+        };
+
+        template <typename E>
+        class CoroutinePromise<void, E> final : public CoroutinePromiseBase<void, E>
+        {
+        public:
+            void return_void()
+            {
+                this->promise_.set_value();
+            }
+        };
+    } // namespace internal
+
+    /**
+     * \brief Make a Future awaitable: co_await resumes with the Result<T, E> of the Future.
+     *
+     * \param[in] future    the Future, consumed
+     * \return              the awaiter
+     */
+    template <typename T, typename E>
+    internal::FutureAwaiter<T, E> operator co_await(Future<T, E> &&future) noexcept
+    {
+        return internal::FutureAwaiter<T, E>(std::move(future));
+    }
+} // namespace core
+} // namespace ara
+
+template <typename T, typename E, typename... Args>
+struct std::coroutine_traits<ara::core::Future<T, E>, Args...>
+{
+    using promise_type = ara::core::internal::CoroutinePromise<T, E>;
+};
+
+#endif
@@ -12,7 +12,10 @@
 
 #pragma once
 
+#include <type_traits>
+#include "abort.h"
 #include "error_domain.h"
+#include "string_view.h"
 
 namespace ara
 {
@@ -28,6 +31,7 @@ namespace ara
          */
         class ErrorCode final
         {
+        public:
             // SWS_CORE_00512
             /**
              * \brief Construct a new ErrorCode instance with parameters.
@@ -39,8 +43,11 @@ namespace ara
              * \param e     a domain-specific error code value
              * \param data  optional vendor-specific supplementary error context data
              */
-            template <typename EnumT>
-            constexpr ErrorCode(EnumT e, ErrorDomain::SupportDataType data=ErrorDomain::SupportDataType()) noexcept;
+            template <typename EnumT, typename = typename std::enable_if<std::is_enum<EnumT>::value>::type>
+            constexpr ErrorCode(EnumT e, ErrorDomain::SupportDataType data=ErrorDomain::SupportDataType()) noexcept
+                : ErrorCode(MakeErrorCode(e, data))
+            {
+            }
 
             // SWS_CORE_00513
             /**
@@ -50,7 +57,10 @@ namespace ara
              * \param domain    the ErrorDomain associated with value
              * \param data      optional vendor-specific supplementary error context data
              */
-            constexpr ErrorCode(ErrorDomain::CodeType value, ErrorDomain const &domain, ErrorDomain::SupportDataType data=ErrorDomain::SupportDataType()) noexcept;
+            constexpr ErrorCode(ErrorDomain::CodeType value, ErrorDomain const &domain, ErrorDomain::SupportDataType data=ErrorDomain::SupportDataType()) noexcept
+                : value_(value), supportData_(data), domain_(&domain)
+            {
+            }
 
             // SWS_CORE_00514
             /**
@@ -58,7 +68,10 @@ namespace ara
              * 
              * \return constexpr ErrorDomain::CodeType  the raw error code value
              */
-            constexpr ErrorDomain::CodeType Value() const noexcept;
+            constexpr ErrorDomain::CodeType Value() const noexcept
+            {
+                return value_;
+            }
 
             // SWS_CORE_00515
             /**
@@ -66,7 +79,10 @@ namespace ara
              * 
              * \return constexpr ErrorDomain const&     the ErrorDomain
              */
-            constexpr ErrorDomain const& Domain() const noexcept;
+            constexpr ErrorDomain const& Domain() const noexcept
+            {
+                return *domain_;
+            }
 
             // SWS_CORE_00516
             /**
@@ -76,7 +92,10 @@ namespace ara
              * 
              * \return constexpr ErrorDomain::SupportDataType   the supplementary error context data
              */
-            constexpr ErrorDomain::SupportDataType SupportData() const noexcept;
+            constexpr ErrorDomain::SupportDataType SupportData() const noexcept
+            {
+                return supportData_;
+            }
 
             // SWS_CORE_00518
             /**
@@ -84,17 +103,34 @@ namespace ara
              * 
              * \return StringView   the error message text
              */
-            StringView Message() const noexcept;
+            StringView Message() const noexcept
+            {
+                internal::ErrorMessageTable const *const messages = domain_->MessageTable();
+                return StringView((messages != nullptr) ? messages->Message(value_) : domain_->Message(value_));
+            }
 
             // SWS_CORE_00519
             /**
              * \brief Throw this error as exception.
              * 
              * This function will determine the appropriate exception type for this ErrorCode and throw it. The
-             * thrown exception will contain this ErrorCode.
+             * thrown exception will contain this ErrorCode. Builds without exceptions (ARA_CORE_EXCEPTIONS == 0)
+             * call Abort() with Message() instead.
              * 
              */
-            void ThrowAsException() const;
+            void ThrowAsException() const
+            {
+#if ARA_CORE_EXCEPTIONS
+                domain_->ThrowAsException(*this);
+#else
+                Abort(Message().data());
+#endif
+            }
+
+        private:
+            ErrorDomain::CodeType value_;
+            ErrorDomain::SupportDataType supportData_;
+            ErrorDomain const *domain_;
         };
 
         // SWS_CORE_00571
@@ -110,7 +146,10 @@ namespace ara
          * \return true     if the two instances compare equal
          * \return false    otherwise
          */
-        constexpr bool operator==(ErrorCode const &lhs, ErrorCode const &rhs) noexcept;
+        constexpr bool operator==(ErrorCode const &lhs, ErrorCode const &rhs) noexcept
+        {
+            return (lhs.Value() == rhs.Value()) && (lhs.Domain() == rhs.Domain());
+        }
 
         // SWS_CORE_00572
         /**
@@ -125,7 +164,10 @@ namespace ara
          * \return true     if the two instances compare not equal
          * \return false    otherwise
          */
-        constexpr bool operator!=(ErrorCode const &lhs, ErrorCode const &rhs) noexcept;
+        constexpr bool operator!=(ErrorCode const &lhs, ErrorCode const &rhs) noexcept
+        {
+            return !(lhs == rhs);
+        }
     } // namespace core
     
 } // namespace ara
@@ -12,6 +12,7 @@
 
 #pragma once
 
+#include <cstddef>
 #include <cstdint>
 
 namespace ara
@@ -20,6 +21,77 @@ namespace ara
     {
         #define IMPLEMENTATION_DEFINED std::int32_t
 
+        class ErrorCode;
+
+        namespace internal
+        {
+            /**
+             * \brief The message of one error code value.
+             *
+             */
+            struct ErrorMessage
+            {
+                std::int32_t code;      /*< the error code value */
+                char const *text;       /*< the message */
+            };
+
+            /**
+             * \brief The name and messages of an error domain as static data, so that they can be looked up
+             * by domain ID or without a virtual call.
+             *
+             * Domains have a handful of codes, so the messages are scanned linearly; codes not listed have the
+             * message unknown.
+             *
+             */
+            struct ErrorMessageTable
+            {
+                std::uint64_t id;               /*< ErrorDomain::Id() */
+                char const *name;               /*< ErrorDomain::Name() */
+                ErrorMessage const *messages;   /*< the messages of the known codes */
+                std::size_t count;              /*< the number of messages */
+                char const *unknown;            /*< the message of any other code */
+
+                /**
+                 * \brief Return the message of a code.
+                 *
+                 * \param[in] code         the error code value
+                 * \return char const*     the message, never nullptr
+                 */
+                constexpr char const* Message(std::int32_t code) const noexcept
+                {
+                    for (std::size_t i = 0U; i < count; ++i)
+                    {
+                        if (messages[i].code == code)
+                        {
+                            return messages[i].text;
+                        }
+                    }
+                    return unknown;
+                }
+            };
+
+            /**
+             * \brief Find the message table of a domain ID in a registry of tables.
+             *
+             * \param[in] tables       the registry
+             * \param[in] count        the number of tables in the registry
+             * \param[in] id           the domain ID
+             * \return ErrorMessageTable const*     the table, or nullptr if id is not registered
+             */
+            constexpr ErrorMessageTable const* FindErrorMessageTable(ErrorMessageTable const *const *tables,
+                                                                     std::size_t count, std::uint64_t id) noexcept
+            {
+                for (std::size_t i = 0U; i < count; ++i)
+                {
+                    if (tables[i]->id == id)
+                    {
+                        return tables[i];
+                    }
+                }
+                return nullptr;
+            }
+        } // namespace internal
+
         // SWS_CORE_00110
         /**
          * \brief Encapsulation of an error domain.
@@ -31,6 +103,7 @@ namespace ara
          */
         class ErrorDomain
         {
+        public:
             // SWS_CORE_00121
             /**
              * \brief Alias type for a unique ErrorDomain identifier type .
@@ -66,25 +139,6 @@ namespace ara
              */
             ErrorDomain(ErrorDomain const &&)=delete;
 
-            // SWS_CORE_00135
-            /**
-             * \brief Construct a new instance with the given identifier.
-             * 
-             * Identifiers are expected to be system-wide unique.
-             * 
-             */
-            explicit constexpr ErrorDomain(IdType id) noexcept;
-
-            // SWS_CORE_00136
-            /**
-             * \brief Destructor.
-             * 
-             * This dtor is non-virtual (and trivial) so that this class can be a literal type. While this class has
-             * virtual functions, no polymorphic destruction is needed.
-             * 
-             */
-            ~ErrorDomain()=default;
-
             // SWS_CORE_00133
             /**
              * \brief Copy assignment shall be disabled.
@@ -110,7 +164,10 @@ namespace ara
              * \return true         if other is equal to *this
              * \return false        otherwise
              */
-            constexpr bool operator==(ErrorDomain const &other) const noexcept;
+            constexpr bool operator==(ErrorDomain const &other) const noexcept
+            {
+                return id_ == other.id_;
+            }
 
             // SWS_CORE_00138
             /**
@@ -121,7 +178,10 @@ namespace ara
              * \return true         if other is not equal to *this
              * \return false        otherwise
              */
-            constexpr bool operator!=(ErrorDomain const &other) const noexcept;
+            constexpr bool operator!=(ErrorDomain const &other) const noexcept
+            {
+                return id_ != other.id_;
+            }
 
             // SWS_CORE_00151
             /**
@@ -129,7 +189,24 @@ namespace ara
              * 
              * \return constexpr IdType     the identifier
              */
-            constexpr IdType Id() const noexcept;
+            constexpr IdType Id() const noexcept
+            {
+                return id_;
+            }
+
+            /**
+             * \brief Return the static name and messages of this domain, if it was constructed from them.
+             *
+             * Name() and Message() of such a domain give the same results as the table, which callers on hot
+             * paths such as ErrorCode::Message() and the log formatter read instead.
+             *
+             * \return internal::ErrorMessageTable const*  the table, or nullptr if only the virtual functions
+             *                                              know the name and messages
+             */
+            constexpr internal::ErrorMessageTable const* MessageTable() const noexcept
+            {
+                return messages_;
+            }
 
             // SWS_CORE_00152
             /**
@@ -167,6 +244,42 @@ namespace ara
              * \param[in] errorCode     the ErrorCode
              */
             virtual void ThrowAsException(ErrorCode const &errorCode) const noexcept(false) = 0;
+
+        protected:
+            // SWS_CORE_00135
+            /**
+             * \brief Construct a new instance with the given identifier.
+             * 
+             * Identifiers are expected to be system-wide unique.
+             * 
+             */
+            explicit constexpr ErrorDomain(IdType id) noexcept : id_(id), messages_(nullptr)
+            {
+            }
+
+            /**
+             * \brief Construct a new instance with the identifier, name and messages of a static table.
+             *
+             * \param[in] messages     the table, which shall outlive this instance
+             */
+            explicit constexpr ErrorDomain(internal::ErrorMessageTable const &messages) noexcept
+                : id_(messages.id), messages_(&messages)
+            {
+            }
+
+            // SWS_CORE_00136
+            /**
+             * \brief Destructor.
+             * 
+             * This dtor is non-virtual (and trivial) so that this class can be a literal type. While this class has
+             * virtual functions, no polymorphic destruction is needed.
+             * 
+             */
+            ~ErrorDomain()=default;
+
+        private:
+            IdType const id_;
+            internal::ErrorMessageTable const *const messages_;
         };
     } // namespace core
     
@@ -12,6 +12,7 @@
 
 #pragma once
 
+#include <exception>
 #include "error_code.h"
 
 namespace ara
@@ -23,7 +24,7 @@ namespace ara
          * \brief Base type for all AUTOSAR exception types.
          * 
          */
-        class Exception : public exception
+        class Exception : public std::exception
         {
         public:
 
@@ -33,7 +34,9 @@ namespace ara
              * 
              * \param[in] err   the ErrorCode
              */
-            explicit Exception(ErrorCode err) noexcept;
+            explicit Exception(ErrorCode err) noexcept : error_(err)
+            {
+            }
 
             // SWS_CORE_00612
             /**
@@ -44,7 +47,10 @@ namespace ara
              * 
              * \return char const*  a null-terminated string
              */
-            char const* what() const noexcept override;
+            char const* what() const noexcept override
+            {
+                return error_.Domain().Message(error_.Value());
+            }
 
             // SWS_CORE_00613
             /**
@@ -52,8 +58,34 @@ namespace ara
              * 
              * \return ErrorCode const&     reference to the embedded ErrorCode
              */
-            ErrorCode const& Error() const noexcept;
+            ErrorCode const& Error() const noexcept
+            {
+                return error_;
+            }
+
+        private:
+            ErrorCode const error_;
         };
+
+        namespace internal
+        {
+            /**
+             * \brief Throw an exception of type E holding errorCode, or call Abort() with its message in builds
+             * without exceptions.
+             *
+             * \tparam E               the exception type
+             * \param[in] errorCode    the error
+             */
+            template <typename E>
+            [[noreturn]] void ThrowOrAbort(ErrorCode const &errorCode)
+            {
+#if ARA_CORE_EXCEPTIONS
+                throw E(errorCode);
+#else
+                Abort(errorCode.Message().data());
+#endif
+            }
+        } // namespace internal
     } // namespace core
     
 } // namespace ara
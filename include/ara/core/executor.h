@@ -0,0 +1,215 @@
+/**
+ * \file executor.h
+ * \author Vincent WANG (vin@misday.com)
+ * \brief Executors for Future continuations.
+ * \version 0.1
+ * \date 2021-11-12
+ *
+ * \copyright Copyright (c) 2021
+ *
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace ara
+{
+namespace core
+{
+    namespace internal
+    {
+        /**
+         * \brief A move-only callable without arguments and result, e.g. a Future continuation.
+         *
+         * Callables of up to kInlineSize bytes that can be moved without throwing are stored in place, so
+         * creating, moving and running such a Task never allocates. Larger ones are moved to the heap.
+         *
+         */
+        class Task final
+        {
+        public:
+            static constexpr std::size_t kInlineSize = 6 * sizeof(void *);
+
+            Task() noexcept : ops_(nullptr)
+            {
+            }
+
+            template <typename F, typename Callable = typename std::decay<F>::type,
+                      typename = typename std::enable_if<!std::is_same<Callable, Task>::value>::type>
+            Task(F &&func) : ops_(&Ops<Callable, IsInline<Callable>::value>::kOps)
+            {
+                Ops<Callable, IsInline<Callable>::value>::Create(&storage_, std::forward<F>(func));
+            }
+
+            Task(Task &&other) noexcept : ops_(other.ops_)
+            {
+                if (ops_ != nullptr)
+                {
+                    ops_->move(&storage_, &other.storage_);
+                    other.ops_ = nullptr;
+                }
+            }
+
+            Task& operator=(Task &&other) noexcept
+            {
+                if (this != &other)
+                {
+                    Reset();
+                    if (other.ops_ != nullptr)
+                    {
+                        other.ops_->move(&storage_, &other.storage_);
+                        ops_ = other.ops_;
+                        other.ops_ = nullptr;
+                    }
+                }
+                return *this;
+            }
+
+            Task(Task const &) = delete;
+            Task& operator=(Task const &) = delete;
+
+            ~Task()
+            {
+                Reset();
+            }
+
+            explicit operator bool() const noexcept
+            {
+                return ops_ != nullptr;
+            }
+
+            /**
+             * \brief Run the callable. A Task must be run at most once.
+             *
+             */
+            void operator()()
+            {
+                ops_->invoke(&storage_);
+            }
+
+        private:
+            using Storage = typename std::aligned_storage<kInlineSize, alignof(std::max_align_t)>::type;
+
+            struct OpsTable
+            {
+                void (*invoke)(void *storage);
+                void (*move)(void *to, void *from) noexcept;
+                void (*destroy)(void *storage) noexcept;
+            };
+
+            template <typename F>
+            struct IsInline
+                : std::integral_constant<bool, (sizeof(F) <= sizeof(Storage)) && (alignof(F) <= alignof(Storage)) &&
+                                                   std::is_nothrow_move_constructible<F>::value>
+            {
+            };
+
+            template <typename F, bool inplace>
+            struct Ops;
+
+            template <typename F>
+            struct Ops<F, true>
+            {
+                template <typename G>
+                static void Create(void *storage, G &&func)
+                {
+                    new (storage) F(std::forward<G>(func));
+                }
+
+                static void Invoke(void *storage)
+                {
+                    (*static_cast<F *>(storage))();
+                }
+
+                static void Move(void *to, void *from) noexcept
+                {
+                    new (to) F(std::move(*static_cast<F *>(from)));
+                    static_cast<F *>(from)->~F();
+                }
+
+                static void Destroy(void *storage) noexcept
+                {
+                    static_cast<F *>(storage)->~F();
+                }
+
+                static constexpr OpsTable kOps{&Invoke, &Move, &Destroy};
+            };
+
+            template <typename F>
+            struct Ops<F, false>
+            {
+                template <typename G>
+                static void Create(void *storage, G &&func)
+                {
+                    new (storage) F *(new F(std::forward<G>(func)));
+                }
+
+                static void Invoke(void *storage)
+                {
+                    (**static_cast<F **>(storage))();
+                }
+
+                static void Move(void *to, void *from) noexcept
+                {
+                    new (to) F *(*static_cast<F **>(from));
+                }
+
+                static void Destroy(void *storage) noexcept
+                {
+                    delete *static_cast<F **>(storage);
+                }
+
+                static constexpr OpsTable kOps{&Invoke, &Move, &Destroy};
+            };
+
+            void Reset() noexcept
+            {
+                if (ops_ != nullptr)
+                {
+                    ops_->destroy(&storage_);
+                    ops_ = nullptr;
+                }
+            }
+
+            Storage storage_;
+            OpsTable const *ops_;
+        };
+
+        template <typename F>
+        constexpr Task::OpsTable Task::Ops<F, true>::kOps;
+
+        template <typename F>
+        constexpr Task::OpsTable Task::Ops<F, false>::kOps;
+    } // namespace internal
+
+    /**
+     * \brief Interface of an execution context that Future continuations can be posted to.
+     *
+     */
+    class Executor
+    {
+    public:
+        /**
+         * \brief A unit of work, movable but not copyable, that must be run exactly once.
+         *
+         */
+        using Task = internal::Task;
+
+        virtual ~Executor() = default;
+
+        /**
+         * \brief Schedule task for execution.
+         *
+         * This is called in the context of Promise::set_value(), Promise::SetError() or Future::then(),
+         * whichever makes the continuation runnable.
+         *
+         * \param[in] task      the task
+         */
+        virtual void Post(Task task) = 0;
+    };
+} // namespace core
+} // namespace ara
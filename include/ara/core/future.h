@@ -1,18 +1,28 @@
 /**
  * \file future.h
  * \author Vincent WANG (vin@misday.com)
- * \brief 
+ * \brief
  * \version 0.1
  * \date 2020-12-04
- * 
+ *
  * \copyright Copyright (c) 2020
- * 
+ *
  */
 // R19-11
 
 #pragma once
 
+#include <chrono>
 #include <cstdint>
+#include <type_traits>
+#include <utility>
+#include "abort.h"
+#include "error_code.h"
+#include "exception.h"
+#include "executor.h"
+#include "future_error_domain.h"
+#include "result.h"
+#include "shared_state.h"
 
 namespace ara
 {
@@ -21,12 +31,12 @@ namespace ara
         // SWS_CORE_00361
         /**
          * \brief Specifies the state of a Future as returned by wait_for() and wait_until().
-         * 
+         *
          * These definitions are equivalent to the ones from std::future_status. However, no item
          * equivalent to std::future_status::deferred is available here.
-         * 
+         *
          * The numerical values of the enum items are implementation-defined.
-         * 
+         *
          */
         enum class future_status : uint8_t
         {
@@ -35,28 +45,541 @@ namespace ara
                             specified timeout has passed */
         };
 
+        template <typename T, typename E>
+        class Future;
+
+        template <typename T, typename E>
+        class Promise;
+
+        namespace internal
+        {
+            template <typename T, typename E>
+            class PromiseBase;
+
+            template <typename T, typename E>
+            class FutureBase;
+
+            /**
+             * \brief Result type of Future<T, E>::then(F): the return type U of F with implicit Future and
+             * Result unwrapping applied.
+             *
+             */
+            template <typename U, typename E>
+            struct ContinuationResult
+            {
+                using FutureType = Future<U, E>;
+                using PromiseType = Promise<U, E>;
+            };
+
+            template <typename T2, typename E2, typename E>
+            struct ContinuationResult<Result<T2, E2>, E>
+            {
+                using FutureType = Future<T2, E2>;
+                using PromiseType = Promise<T2, E2>;
+            };
+
+            template <typename T2, typename E2, typename E>
+            struct ContinuationResult<Future<T2, E2>, E>
+            {
+                using FutureType = Future<T2, E2>;
+                using PromiseType = Promise<T2, E2>;
+            };
+
+            template <typename T, typename E, typename F>
+            struct ContinuationTraits
+                : ContinuationResult<typename std::decay<decltype(std::declval<typename std::decay<F>::type &>()(
+                                         std::declval<Future<T, E>>()))>::type,
+                                     E>
+            {
+            };
+
+            /**
+             * \brief Make the state of promise ready with what a continuation returned.
+             *
+             */
+            template <typename T, typename E>
+            void Settle(Promise<T, E> &promise, Result<T, E> &&result)
+            {
+                if (result.HasValue())
+                {
+                    promise.set_value(std::move(result).Value());
+                }
+                else
+                {
+                    promise.SetError(std::move(result).Error());
+                }
+            }
+
+            template <typename E>
+            void Settle(Promise<void, E> &promise, Result<void, E> &&result)
+            {
+                if (result.HasValue())
+                {
+                    promise.set_value();
+                }
+                else
+                {
+                    promise.SetError(std::move(result).Error());
+                }
+            }
+
+            template <typename T, typename E>
+            void Settle(Promise<T, E> &promise, Future<T, E> &&future)
+            {
+                FutureBase<T, E>::Forward(std::move(future), std::move(promise));
+            }
+
+            template <typename T, typename E, typename U>
+            void Settle(Promise<T, E> &promise, U &&value)
+            {
+                promise.set_value(std::forward<U>(value));
+            }
+
+            /**
+             * \brief Make the state of promise ready with the ErrorCode of an ara::core::Exception thrown by a
+             * continuation, if E can hold it. Otherwise the Promise is left to break when it is destroyed.
+             *
+             */
+            template <typename T, typename E>
+            auto Fail(Promise<T, E> &promise, ErrorCode const &error) ->
+                typename std::enable_if<std::is_constructible<E, ErrorCode const &>::value>::type
+            {
+                promise.SetError(E(error));
+            }
+
+            template <typename T, typename E>
+            auto Fail(Promise<T, E> &, ErrorCode const &) ->
+                typename std::enable_if<!std::is_constructible<E, ErrorCode const &>::value>::type
+            {
+            }
+
+            /**
+             * \brief Check that the shared state can report its own errors (no_state, broken_promise, ...),
+             * which are future_errc values.
+             *
+             */
+            template <typename E>
+            struct CanHoldFutureErrc
+                : std::integral_constant<bool, std::is_constructible<E, future_errc>::value>
+            {
+            };
+
+            /**
+             * \brief The Task stored by Future<T, E>::then(F): calls F with the ready Future and settles the
+             * Future returned by then().
+             *
+             * An ara::core::Exception thrown by F settles that Future with its ErrorCode. Any other exception is
+             * left to the caller, which destroys the Task and thereby breaks the Promise (broken_promise).
+             */
+            template <typename T, typename E, typename F>
+            class Continuation final
+            {
+                using PromiseType = typename ContinuationTraits<T, E, F>::PromiseType;
+                using ReturnType = decltype(std::declval<F &>()(std::declval<Future<T, E>>()));
+
+            public:
+                template <typename G>
+                Continuation(Future<T, E> &&future, G &&func, PromiseType &&promise)
+                    : future_(std::move(future)), func_(std::forward<G>(func)), promise_(std::move(promise))
+                {
+                }
+
+                void operator()()
+                {
+#if ARA_CORE_EXCEPTIONS
+                    try
+                    {
+                        Run(std::is_void<ReturnType>());
+                    }
+                    catch (Exception const &e)
+                    {
+                        Fail(promise_, e.Error());
+                    }
+#else
+                    Run(std::is_void<ReturnType>());
+#endif
+                }
+
+            private:
+                void Run(std::true_type)
+                {
+                    func_(std::move(future_));
+                    promise_.set_value();
+                }
+
+                void Run(std::false_type)
+                {
+                    Settle(promise_, func_(std::move(future_)));
+                }
+
+                Future<T, E> future_;
+                F func_;
+                PromiseType promise_;
+            };
+
+            /**
+             * \brief Default notification of Forwarding: none.
+             *
+             */
+            struct NoNotification
+            {
+                void operator()() const noexcept
+                {
+                }
+            };
+
+            /**
+             * \brief The Task that hands the result of one Future on to the Promise of another one, e.g. of a
+             * Future returned by a continuation on to the Future returned by then(), and then calls notify.
+             *
+             */
+            template <typename T, typename E, typename Notify = NoNotification>
+            class Forwarding final
+            {
+            public:
+                Forwarding(Future<T, E> &&future, Promise<T, E> &&promise, Notify &&notify) noexcept
+                    : future_(std::move(future)), promise_(std::move(promise)), notify_(std::move(notify))
+                {
+                }
+
+                void operator()()
+                {
+                    Settle(promise_, future_.GetResult());
+                    notify_();
+                }
+
+            private:
+                Future<T, E> future_;
+                Promise<T, E> promise_;
+                Notify notify_;
+            };
+
+            /**
+             * \brief The Task that posts another one to an Executor.
+             *
+             */
+            template <typename Body>
+            class Posting final
+            {
+            public:
+                Posting(Executor &executor, Body &&body) noexcept(std::is_nothrow_move_constructible<Body>::value)
+                    : executor_(&executor), body_(std::move(body))
+                {
+                }
+
+                void operator()()
+                {
+                    executor_->Post(Task(std::move(body_)));
+                }
+
+            private:
+                Executor *executor_;
+                Body body_;
+            };
+
+            /**
+             * \brief The parts of Future that do not depend on whether T is void: a counted reference to the
+             * shared state, and waiting for it.
+             *
+             */
+            template <typename T, typename E>
+            class FutureBase
+            {
+                static_assert(CanHoldFutureErrc<E>::value, "the error type of a Future must be constructible from "
+                                                           "future_errc, e.g. ErrorCode");
+
+            public:
+                FutureBase(FutureBase const &) = delete;
+                FutureBase& operator=(FutureBase const &) = delete;
+
+                Result<T, E> GetResult() noexcept
+                {
+                    if (state_ == nullptr)
+                    {
+                        return Result<T, E>::FromError(future_errc::no_state);
+                    }
+                    state_->Wait();
+                    Result<T, E> result(std::move(*state_->Get()));
+                    Reset();
+                    return result;
+                }
+
+                bool valid() const noexcept
+                {
+                    return state_ != nullptr;
+                }
+
+                void wait() const
+                {
+                    if (state_ != nullptr)
+                    {
+                        state_->Wait();
+                    }
+                }
+
+                template<typename Rep, typename Period>
+                future_status wait_for(std::chrono::duration<Rep, Period> const &timeoutDuration) const
+                {
+                    return wait_until(std::chrono::steady_clock::now() + timeoutDuration);
+                }
+
+                template<typename Clock, typename Duration>
+                future_status wait_until(std::chrono::time_point<Clock, Duration> const &deadline) const
+                {
+                    return ((state_ != nullptr) && state_->WaitUntil(deadline)) ? future_status::ready : future_status::timeout;
+                }
+
+                bool is_ready() const
+                {
+                    return (state_ != nullptr) && state_->IsReady();
+                }
+
+                /**
+                 * \brief Attach func to the shared state of future, to be run inline or posted to executor.
+                 *
+                 * \param[in] future       the Future, invalid afterwards
+                 * \param[in] func         the continuation
+                 * \param[in] executor     the executor, or nullptr to run func inline
+                 * \return                 the Future for the result of func
+                 */
+                template <typename F>
+                static typename ContinuationTraits<T, E, F>::FutureType Then(Future<T, E> &&future, F &&func,
+                                                                             Executor *executor)
+                {
+                    using Traits = ContinuationTraits<T, E, F>;
+                    using Body = Continuation<T, E, typename std::decay<F>::type>;
+
+                    typename Traits::PromiseType promise;
+                    typename Traits::FutureType result = promise.get_future();
+                    SharedState<T, E> *const state = static_cast<FutureBase &>(future).state_;
+                    if (state == nullptr)
+                    {
+                        promise.SetError(future_errc::no_state);
+                        return result;
+                    }
+
+                    Body body(std::move(future), std::forward<F>(func), std::move(promise));
+                    if (executor == nullptr)
+                    {
+                        state->SetContinuation(Task(std::move(body)));
+                    }
+                    else
+                    {
+                        state->SetContinuation(Task(Posting<Body>(*executor, std::move(body))));
+                    }
+                    return result;
+                }
+
+                /**
+                 * \brief Make the state of promise ready with the result of future once that is ready, then
+                 * call notify.
+                 *
+                 * \param[in] future       the Future, invalid afterwards
+                 * \param[in] promise      the Promise, invalid afterwards
+                 * \param[in] notify       a nothrow-movable callable
+                 */
+                template <typename Notify = NoNotification>
+                static void Forward(Future<T, E> &&future, Promise<T, E> &&promise, Notify notify = Notify())
+                {
+                    SharedState<T, E> *const state = static_cast<FutureBase &>(future).state_;
+                    if (state == nullptr)
+                    {
+                        promise.SetError(future_errc::no_state);
+                        notify();
+                        return;
+                    }
+                    state->SetContinuation(
+                        Task(Forwarding<T, E, Notify>(std::move(future), std::move(promise), std::move(notify))));
+                }
+
+                /**
+                 * \brief Have task run when future becomes ready, unless it is ready already. future stays valid.
+                 *
+                 * \param[in] future       the Future
+                 * \param[in] task         the task to run
+                 * \return true            if task will be run
+                 * \return false           if future is ready or invalid, task is dropped then
+                 */
+                static bool Subscribe(Future<T, E> &future, Task &&task)
+                {
+                    SharedState<T, E> *const state = static_cast<FutureBase &>(future).state_;
+                    return (state != nullptr) && state->Subscribe(std::move(task));
+                }
+
+            protected:
+                FutureBase() noexcept : state_(nullptr)
+                {
+                }
+
+                explicit FutureBase(SharedState<T, E> *state) noexcept : state_(state)
+                {
+                }
+
+                FutureBase(FutureBase &&other) noexcept : state_(other.state_)
+                {
+                    other.state_ = nullptr;
+                }
+
+                FutureBase& operator=(FutureBase &&other) noexcept
+                {
+                    if (this != &other)
+                    {
+                        Reset();
+                        state_ = other.state_;
+                        other.state_ = nullptr;
+                    }
+                    return *this;
+                }
+
+                ~FutureBase()
+                {
+                    Reset();
+                }
+
+                void Reset() noexcept
+                {
+                    if (state_ != nullptr)
+                    {
+                        state_->Release();
+                        state_ = nullptr;
+                    }
+                }
+
+                SharedState<T, E> *state_;
+            };
+
+            /**
+             * \brief The parts of Promise that do not depend on whether T is void.
+             *
+             */
+            template <typename T, typename E>
+            class PromiseBase
+            {
+                static_assert(CanHoldFutureErrc<E>::value, "the error type of a Promise must be constructible from "
+                                                           "future_errc, e.g. ErrorCode");
+
+            public:
+                PromiseBase(PromiseBase const &) = delete;
+                PromiseBase& operator=(PromiseBase const &) = delete;
+
+                void swap(PromiseBase &other) noexcept
+                {
+                    std::swap(state_, other.state_);
+                }
+
+                Future<T, E> get_future()
+                {
+                    if (state_ == nullptr)
+                    {
+                        Throw(future_errc::no_state);
+                    }
+                    if (!state_->Retrieve())
+                    {
+                        Throw(future_errc::future_already_retrieved);
+                    }
+                    state_->AddRef();
+                    return Future<T, E>(state_);
+                }
+
+                void SetError(E &&error)
+                {
+                    Store(Result<T, E>::FromError(std::move(error)));
+                }
+
+                void SetError(E const &error)
+                {
+                    Store(Result<T, E>::FromError(error));
+                }
+
+            protected:
+                PromiseBase() : state_(new SharedState<T, E>())
+                {
+                }
+
+                PromiseBase(PromiseBase &&other) noexcept : state_(other.state_)
+                {
+                    other.state_ = nullptr;
+                }
+
+                PromiseBase& operator=(PromiseBase &&other) noexcept
+                {
+                    if (this != &other)
+                    {
+                        Abandon();
+                        state_ = other.state_;
+                        other.state_ = nullptr;
+                    }
+                    return *this;
+                }
+
+                ~PromiseBase()
+                {
+                    Abandon();
+                }
+
+                /**
+                 * \brief Make the shared state ready with the given Result.
+                 *
+                 * \param[in] result    the Result
+                 */
+                void Store(Result<T, E> &&result)
+                {
+                    if (state_ == nullptr)
+                    {
+                        Throw(future_errc::no_state);
+                    }
+                    if (!state_->Emplace(std::move(result)))
+                    {
+                        Throw(future_errc::promise_already_satisfied);
+                    }
+                }
+
+            private:
+                static void Throw(future_errc code)
+                {
+                    ErrorCode(code).ThrowAsException();
+                }
+
+                // A Promise destroyed before it was satisfied breaks its promise.
+                void Abandon() noexcept
+                {
+                    if (state_ != nullptr)
+                    {
+                        (void)state_->Emplace(Result<T, E>::FromError(future_errc::broken_promise));
+                        state_->Release();
+                        state_ = nullptr;
+                    }
+                }
+
+                SharedState<T, E> *state_;
+            };
+        } // namespace internal
+
         // SWS_CORE_00321
         /**
          * \brief Provides ara::core specific Future operations to collect the results of an asynchronous call.
-         * 
-         * \tparam T    the type of values 
-         * \tparam E    the type of errors
+         *
+         * \tparam T    the type of values
+         * \tparam E    the type of errors, constructible from future_errc (checked at compile time)
          */
         template <typename T, typename E = ErrorCode>
-        class Future final
+        class Future final : private internal::FutureBase<T, E>
         {
+            using Base = internal::FutureBase<T, E>;
+
+        public:
             // SWS_CORE_00322
             /**
              * \brief Default constructor.
              * This function shall behave the same as the corresponding std::future function.
-             * 
+             *
              */
             Future() noexcept = default;
 
             // SWS_CORE_00334
             /**
              * \brief Copy constructor shall be disabled.
-             * 
+             *
              */
             Future(Future const &) = delete;
 
@@ -64,24 +587,24 @@ namespace ara
             /**
              * \brief Move construct from another instance.
              * This function shall behave the same as the corresponding std::future function.
-             * 
+             *
              * \param[in] other     the other instance
              */
-            Future(Future &&other) noexcept;
+            Future(Future &&other) noexcept = default;
 
             // SWS_CORE_00333
             /**
              * \brief Destructor for Future objects.
              * This function shall behave the same as the corresponding std::future function.
-             * 
+             *
              */
-            ~Future();
+            ~Future() = default;
 
             // SWS_CORE_00335
             /**
              * \brief Copy assignment operator shall be disabled.
-             * 
-             * \return Future& 
+             *
+             * \return Future&
              */
             Future& operator=(Future const &) = delete;
 
@@ -89,153 +612,190 @@ namespace ara
             /**
              * \brief Move assign from another instance.
              * This function shall behave the same as the corresponding std::future function.
-             * 
+             *
              * \param[in] other     the other instance
              * \return Future&      *this
              */
-            Future& operator=(Future &&other) noexcept;
+            Future& operator=(Future &&other) noexcept = default;
 
             // SWS_CORE_00326
             /**
              * \brief Get the value.
-             * 
+             *
              * This function shall behave the same as the corresponding std::future function.
-             * 
-             * This function does not participate in overload resolution when the compiler toolchain does not
-             * support C++ exceptions.
-             * 
+             *
+             * In builds without exceptions (ARA_CORE_EXCEPTIONS == 0) an error is passed to Abort() instead of
+             * being thrown.
+             *
              * \return T    value of type T
-             * 
+             *
              * \errors Domain:error     the error that has been put into the corresponding
              *                          Promise via Promise::SetError
              */
-            T get();
+            T get()
+            {
+                return GetResult().ValueOrThrow();
+            }
 
             // SWS_CORE_00336
             /**
              * \brief Get the result.
-             * 
+             *
              * Similar to get(), this call blocks until the value or an error is available. However, this call will
              * never throw an exception.
-             * 
+             *
              * \return Result<T, E>     a Result with either a value or an error
-             * 
+             *
              * \errors Domain:error     the error that has been put into the corresponding
              *                          Promise via Promise::SetError
              */
-            Result<T, E> GetResult() noexcept;
+            using Base::GetResult;
 
             // SWS_CORE_00327
             /**
              * \brief Checks if the Future is valid, i.e. if it has a shared state.
-             * 
+             *
              * This function shall behave the same as the corresponding std::future function.
-             * 
+             *
              * \return true     if the Future is usable
              * \return false    otherwise
              */
-            bool valid() const noexcept;
+            using Base::valid;
 
             // SWS_CORE_00328
             /**
              * \brief Wait for a value or an error to be available.
-             * 
+             *
              * This function shall behave the same as the corresponding std::future function.
-             * 
+             *
              */
-            void wait() const;
+            using Base::wait;
 
             // SWS_CORE_00329
             /**
              * \brief Wait for the given period, or until a value or an error is available.
-             * 
+             *
              * This function shall behave the same as the corresponding std::future function.
-             * 
-             * \tparam Rep 
-             * \tparam Period 
-             * 
+             *
+             * \tparam Rep
+             * \tparam Period
+             *
              * \param[in] timeoutDuration   maximal duration to wait for
-             * 
+             *
              * \return future_status        status that indicates whether the timeout hit or if a
              *                              value is available
              */
-            template<typename Rep, typename Period>
-            future_status wait_for(std::chrono::duration<Rep, Period> const &timeoutDuration) const;
+            using Base::wait_for;
 
             // SWS_CORE_00330
             /**
              * \brief Wait until the given time, or until a value or an error is available.
-             * 
+             *
              * This function shall behave the same as the corresponding std::future function.
-             * 
-             * \tparam Clock 
-             * \tparam Duration 
+             *
+             * \tparam Clock
+             * \tparam Duration
              * \param[in] deadline      latest point in time to wait
              * \return future_status    status that indicates whether the time was reached
              *                          or if a value is available
              */
-            template<typename Clock, typename Duration>
-            future_status wait_until(std::chrono::time_point<Clock, Duration> const &deadline) const;
+            using Base::wait_until;
+
+            // SWS_CORE_00332
+            /**
+             * \brief Return whether the asynchronous operation has finished.
+             *
+             * If this function returns true, get(), GetResult() and the wait calls are guaranteed not to block.
+             *
+             * \return true     if the Future contains a value or an error
+             * \return false    otherwise
+             */
+            using Base::is_ready;
 
             // SWS_CORE_00331
             /**
              * \brief Register a callable that gets called when the Future becomes ready.
-             * 
+             *
              * When func is called, it is guaranteed that get() and GetResult() will not block.
-             * 
-             * func may be called in the context of this call or in the context of Promise::set_value() or
-             * Promise::SetError() or somewhere else.
-             * 
+             *
+             * func is called in the context of this call if the Future is ready already, otherwise in the context
+             * of Promise::set_value() or Promise::SetError(). If func throws an ara::core::Exception, the returned
+             * Future gets its ErrorCode, provided its error type can hold one; for any other exception it gets
+             * future_errc::broken_promise. The exception does not propagate into set_value() or SetError().
+             * The Future is invalid afterwards. Callables up to Executor::Task::kInlineSize bytes are stored
+             * without allocation.
+             *
              * The return type of then depends on the return type of func (aka continuation).
-             * 
+             *
              * Let U be the return type of the continuation (i.e. a type equivalent to std::result_
              * of<std::decay<F>::type(Future<T,E>)>::type). If U is Future<T2,E2> for some types T2, E2,
              * then the return type of then() is Future<T2,E2>. This is known as implicit Future unwrapping. If
              * U is Result<T2,E2> for some types T2, E2, then the return type of then() is Future<T2,E2>.
              * This is known as implicit Result unwrapping. Otherwise it is Future<U,E>.
-             * 
-             * \tparam F 
+             *
+             * \tparam F
              * \param[in] func              a callable to register
              * \return Future<SEE_BELOW>    a new Future instance for the result of the
              *                              continuation
              */
-            template<typename F>
-            auto then(F &&func) -> Future<SEE_BELOW>;
+            template <typename F>
+            auto then(F &&func) -> typename internal::ContinuationTraits<T, E, F>::FutureType
+            {
+                return Base::Then(std::move(*this), std::forward<F>(func), nullptr);
+            }
 
-            // SWS_CORE_00332
             /**
-             * \brief Return whether the asynchronous operation has finished.
-             * 
-             * If this function returns true, get(), GetResult() and the wait calls are guaranteed not to block.
-             * 
-             * \return true     if the Future contains a value or an error
-             * \return false    otherwise
+             * \brief Register a callable that gets posted to executor when the Future becomes ready.
+             *
+             * Same as then(F&&), except that func is not called inline but posted to executor in the context
+             * of this call or of Promise::set_value() or Promise::SetError().
+             *
+             * \tparam F
+             * \param[in] func              a callable to register
+             * \param[in] executor          the executor to run func on
+             * \return Future<SEE_BELOW>    a new Future instance for the result of the
+             *                              continuation
              */
-            bool is_ready() const;
+            template <typename F>
+            auto then(F &&func, Executor &executor) -> typename internal::ContinuationTraits<T, E, F>::FutureType
+            {
+                return Base::Then(std::move(*this), std::forward<F>(func), &executor);
+            }
+
+        private:
+            friend class internal::FutureBase<T, E>;
+            friend class internal::PromiseBase<T, E>;
+
+            explicit Future(internal::SharedState<T, E> *state) noexcept : Base(state)
+            {
+            }
         };
 
         // SWS_CORE_06221
         /**
          * \brief Specialization of class Future for "void" values.
-         * 
-         * \tparam E    the type of error
+         *
+         * \tparam E    the type of error, constructible from future_errc (checked at compile time)
          */
         template<typename E>
-        class Future<void, E> final
+        class Future<void, E> final : private internal::FutureBase<void, E>
         {
+            using Base = internal::FutureBase<void, E>;
+
+        public:
             // SWS_CORE_06222
             /**
              * \brief Default constructor.
              * This function shall behave the same as the corresponding std::future function.
-             * 
+             *
              */
-            Future() noexcept;
+            Future() noexcept = default;
 
             // SWS_CORE_06234
             /**
              * \brief Copy constructor shall be disabled.
-             * 
-             * \param[in] other 
+             *
+             * \param[in] other
              */
             Future(Future const &other) = delete;
 
@@ -243,25 +803,25 @@ namespace ara
             /**
              * \brief Move construct from another instance.
              * This function shall behave the same as the corresponding std::future function.
-             * 
+             *
              * \param[in] other     the other instance
              */
-            Future(Future &&other) noexcept;
+            Future(Future &&other) noexcept = default;
 
             // SWS_CORE_06233
             /**
              * \brief Destructor for Future objects.
              * This function shall behave the same as the corresponding std::future function.
-             * 
+             *
              */
-            ~Future();
+            ~Future() = default;
 
             // SWS_CORE_06235
             /**
              * \brief Copy assignment operator shall be disabled.
-             * 
-             * \param[in] other 
-             * \return Future& 
+             *
+             * \param[in] other
+             * \return Future&
              */
             Future& operator=(Future const &other) = delete;
 
@@ -269,159 +829,196 @@ namespace ara
             /**
              * \brief Move assign from another instance.
              * This function shall behave the same as the corresponding std::future function.
-             * 
+             *
              * \param[in] other     the other instance
-             * 
+             *
              * \return Future&      *this
              */
-            Future& operator=(Future &&other) noexcept;
+            Future& operator=(Future &&other) noexcept = default;
 
             // SWS_CORE_06226
             /**
              * \brief Get the value.
-             * 
+             *
              * This function shall behave the same as the corresponding std::future function.
-             * 
-             * This function does not participate in overload resolution when the compiler toolchain does not
-             * support C++ exceptions.
-             * 
+             *
+             * In builds without exceptions (ARA_CORE_EXCEPTIONS == 0) an error is passed to Abort() instead of
+             * being thrown.
+             *
              * \errors Domain:error     the error that has been put into the corresponding
              *                          Promise via Promise::SetError
              */
-            void get();
+            void get()
+            {
+                GetResult().ValueOrThrow();
+            }
 
             // SWS_CORE_06236
             /**
              * \brief Get the result.
-             * 
+             *
              * Similar to get(), this call blocks until the value or an error is available. However, this call will
              * never throw an exception.
-             * 
+             *
              * \return Result<void, E>  a Result with either a value or an error
-             * 
+             *
              * \errors Domain:error     the error that has been put into the corresponding
              *                          Promise via Promise::SetError
              */
-            Result<void, E> GetResult() noexcept;
+            using Base::GetResult;
 
             // SWS_CORE_06227
             /**
              * \brief Checks if the Future is valid, i.e. if it has a shared state.
-             * 
+             *
              * This function shall behave the same as the corresponding std::future function.
-             * 
+             *
              * \return true     if the Future is usable
              * \return false    otherwise
              */
-            bool valid() const noexcept;
+            using Base::valid;
 
             // SWS_CORE_06228
             /**
              * \brief Wait for a value or an error to be available.
-             * 
+             *
              * This function shall behave the same as the corresponding std::future function.
-             * 
+             *
              */
-            void wait() const;
+            using Base::wait;
 
             // SWS_CORE_06229
             /**
              * \brief Wait for the given period, or until a value or an error is available.
-             * 
+             *
              * This function shall behave the same as the corresponding std::future function.
-             * 
-             * \tparam Rep 
-             * \tparam Period 
+             *
+             * \tparam Rep
+             * \tparam Period
              * \param[in] timeoutDuration   maximal duration to wait for
              * \return future_status        status that indicates whether the timeout hit or if a
              *                              value is available
              */
-            template<typename Rep, typename Period>
-            future_status wait_for(std::chrono::duration<Rep, Period> const &timeoutDuration) const;
+            using Base::wait_for;
 
             // SWS_CORE_06230
             /**
              * \brief Wait until the given time, or until a value or an error is available.
              * This function shall behave the same as the corresponding std::future function.
-             * 
-             * \tparam Clock 
-             * \tparam Duration 
+             *
+             * \tparam Clock
+             * \tparam Duration
              * \param[in] deadline      latest point in time to wait
              * \return future_status    status that indicates whether the time was reached
              *                          or if a value is available
              */
-            template<typename Clock, typename Duration>
-            future_status wait_until(std::chrono::time_point<Clock, Duration> const &deadline) const;
+            using Base::wait_until;
+
+            // SWS_CORE_06232
+            /**
+             * \brief Return whether the asynchronous operation has finished.
+             *
+             * If this function returns true, get(), GetResult() and the wait calls are guaranteed not to block.
+             *
+             * \return true     if the Future contains a value or an error
+             * \return false    otherwise
+             */
+            using Base::is_ready;
 
             // SWS_CORE_06231
             /**
              * \brief Register a callable that gets called when the Future becomes ready.
-             * 
+             *
              * When func is called, it is guaranteed that get() and GetResult() will not block.
-             * 
-             * func may be called in the context of this call or in the context of Promise::set_value() or
-             * Promise::SetError() or somewhere else.
-             * 
+             *
+             * func is called in the context of this call if the Future is ready already, otherwise in the context
+             * of Promise::set_value() or Promise::SetError(). If func throws an ara::core::Exception, the returned
+             * Future gets its ErrorCode, provided its error type can hold one; for any other exception it gets
+             * future_errc::broken_promise. The exception does not propagate into set_value() or SetError().
+             * The Future is invalid afterwards. Callables up to Executor::Task::kInlineSize bytes are stored
+             * without allocation.
+             *
              * The return type of then depends on the return type of func (aka continuation).
-             * 
+             *
              * Let U be the return type of the continuation (i.e. a type equivalent to std::result_
              * of<std::decay<F>::type(Future<T,E>)>::type). If U is Future<T2,E2> for some types T2, E2,
              * then the return type of then() is Future<T2,E2>. This is known as implicit Future unwrapping. If
              * U is Result<T2,E2> for some types T2, E2, then the return type of then() is Future<T2,E2>.
              * This is known as implicit Result unwrapping. Otherwise it is Future<U,E>.
-             * 
-             * \tparam F 
-             * \param[in] func  a callable to register
+             *
+             * \tparam F
+             * \param[in] func              a callable to register
              * \return Future<SEE_BELOW>    a new Future instance for the result of the
              *                              continuation
              */
-            template<typename F>
-            auto then(F &&func) -> Future<SEE_BELOW>;
+            template <typename F>
+            auto then(F &&func) -> typename internal::ContinuationTraits<void, E, F>::FutureType
+            {
+                return Base::Then(std::move(*this), std::forward<F>(func), nullptr);
+            }
 
-            // SWS_CORE_06232
             /**
-             * \brief Return whether the asynchronous operation has finished.
-             * 
-             * If this function returns true, get(), GetResult() and the wait calls are guaranteed not to block.
-             * 
-             * \return true     if the Future contains a value or an error
-             * \return false    otherwise
+             * \brief Register a callable that gets posted to executor when the Future becomes ready.
+             *
+             * Same as then(F&&), except that func is not called inline but posted to executor in the context
+             * of this call or of Promise::set_value() or Promise::SetError().
+             *
+             * \tparam F
+             * \param[in] func              a callable to register
+             * \param[in] executor          the executor to run func on
+             * \return Future<SEE_BELOW>    a new Future instance for the result of the
+             *                              continuation
              */
-            bool is_ready() const;
+            template <typename F>
+            auto then(F &&func, Executor &executor) -> typename internal::ContinuationTraits<void, E, F>::FutureType
+            {
+                return Base::Then(std::move(*this), std::forward<F>(func), &executor);
+            }
+
+        private:
+            friend class internal::FutureBase<void, E>;
+            friend class internal::PromiseBase<void, E>;
+
+            explicit Future(internal::SharedState<void, E> *state) noexcept : Base(state)
+            {
+            }
         };
 
         // SWS_CORE_00340
         /**
          * \brief ara::core specific variant of std::promise class
-         * 
-         * \tparam T    the type of value 
-         * \tparam E    the type of error
+         *
+         * \tparam T    the type of value
+         * \tparam E    the type of error, constructible from future_errc (checked at compile time)
          */
         template<typename T, typename E = ErrorCode>
-        class Promise
+        class Promise : private internal::PromiseBase<T, E>
         {
+            using Base = internal::PromiseBase<T, E>;
+
+        public:
             // SWS_CORE_00341
             /**
              * \brief Default constructor.
-             * 
+             *
              * This function shall behave the same as the corresponding std::promise function.
-             * 
+             *
              */
-            Promise();
+            Promise() = default;
 
             // SWS_CORE_00342
             /**
              * \brief Move constructor.
              * This function shall behave the same as the corresponding std::promise function.
-             * 
+             *
              * \param[in] other     the other instance
              */
-            Promise(Promise &&other) noexcept;
+            Promise(Promise &&other) noexcept = default;
 
             // SWS_CORE_00350
             /**
              * \brief Copy constructor shall be disabled.
-             * 
+             *
              */
             Promise(Promise const &) = delete;
 
@@ -429,25 +1026,25 @@ namespace ara
             /**
              * \brief Destructor for Promise objects.
              * This function shall behave the same as the corresponding std::promise function.
-             * 
+             *
              */
-            ~Promise();
+            ~Promise() = default;
 
             // SWS_CORE_00343
             /**
              * \brief Move assignment.
              * This function shall behave the same as the corresponding std::promise function.
-             * 
+             *
              * \param[in] other     the other instance
              * \return Promise&     *this
              */
-            Promise& operator=(Promise &&other) noexcept;
+            Promise& operator=(Promise &&other) noexcept = default;
 
             // SWS_CORE_00351
             /**
              * \brief Copy assignment operator shall be disabled.
-             * 
-             * \return Promise& 
+             *
+             * \return Promise&
              */
             Promise& operator=(Promise const &) = delete;
 
@@ -455,56 +1052,66 @@ namespace ara
             /**
              * \brief Swap the contents of this instance with another one’s.
              * This function shall behave the same as the corresponding std::promise function.
-             * 
+             *
              * \param[in] other     the other instance
              */
-            void swap(Promise &other) noexcept;
+            void swap(Promise &other) noexcept
+            {
+                Base::swap(other);
+            }
 
             // SWS_CORE_00344
             /**
              * \brief Return the associated Future.
-             * 
+             *
              * The returned Future is set as soon as this Promise receives the result or an error. This method
              * must only be called once as it is not allowed to have multiple Futures per Promise.
-             * 
+             *
              * \return Future<T, E>     a Future
              */
-            Future<T, E> get_future();
+            using Base::get_future;
 
             // SWS_CORE_00345
             /**
              * \brief Copy a value into the shared state and make the state ready.
-             * 
+             *
              * This function shall behave the same as the corresponding std::promise function.
-             * 
+             *
              * \param[in] value     the value to store
              */
-            void set_value(T const &value);
+            void set_value(T const &value)
+            {
+                this->Store(Result<T, E>::FromValue(value));
+            }
 
             // SWS_CORE_00346
             /**
              * \brief Move a value into the shared state and make the state ready.
              * This function shall behave the same as the corresponding std::promise function.
-             * 
+             *
              * \param[in] value     the value to store
              */
-            void set_value(T &&value);
+            void set_value(T &&value)
+            {
+                this->Store(Result<T, E>::FromValue(std::move(value)));
+            }
 
             // SWS_CORE_00353
             /**
              * \brief Move an error into the shared state and make the state ready.
-             * 
+             *
              * \param[in] error     the error to store
              */
-            void SetError(E &&error);
-
             // SWS_CORE_00354
             /**
              * \brief Copy an error into the shared state and make the state ready.
-             * 
+             *
              * \param[in] error     the error to store
              */
-            void SetError(E const &error);
+            using Base::SetError;
         };
     } // namespace core
 } // namespace ara
+
+#include "promise.h"
+#include "coroutine.h"
@@ -0,0 +1,277 @@
+/**
+ * \file future_combinators.h
+ * \author Vincent WANG (vin@misday.com)
+ * \brief WhenAll() and WhenAny(): Futures that become ready with all or the first of a set of Futures.
+ * \version 0.1
+ * \date 2021-11-12
+ *
+ * \copyright Copyright (c) 2021
+ *
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <iterator>
+#include <limits>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include "future.h"
+#include "vector.h"
+
+namespace ara
+{
+namespace core
+{
+    /**
+     * \brief Value of the Future returned by WhenAny().
+     *
+     * \tparam Sequence     the container of the Futures passed to WhenAny()
+     */
+    template <typename Sequence>
+    struct WhenAnyResult
+    {
+        std::size_t index;      /*< position of the first Future that became ready, or SIZE_MAX if there were none */
+        Sequence futures;       /*< the Futures in the order passed in */
+    };
+
+    namespace internal
+    {
+        template <typename F>
+        struct FutureTraits;
+
+        template <typename T, typename E>
+        struct FutureTraits<Future<T, E>>
+        {
+            using ValueType = T;
+            using ErrorType = E;
+            using PromiseType = Promise<T, E>;
+        };
+
+        /**
+         * \brief The single allocation of a WhenAll(): the Futures, a countdown of those not yet ready, and the
+         * Promise of the result.
+         *
+         * The countdown starts with one extra count that WhenAll() holds while it registers the callbacks, so
+         * the result cannot become ready half way through.
+         *
+         */
+        template <typename Sequence>
+        class WhenAllState final
+        {
+        public:
+            WhenAllState(Sequence &&futures, std::size_t count) : futures_(std::move(futures)), pending_(count + 1U)
+            {
+            }
+
+            Sequence& Futures() noexcept
+            {
+                return futures_;
+            }
+
+            Future<Sequence> GetFuture()
+            {
+                return promise_.get_future();
+            }
+
+            /**
+             * \brief Count future down once it is ready.
+             *
+             * \param[in] future    a Future in Futures()
+             */
+            template <typename T, typename E>
+            void Watch(Future<T, E> &future)
+            {
+                if (!FutureBase<T, E>::Subscribe(future, Task([this]() { Arrive(); })))
+                {
+                    Arrive();
+                }
+            }
+
+            void Arrive()
+            {
+                if (pending_.fetch_sub(1U, std::memory_order_acq_rel) == 1U)
+                {
+                    promise_.set_value(std::move(futures_));
+                    delete this;
+                }
+            }
+
+        private:
+            Sequence futures_;
+            std::atomic<std::size_t> pending_;
+            Promise<Sequence> promise_;
+        };
+
+        template <typename Sequence, std::size_t... I>
+        void WatchEach(WhenAllState<Sequence> &state, std::index_sequence<I...>)
+        {
+            using Expand = int[];
+            (void)Expand{0, (state.Watch(std::get<I>(state.Futures())), 0)...};
+        }
+
+        /**
+         * \brief The shared part of a WhenAny(): the Futures handed out, a countdown of the callbacks that
+         * still refer to it, and the Promise of the result.
+         *
+         * The inputs are not watched directly but forwarded to the Futures handed out, so those have no
+         * callback attached and can be waited on or continued with then() like any other Future.
+         *
+         */
+        template <typename Sequence>
+        class WhenAnyState final
+        {
+        public:
+            WhenAnyState(Sequence &&futures, std::size_t count)
+                : futures_(std::move(futures)), pending_(count + 1U), fired_(false)
+            {
+            }
+
+            Future<WhenAnyResult<Sequence>> GetFuture()
+            {
+                return promise_.get_future();
+            }
+
+            /**
+             * \brief Called once for every input once its result was forwarded, and once by WhenAny() when
+             * all callbacks are registered.
+             *
+             * \param[in] index     the position of the input, or kNone
+             */
+            void Arrive(std::size_t index)
+            {
+                if ((index != kNone) && !fired_.exchange(true, std::memory_order_acq_rel))
+                {
+                    promise_.set_value(WhenAnyResult<Sequence>{index, std::move(futures_)});
+                }
+                if (pending_.fetch_sub(1U, std::memory_order_acq_rel) == 1U)
+                {
+                    delete this;
+                }
+            }
+
+            static constexpr std::size_t kNone = std::numeric_limits<std::size_t>::max();
+
+        private:
+            Sequence futures_;
+            std::atomic<std::size_t> pending_;
+            std::atomic<bool> fired_;
+            Promise<WhenAnyResult<Sequence>> promise_;
+        };
+
+        template <typename Sequence>
+        constexpr std::size_t WhenAnyState<Sequence>::kNone;
+
+        template <typename Sequence>
+        class WhenAnyNotification final
+        {
+        public:
+            WhenAnyNotification(WhenAnyState<Sequence> &state, std::size_t index) noexcept
+                : state_(&state), index_(index)
+            {
+            }
+
+            void operator()() const
+            {
+                state_->Arrive(index_);
+            }
+
+        private:
+            WhenAnyState<Sequence> *state_;
+            std::size_t index_;
+        };
+    } // namespace internal
+
+    /**
+     * \brief Create a Future that becomes ready when all given Futures are ready.
+     *
+     * No thread is involved: a callback on each shared state counts down a single atomic counter, and the
+     * last one makes the returned Future ready, in the context of the Promise::set_value() or
+     * Promise::SetError() that completed the set.
+     *
+     * \param[in] futures   the Futures, consumed
+     * \return              a Future of the given Futures, all of them ready
+     */
+    template <typename... Ts, typename... Es>
+    Future<std::tuple<Future<Ts, Es>...>> WhenAll(Future<Ts, Es> &&... futures)
+    {
+        using Sequence = std::tuple<Future<Ts, Es>...>;
+
+        auto *const state = new internal::WhenAllState<Sequence>(Sequence(std::move(futures)...), sizeof...(Ts));
+        Future<Sequence> result = state->GetFuture();
+        internal::WatchEach(*state, std::index_sequence_for<Ts...>());
+        state->Arrive();
+        return result;
+    }
+
+    /**
+     * \brief Create a Future that becomes ready when all Futures in [first, last) are ready.
+     *
+     * \param[in] first     the first Future, moved from
+     * \param[in] last      the end of the range
+     * \return              a Future of the given Futures, all of them ready
+     */
+    template <typename InputIt, typename F = typename std::iterator_traits<InputIt>::value_type>
+    Future<Vector<F>> WhenAll(InputIt first, InputIt last)
+    {
+        Vector<F> futures(std::make_move_iterator(first), std::make_move_iterator(last));
+        std::size_t const count = futures.size();
+
+        auto *const state = new internal::WhenAllState<Vector<F>>(std::move(futures), count);
+        Future<Vector<F>> result = state->GetFuture();
+        for (F &future : state->Futures())
+        {
+            state->Watch(future);
+        }
+        state->Arrive();
+        return result;
+    }
+
+    /**
+     * \brief Create a Future that becomes ready when the first of the Futures in [first, last) is ready.
+     *
+     * The Futures handed back carry the results of the given ones; the one at WhenAnyResult::index is ready.
+     * Each input costs one extra shared state for that, and no thread is involved. An empty range gives a
+     * ready Future with index SIZE_MAX.
+     *
+     * \param[in] first     the first Future, moved from
+     * \param[in] last      the end of the range
+     * \return              a Future of the index of the first ready Future and of all Futures
+     */
+    template <typename InputIt, typename F = typename std::iterator_traits<InputIt>::value_type>
+    Future<WhenAnyResult<Vector<F>>> WhenAny(InputIt first, InputIt last)
+    {
+        using Traits = internal::FutureTraits<F>;
+        using State = internal::WhenAnyState<Vector<F>>;
+
+        Vector<F> inputs(std::make_move_iterator(first), std::make_move_iterator(last));
+        std::size_t const count = inputs.size();
+        if (count == 0U)
+        {
+            Promise<WhenAnyResult<Vector<F>>> promise;
+            promise.set_value(WhenAnyResult<Vector<F>>{State::kNone, Vector<F>()});
+            return promise.get_future();
+        }
+
+        Vector<typename Traits::PromiseType> promises(count);
+        Vector<F> futures;
+        futures.reserve(count);
+        for (auto &promise : promises)
+        {
+            futures.push_back(promise.get_future());
+        }
+
+        auto *const state = new State(std::move(futures), count);
+        Future<WhenAnyResult<Vector<F>>> result = state->GetFuture();
+        for (std::size_t i = 0U; i < count; ++i)
+        {
+            internal::FutureBase<typename Traits::ValueType, typename Traits::ErrorType>::Forward(
+                std::move(inputs[i]), std::move(promises[i]), internal::WhenAnyNotification<Vector<F>>(*state, i));
+        }
+        state->Arrive(State::kNone);
+        return result;
+    }
+} // namespace core
+} // namespace ara
@@ -13,6 +13,9 @@
 #pragma once
 
 #include <cstdint>
+#include "error_code.h"
+#include "error_domain.h"
+#include "exception.h"
 
 namespace ara
 {
@@ -27,7 +30,7 @@ namespace ara
          */
         enum class future_errc : int32_t
         {
-            broken_promis = 101,            /*< the asynchronous task abandoned its shared state */
+            broken_promise = 101,           /*< the asynchronous task abandoned its shared state */
             future_already_retrieved = 102, /*< the contents of the shared state were already
                                                 accessed */
             promise_already_satisfied = 103,/*< attempt to store a value into the shared state twice */
@@ -42,15 +45,49 @@ namespace ara
          */
         class FutureException : public Exception
         {
+        public:
             // SWS_CORE_00412
             /**
              * \brief Construct a new FutureException from an ErrorCode.
              * 
              * \param[in] err   the ErrorCode
              */
-            explicit FutureException(ErrorCode err) noexcept;
+            explicit FutureException(ErrorCode err) noexcept : Exception(err)
+            {
+            }
         };
 
+        namespace internal
+        {
+            /**
+             * \brief Holder of the static name and messages of FutureErrorDomain, a template so that the header can
+             * define them.
+             *
+             */
+            template <typename = void>
+            struct FutureErrorMessages
+            {
+                using Errc = future_errc;
+
+                static constexpr ErrorMessage kMessages[] = {
+                    {static_cast<std::int32_t>(Errc::broken_promise), "broken promise"},
+                    {static_cast<std::int32_t>(Errc::future_already_retrieved), "future already retrieved"},
+                    {static_cast<std::int32_t>(Errc::promise_already_satisfied), "promise already satisfied"},
+                    {static_cast<std::int32_t>(Errc::no_state), "no state"},
+                };
+
+                static constexpr ErrorMessageTable kTable{0x8000000000000013ULL, "Future", kMessages,
+                                                          sizeof(kMessages) / sizeof(kMessages[0]),
+                                                          "unknown future error"};
+            };
+
+            template <typename Dummy>
+            constexpr ErrorMessage FutureErrorMessages<Dummy>::kMessages[];
+
+            template <typename Dummy>
+            constexpr ErrorMessageTable FutureErrorMessages<Dummy>::kTable;
+        } // namespace internal
+
         // SWS_CORE_00421
         /**
          * \brief Error domain for errors originating from classes Future and Promise. .
@@ -59,6 +96,7 @@ namespace ara
          */
         class FutureErrorDomain final : public ErrorDomain
         {
+        public:
             // SWS_CORE_00431
             /**
              * \brief Alias for the error code value enumeration.
@@ -78,7 +116,9 @@ namespace ara
              * \brief Default constructor.
              * 
              */
-            constexpr FutureErrorDomain() noexcept;
+            constexpr FutureErrorDomain() noexcept : ErrorDomain(internal::FutureErrorMessages<>::kTable)
+            {
+            }
 
             // SWS_CORE_00442
             /**
@@ -86,7 +126,10 @@ namespace ara
              * 
              * \return char const*  "Future"
              */
-            char const* Name() const noexcept override;
+            char const* Name() const noexcept override
+            {
+                return internal::FutureErrorMessages<>::kTable.name;
+            }
 
             // SWS_CORE_00443
             /**
@@ -95,7 +138,10 @@ namespace ara
              * \param[in] errorCode     the error code value
              * \return char const*      the text message, never nullptr
              */
-            char const* Message(FutureErrorDomain::CodeType errorCode) const noexcept;
+            char const* Message(FutureErrorDomain::CodeType errorCode) const noexcept override
+            {
+                return internal::FutureErrorMessages<>::kTable.Message(errorCode);
+            }
 
             // SWS_CORE_00444
             /**
@@ -103,16 +149,38 @@ namespace ara
              * 
              * \param[in] errorCode     the ErrorCode instance
              */
-            void ThrowAsException(ErrorCode const &errorCode) const noexcept(false) override;
+            void ThrowAsException(ErrorCode const &errorCode) const noexcept(false) override
+            {
+                internal::ThrowOrAbort<FutureException>(errorCode);
+            }
         };
 
+        namespace internal
+        {
+            /**
+             * \brief Holder of the global FutureErrorDomain, a template so that the header can define it.
+             *
+             */
+            template <typename = void>
+            struct FutureErrorDomainInstance
+            {
+                static constexpr FutureErrorDomain kDomain{};
+            };
+
+            template <typename Dummy>
+            constexpr FutureErrorDomain FutureErrorDomainInstance<Dummy>::kDomain;
+        } // namespace internal
+
         // SWS_CORE_00480
         /**
          * \brief Obtain the reference to the single global FutureErrorDomain instance.
          * 
          * \return ErrorDomain const&     reference to the FutureErrorDomain instance
          */
-        constexpr ErrorDomain const& GetFutureErrorDomain() noexcept;
+        constexpr ErrorDomain const& GetFutureErrorDomain() noexcept
+        {
+            return internal::FutureErrorDomainInstance<>::kDomain;
+        }
 
         // SWS_CORE_00490
         /**
@@ -123,6 +191,9 @@ namespace ara
          * 
          * \return ErrorCode  the new ErrorCode instance
          */
-        constexpr ErrorCode MakeErrorCode(future_errc code, ErrorDomain::SupportDataType data) noexcept;
+        constexpr ErrorCode MakeErrorCode(future_errc code, ErrorDomain::SupportDataType data) noexcept
+        {
+            return ErrorCode(static_cast<ErrorDomain::CodeType>(code), GetFutureErrorDomain(), data);
+        }
     } // namespace core
 } // namespace ara
@@ -12,12 +12,190 @@
 
 #pragma once
 
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include "core_error_domain.h"
+#include "error_code.h"
+#include "instance_specifier_table.h"
+#include "result.h"
 #include "string_view.h"
 
+/**
+ * \brief consteval where available, so that InstanceSpecifierLiteral is always evaluated by the compiler.
+ *
+ */
+#if defined(__cpp_consteval)
+#define ARA_CORE_CONSTEVAL consteval
+#else
+#define ARA_CORE_CONSTEVAL constexpr
+#endif
+
+/**
+ * \brief Create an ara::core::InstanceSpecifierLiteral from a string literal, sized by its length and its
+ * number of shortnames.
+ *
+ */
+#define ARA_CORE_INSTANCE_SPECIFIER_LITERAL(path) \
+    ::ara::core::InstanceSpecifierLiteral<sizeof(path), ::ara::core::internal::CountShortnames(path)>(path)
+
 namespace ara
 {
     namespace core
     {
+        namespace internal
+        {
+            /**
+             * \brief Check the syntax of a shortname path: shortnames separated by '/', each starting with a
+             * letter followed by letters, digits and '_', of at most 128 characters.
+             *
+             * \param[in] path      the path
+             * \return ErrorDomain::CodeType    0 if path is valid, the CoreErrc value otherwise
+             */
+            constexpr ErrorDomain::CodeType CheckShortnamePath(StringView path) noexcept
+            {
+                constexpr std::size_t kMaxShortnameLength = 128U;
+
+                if (path.empty())
+                {
+                    return static_cast<ErrorDomain::CodeType>(CoreErrc::kInvalidMetaModelPath);
+                }
+                std::size_t length = 0U;
+                for (char const c : path)
+                {
+                    bool const letter = ((c >= 'a') && (c <= 'z')) || ((c >= 'A') && (c <= 'Z'));
+                    bool const digit = (c >= '0') && (c <= '9');
+                    if (c == '/')
+                    {
+                        if (length == 0U)
+                        {
+                            return static_cast<ErrorDomain::CodeType>(CoreErrc::kInvalidMetaModelPath);
+                        }
+                        length = 0U;
+                    }
+                    else if ((letter || ((length != 0U) && (digit || (c == '_')))) && (length < kMaxShortnameLength))
+                    {
+                        ++length;
+                    }
+                    else
+                    {
+                        return static_cast<ErrorDomain::CodeType>(CoreErrc::kInvalidMetaModelShortname);
+                    }
+                }
+                return (length == 0U) ? static_cast<ErrorDomain::CodeType>(CoreErrc::kInvalidMetaModelPath) : 0;
+            }
+
+            /**
+             * \brief Not constexpr on purpose: reaching it while evaluating an InstanceSpecifierLiteral at compile
+             * time turns an invalid path into a compile error naming this function. An InstanceSpecifierLiteral
+             * evaluated at run time, which only C++14/17 allow, terminates instead.
+             *
+             */
+            [[noreturn]] inline void InvalidInstanceSpecifierLiteral() noexcept
+            {
+                std::terminate();
+            }
+
+            /**
+             * \brief Count the shortnames of a path, i.e. its separators plus one.
+             *
+             * \param[in] path      a string literal
+             * \return std::size_t  the number of shortnames
+             */
+            template <std::size_t N>
+            constexpr std::size_t CountShortnames(char const (&path)[N]) noexcept
+            {
+                std::size_t count = 1U;
+                for (std::size_t i = 0U; i < N - 1U; ++i)
+                {
+                    count += (path[i] == '/') ? 1U : 0U;
+                }
+                return count;
+            }
+        } // namespace internal
+
+        /**
+         * \brief A shortname path that is validated, hashed and split into its shortnames at compile time.
+         *
+         * An InstanceSpecifier constructed from it skips all parsing and hashing and just looks the path up in
+         * the table of interned paths. With C++20 the constructor is consteval, so any InstanceSpecifierLiteral
+         * is checked by the compiler; before, the check happens at compile time when the literal is declared
+         * constexpr. Use ARA_CORE_INSTANCE_SPECIFIER_LITERAL to fill in the template arguments, e.g.
+         *
+         *     constexpr auto kStorage = ARA_CORE_INSTANCE_SPECIFIER_LITERAL("Executable/Swc/Storage");
+         *
+         * \tparam N            the size of the string literal, including its terminator
+         * \tparam Components   the number of shortnames, see internal::CountShortnames()
+         */
+        template <std::size_t N, std::size_t Components>
+        class InstanceSpecifierLiteral final
+        {
+            static_assert(N > 1U, "an InstanceSpecifier path must not be empty");
+            static_assert((Components > 0U) && (Components <= (N / 2U)), "a path of N - 1 characters has at most N / 2 shortnames");
+
+        public:
+            /**
+             * \brief Validate and analyze path.
+             *
+             * \param[in] path  a string literal
+             */
+            ARA_CORE_CONSTEVAL explicit InstanceSpecifierLiteral(char const (&path)[N]) noexcept
+                : data_(path), hash_(internal::HashChars(path, N - 1U)), offsets_{}
+            {
+                if ((internal::CheckShortnamePath(StringView(path, N - 1U)) != 0)
+                    || (internal::CountShortnames(path) != Components))
+                {
+                    internal::InvalidInstanceSpecifierLiteral();
+                }
+                std::size_t count = 1U;
+                for (std::size_t i = 0U; i < N - 1U; ++i)
+                {
+                    if (path[i] == '/')
+                    {
+                        offsets_[count] = i + 1U;
+                        ++count;
+                    }
+                }
+            }
+
+            constexpr StringView ToString() const noexcept
+            {
+                return StringView(data_, N - 1U);
+            }
+
+            constexpr std::size_t Hash() const noexcept
+            {
+                return hash_;
+            }
+
+            /**
+             * \brief Return the number of shortnames in the path.
+             *
+             * \return std::size_t  the number of shortnames
+             */
+            constexpr std::size_t ComponentCount() const noexcept
+            {
+                return Components;
+            }
+
+            /**
+             * \brief Return one shortname of the path.
+             *
+             * \param[in] index     the position of the shortname, less than ComponentCount()
+             * \return StringView   the shortname
+             */
+            constexpr StringView Component(std::size_t index) const noexcept
+            {
+                return StringView(data_ + offsets_[index],
+                                  ((index + 1U < Components) ? (offsets_[index + 1U] - 1U) : (N - 1U)) - offsets_[index]);
+            }
+
+        private:
+            char const *data_;
+            std::size_t hash_;
+            std::size_t offsets_[Components];  /*< start of each shortname */
+        };
+
         // SWS_CORE_08001
         /**
          * \brief class representing an AUTOSAR Instance Specifier, which is basically an AUTOSAR
@@ -26,6 +204,7 @@ namespace ara
          */
         class InstanceSpecifier final
         {
+        public:
             // SWS_CORE_08021
             /**
              * \brief throwing ctor from meta-model string
@@ -38,14 +217,29 @@ namespace ara
              * \exceptions CoreException    in case the given metaModelIdentifier is not a valid
              *                              meta-model identifier/short name path.
              */
-            explicit InstanceSpecifier(StringView metaModelIdentifier);
+            explicit InstanceSpecifier(StringView metaModelIdentifier)
+                : entry_(Intern(metaModelIdentifier, internal::CheckShortnamePath(metaModelIdentifier)))
+            {
+            }
+
+            /**
+             * \brief Construct from a path validated and hashed at compile time. Does not throw for invalid
+             * paths, as there are none.
+             *
+             * \param[in] literal   the path
+             */
+            template <std::size_t N, std::size_t Components>
+            InstanceSpecifier(InstanceSpecifierLiteral<N, Components> const &literal)
+                : entry_(internal::InstanceSpecifierTable::Instance().Intern(literal.ToString(), literal.Hash()))
+            {
+            }
 
             // SWS_CORE_08029
             /**
              * \brief Destructor
              * 
              */
-            ~InstanceSpecifier() noexcept;
+            ~InstanceSpecifier() noexcept = default;
 
             // SWS_CORE_08032
             /**
@@ -60,7 +254,15 @@ namespace ara
              *         CoreErrc::kInvalidMetaModelPath      if the metaModelIdentifier is not a valid path to a
              *                                              model element
              */
-            static Result<InstanceSpecifier> Create(StringView metaModelIdentifier);
+            static Result<InstanceSpecifier> Create(StringView metaModelIdentifier)
+            {
+                ErrorDomain::CodeType const error = internal::CheckShortnamePath(metaModelIdentifier);
+                if (error != 0)
+                {
+                    return Result<InstanceSpecifier>::FromError(static_cast<CoreErrc>(error));
+                }
+                return Result<InstanceSpecifier>::FromValue(InstanceSpecifier(Intern(metaModelIdentifier, 0)));
+            }
 
             // SWS_CORE_08042
             /**
@@ -71,7 +273,10 @@ namespace ara
              *                      exactly the same model element
              * \return false        else
              */
-            bool operator==(InstanceSpecifier const &other) const noexcept;
+            bool operator==(InstanceSpecifier const &other) const noexcept
+            {
+                return entry_ == other.entry_;
+            }
 
             // SWS_CORE_08043
             /**
@@ -82,7 +287,10 @@ namespace ara
              *                      exactly the same model element as other
              * \return false        else
              */
-            bool operator==(StringView other) const noexcept;
+            bool operator==(StringView other) const noexcept
+            {
+                return ToString() == other;
+            }
 
             // SWS_CORE_08044
             /**
@@ -93,7 +301,10 @@ namespace ara
              * \return false        false in case both InstanceSpecifiers are denoting
              *                      exactly the same model element
              */
-            bool operator!=(InstanceSpecifier const &other) const noexcept;
+            bool operator!=(InstanceSpecifier const &other) const noexcept
+            {
+                return entry_ != other.entry_;
+            }
 
             // SWS_CORE_08045
             /**
@@ -104,7 +315,10 @@ namespace ara
              * \return false        in case this InstanceSpecifiers is denoting
              *                      exactly the same model element as other
              */
-            bool operator!=(StringView other) const noexcept;
+            bool operator!=(StringView other) const noexcept
+            {
+                return ToString() != other;
+            }
 
             // SWS_CORE_08046
             /**
@@ -116,7 +330,10 @@ namespace ara
              *                      than other
              * \return false        else
              */
-            bool operator<(InstanceSpecifier const &other) const noexcept;
+            bool operator<(InstanceSpecifier const &other) const noexcept
+            {
+                return (entry_ != other.entry_) && (ToString() < other.ToString());
+            }
 
             // SWS_CORE_08041
             /**
@@ -125,12 +342,58 @@ namespace ara
              * \return StringView   stringified form of InstanceSpecifier. Lifetime of the
              *                      underlying string is only guaranteed for the lifetime
              *                      of the underlying string of the StringView passed to
-             *                      the constructor.
+             *                      the constructor. This implementation interns the string,
+             *                      so it lives as long as the process.
+             */
+            StringView ToString() const noexcept
+            {
+                return StringView(entry_->data, entry_->size);
+            }
+
+            /**
+             * \brief Return the hash of the stringified form, computed once when it was interned.
+             *
+             * \return std::size_t  the hash
              */
-            StringView ToString() const noexcept;
+            std::size_t Hash() const noexcept
+            {
+                return entry_->hash;
+            }
+
+        private:
+            explicit InstanceSpecifier(internal::InternedString const *entry) noexcept : entry_(entry)
+            {
+            }
 
-            // 
+            // Interns a path that passed CheckShortnamePath(), or throws the error it found.
+            static internal::InternedString const* Intern(StringView path, ErrorDomain::CodeType error)
+            {
+                if (error != 0)
+                {
+                    ErrorCode(static_cast<CoreErrc>(error)).ThrowAsException();
+                }
+                return internal::InstanceSpecifierTable::Instance().Intern(
+                    path, internal::HashChars(path.data(), path.size()));
+            }
+
+            internal::InternedString const *entry_;  /*< the interned path, shared by all equal specifiers */
         };
     } // namespace core
     
 } // namespace ara
+
+namespace std
+{
+    /**
+     * \brief Hash of an InstanceSpecifier, precomputed when its path was interned.
+     *
+     */
+    template <>
+    struct hash<ara::core::InstanceSpecifier>
+    {
+        std::size_t operator()(ara::core::InstanceSpecifier const &specifier) const noexcept
+        {
+            return specifier.Hash();
+        }
+    };
+} // namespace std
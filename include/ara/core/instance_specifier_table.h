@@ -0,0 +1,196 @@
+/**
+ * \file instance_specifier_table.h
+ * \author Vincent WANG (vin@misday.com)
+ * \brief Process-wide symbol table that InstanceSpecifier paths are interned into.
+ * \version 0.1
+ * \date 2021-11-12
+ *
+ * \copyright Copyright (c) 2021
+ *
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstring>
+#include <mutex>
+#include <vector>
+#include "string_view.h"
+
+namespace ara
+{
+namespace core
+{
+    namespace internal
+    {
+        /**
+         * \brief An interned shortname path. There is exactly one per distinct path, and it lives as long as
+         * the process, so two paths are equal if and only if their InternedString pointers are.
+         *
+         */
+        struct InternedString
+        {
+            std::size_t hash;   /*< HashChars() of the characters */
+            std::size_t size;   /*< number of characters */
+            char const *data;   /*< the characters, NUL-terminated */
+        };
+
+        /**
+         * \brief The table that InstanceSpecifier paths are interned into.
+         *
+         * An open-addressing hash table of pointers to InternedStrings. Finding a path that is already
+         * interned never takes a lock: readers load the current slot array and its slots with acquire
+         * semantics, and slots are only ever filled, never changed. Inserting takes a mutex. When the table
+         * grows, the old slot array stays around for readers still probing it; it holds a subset of the
+         * entries, and a miss there is resolved under the lock.
+         *
+         * Freeze(), called by ara::core::Initialize(), rehashes the table at low load once start-up has
+         * interned the specifiers of the process, so that later lookups typically probe a single slot.
+         * Paths seen for the first time after that are still interned, under the lock.
+         *
+         */
+        class InstanceSpecifierTable final
+        {
+        public:
+            /**
+             * \brief The table of the process. It is never destroyed, so specifiers remain valid during
+             * static destruction.
+             *
+             * \return InstanceSpecifierTable&  the table
+             */
+            static InstanceSpecifierTable& Instance()
+            {
+                static InstanceSpecifierTable *const table = new InstanceSpecifierTable();
+                return *table;
+            }
+
+            /**
+             * \brief Get the InternedString of path, inserting it if it is new.
+             *
+             * \param[in] path          the path
+             * \param[in] hash          HashChars() of path
+             * \return InternedString const*    the interned path
+             */
+            InternedString const* Intern(StringView path, std::size_t hash)
+            {
+                InternedString const *entry = Find(*slots_.load(std::memory_order_acquire), path, hash);
+                if (entry == nullptr)
+                {
+                    std::lock_guard<std::mutex> lock(mutex_);
+                    entry = Find(*slots_.load(std::memory_order_relaxed), path, hash);
+                    if (entry == nullptr)
+                    {
+                        entry = Insert(path, hash);
+                    }
+                }
+                return entry;
+            }
+
+            /**
+             * \brief Rehash the table for lookups after start-up.
+             *
+             */
+            void Freeze()
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                std::size_t capacity = kInitialCapacity;
+                while (capacity < count_ * kFrozenLoadFactor)
+                {
+                    capacity *= 2U;
+                }
+                if (capacity > slots_.load(std::memory_order_relaxed)->mask + 1U)
+                {
+                    Rehash(capacity);
+                }
+            }
+
+        private:
+            static constexpr std::size_t kInitialCapacity = 256U;
+            static constexpr std::size_t kFrozenLoadFactor = 4U;   /*< capacity per entry after Freeze() */
+
+            struct Slots
+            {
+                explicit Slots(std::size_t capacity)
+                    : mask(capacity - 1U), entries(new std::atomic<InternedString const *>[capacity])
+                {
+                    for (std::size_t i = 0U; i < capacity; ++i)
+                    {
+                        entries[i].store(nullptr, std::memory_order_relaxed);
+                    }
+                }
+
+                std::size_t const mask;
+                std::atomic<InternedString const *> *const entries;
+            };
+
+            InstanceSpecifierTable() : slots_(nullptr), count_(0U)
+            {
+                all_.push_back(new Slots(kInitialCapacity));
+                slots_.store(all_.back(), std::memory_order_release);
+            }
+
+            static InternedString const* Find(Slots const &slots, StringView path, std::size_t hash) noexcept
+            {
+                for (std::size_t i = hash & slots.mask;; i = (i + 1U) & slots.mask)
+                {
+                    InternedString const *const entry = slots.entries[i].load(std::memory_order_acquire);
+                    if ((entry == nullptr) ||
+                        ((entry->hash == hash) && (StringView(entry->data, entry->size) == path)))
+                    {
+                        return entry;
+                    }
+                }
+            }
+
+            static void Place(Slots &slots, InternedString const *entry) noexcept
+            {
+                std::size_t i = entry->hash & slots.mask;
+                while (slots.entries[i].load(std::memory_order_relaxed) != nullptr)
+                {
+                    i = (i + 1U) & slots.mask;
+                }
+                slots.entries[i].store(entry, std::memory_order_release);
+            }
+
+            // Under the lock. Keeps the load at most one half.
+            InternedString const* Insert(StringView path, std::size_t hash)
+            {
+                Slots *slots = slots_.load(std::memory_order_relaxed);
+                if ((count_ + 1U) * 2U > slots->mask + 1U)
+                {
+                    Rehash((slots->mask + 1U) * 2U);
+                    slots = slots_.load(std::memory_order_relaxed);
+                }
+
+                char *const data = new char[path.size() + 1U];
+                std::memcpy(data, path.data(), path.size());
+                data[path.size()] = '\0';
+                InternedString const *const entry = new InternedString{hash, path.size(), data};
+                entries_.push_back(entry);
+                Place(*slots, entry);
+                ++count_;
+                return entry;
+            }
+
+            // Under the lock. Publishes a new slot array holding all entries.
+            void Rehash(std::size_t capacity)
+            {
+                Slots *const slots = new Slots(capacity);
+                for (InternedString const *entry : entries_)
+                {
+                    Place(*slots, entry);
+                }
+                all_.push_back(slots);
+                slots_.store(slots, std::memory_order_release);
+            }
+
+            std::atomic<Slots *> slots_;
+            std::mutex mutex_;
+            std::size_t count_;
+            std::vector<InternedString const *> entries_;
+            std::vector<Slots *> all_;  /*< current and superseded slot arrays */
+        };
+    } // namespace internal
+} // namespace core
+} // namespace ara
@@ -0,0 +1,505 @@
+/**
+ * \file memory_resource.h
+ * \author Vincent WANG (vin@misday.com)
+ * \brief Polymorphic memory resources backing the allocator-aware ara::core containers.
+ * \version 0.1
+ * \date 2021-11-12
+ *
+ * \copyright Copyright (c) 2021
+ *
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <mutex>
+#include <new>
+#include "abort.h"
+
+namespace ara
+{
+namespace core
+{
+    /**
+     * \brief Interface of a source of memory, modelled after std::pmr::memory_resource.
+     *
+     */
+    class MemoryResource
+    {
+    public:
+        virtual ~MemoryResource() = default;
+
+        /**
+         * \brief Allocate memory.
+         *
+         * \param[in] bytes         the size of the memory
+         * \param[in] alignment     the alignment of the memory
+         * \return void*            the memory, never nullptr
+         * \throws std::bad_alloc   if the request cannot be served
+         */
+        void* allocate(std::size_t bytes, std::size_t alignment = alignof(std::max_align_t))
+        {
+            return do_allocate(bytes, alignment);
+        }
+
+        /**
+         * \brief Return memory obtained by allocate() with the same size and alignment.
+         *
+         * \param[in] p             the memory
+         * \param[in] bytes         the size passed to allocate()
+         * \param[in] alignment     the alignment passed to allocate()
+         */
+        void deallocate(void *p, std::size_t bytes, std::size_t alignment = alignof(std::max_align_t)) noexcept
+        {
+            do_deallocate(p, bytes, alignment);
+        }
+
+        /**
+         * \brief Check whether memory allocated from one resource can be deallocated with the other.
+         *
+         * \param[in] other     the other resource
+         * \return true         if the resources are interchangeable
+         * \return false        otherwise
+         */
+        bool is_equal(MemoryResource const &other) const noexcept
+        {
+            return do_is_equal(other);
+        }
+
+    private:
+        virtual void* do_allocate(std::size_t bytes, std::size_t alignment) = 0;
+        virtual void do_deallocate(void *p, std::size_t bytes, std::size_t alignment) noexcept = 0;
+        virtual bool do_is_equal(MemoryResource const &other) const noexcept
+        {
+            return this == &other;
+        }
+    };
+
+    inline bool operator==(MemoryResource const &lhs, MemoryResource const &rhs) noexcept
+    {
+        return (&lhs == &rhs) || lhs.is_equal(rhs);
+    }
+
+    inline bool operator!=(MemoryResource const &lhs, MemoryResource const &rhs) noexcept
+    {
+        return !(lhs == rhs);
+    }
+
+    namespace internal
+    {
+        /**
+         * \brief Resource on the global operator new and delete, honouring extended alignments.
+         *
+         * Defined out of line, so that allocation and deallocation agree on one scheme for extended
+         * alignments even if translation units are compiled for different C++ versions.
+         */
+        class NewDeleteResource final : public MemoryResource
+        {
+        private:
+            void* do_allocate(std::size_t bytes, std::size_t alignment) override;
+
+            void do_deallocate(void *p, std::size_t bytes, std::size_t alignment) noexcept override;
+
+            bool do_is_equal(MemoryResource const &other) const noexcept override
+            {
+                return dynamic_cast<NewDeleteResource const *>(&other) != nullptr;
+            }
+        };
+
+        class NullResource final : public MemoryResource
+        {
+        private:
+            void* do_allocate(std::size_t, std::size_t) override
+            {
+                internal::ThrowOrAbort<std::bad_alloc>("NullMemoryResource::allocate");
+            }
+
+            void do_deallocate(void *, std::size_t, std::size_t) noexcept override
+            {
+            }
+        };
+
+        inline std::size_t AlignUp(std::uintptr_t value, std::size_t alignment) noexcept
+        {
+            return static_cast<std::size_t>((value + (alignment - 1U)) & ~static_cast<std::uintptr_t>(alignment - 1U));
+        }
+    } // namespace internal
+
+    /**
+     * \brief Return the resource that forwards to the global operator new and delete.
+     *
+     * \return MemoryResource*  the resource
+     */
+    inline MemoryResource* NewDeleteMemoryResource() noexcept
+    {
+        static internal::NewDeleteResource resource;
+        return &resource;
+    }
+
+    /**
+     * \brief Return the resource that fails every allocation with std::bad_alloc.
+     *
+     * \return MemoryResource*  the resource
+     */
+    inline MemoryResource* NullMemoryResource() noexcept
+    {
+        static internal::NullResource resource;
+        return &resource;
+    }
+
+    namespace internal
+    {
+        inline std::atomic<MemoryResource *>& DefaultMemoryResourceSlot() noexcept
+        {
+            static std::atomic<MemoryResource *> slot{NewDeleteMemoryResource()};
+            return slot;
+        }
+    } // namespace internal
+
+    /**
+     * \brief Return the resource used by default constructed PolymorphicAllocators.
+     *
+     * \return MemoryResource*  the resource, NewDeleteMemoryResource() unless changed
+     */
+    inline MemoryResource* GetDefaultMemoryResource() noexcept
+    {
+        return internal::DefaultMemoryResourceSlot().load(std::memory_order_acquire);
+    }
+
+    /**
+     * \brief Set the resource used by default constructed PolymorphicAllocators.
+     *
+     * Intended to be called once during startup, e.g. with a MonotonicBufferResource over a reserved
+     * region, before any container is created. Containers keep the resource they were created with.
+     *
+     * \param[in] resource      the new default resource, nullptr restores NewDeleteMemoryResource()
+     * \return MemoryResource*  the previous default resource
+     */
+    inline MemoryResource* SetDefaultMemoryResource(MemoryResource *resource) noexcept
+    {
+        return internal::DefaultMemoryResourceSlot().exchange((resource != nullptr) ? resource : NewDeleteMemoryResource(),
+                                                              std::memory_order_acq_rel);
+    }
+
+    /**
+     * \brief Arena that hands out memory by bumping a pointer and frees it all at once.
+     *
+     * deallocate() is a no-op, memory only returns with Release() or the destruction of the resource. When
+     * the initial buffer is exhausted, further chunks of growing size are taken from the upstream resource;
+     * with the default upstream NullMemoryResource() the arena never touches the heap.
+     *
+     * The resource is thread-safe.
+     */
+    class MonotonicBufferResource final : public MemoryResource
+    {
+    public:
+        /**
+         * \brief Construct an arena over a caller-provided buffer.
+         *
+         * \param[in] buffer    the initial buffer, it must outlive the resource
+         * \param[in] size      the size of the buffer
+         * \param[in] upstream  the source of further chunks
+         */
+        MonotonicBufferResource(void *buffer, std::size_t size, MemoryResource *upstream = NullMemoryResource()) noexcept
+            : upstream_(upstream), buffer_(static_cast<std::uint8_t *>(buffer)), bufferSize_(size),
+              current_(buffer_), remaining_(size), nextChunkSize_((size != 0U) ? (2U * size) : kMinChunkSize), chunks_(nullptr)
+        {
+        }
+
+        MonotonicBufferResource(MonotonicBufferResource const &) = delete;
+        MonotonicBufferResource& operator=(MonotonicBufferResource const &) = delete;
+
+        ~MonotonicBufferResource() override
+        {
+            Release();
+        }
+
+        /**
+         * \brief Free all memory handed out so far and return the upstream chunks.
+         *
+         * All objects allocated from the arena must have been destroyed.
+         */
+        void Release() noexcept
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            while (chunks_ != nullptr)
+            {
+                Chunk *next = chunks_->next;
+                upstream_->deallocate(chunks_, chunks_->size, alignof(Chunk));
+                chunks_ = next;
+            }
+            current_ = buffer_;
+            remaining_ = bufferSize_;
+            nextChunkSize_ = (bufferSize_ != 0U) ? (2U * bufferSize_) : kMinChunkSize;
+        }
+
+        /**
+         * \brief Return the upstream resource.
+         *
+         * \return MemoryResource*  the upstream resource
+         */
+        MemoryResource* UpstreamResource() const noexcept
+        {
+            return upstream_;
+        }
+
+    private:
+        struct Chunk
+        {
+            Chunk *next;
+            std::size_t size;
+        };
+
+        static constexpr std::size_t kMinChunkSize = 1024U;
+
+        void* do_allocate(std::size_t bytes, std::size_t alignment) override
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            void *p = Bump(bytes, alignment);
+            if (p == nullptr)
+            {
+                std::size_t size = sizeof(Chunk) + bytes + alignment;
+                size = (size < nextChunkSize_) ? nextChunkSize_ : size;
+                Chunk *chunk = static_cast<Chunk *>(upstream_->allocate(size, alignof(Chunk)));
+                chunk->next = chunks_;
+                chunk->size = size;
+                chunks_ = chunk;
+                nextChunkSize_ = (nextChunkSize_ <= (std::numeric_limits<std::size_t>::max() / 2U)) ? (2U * nextChunkSize_) : nextChunkSize_;
+                current_ = reinterpret_cast<std::uint8_t *>(chunk + 1);
+                remaining_ = size - sizeof(Chunk);
+                p = Bump(bytes, alignment);
+            }
+            return p;
+        }
+
+        void do_deallocate(void *, std::size_t, std::size_t) noexcept override
+        {
+        }
+
+        void* Bump(std::size_t bytes, std::size_t alignment) noexcept
+        {
+            std::uintptr_t const address = reinterpret_cast<std::uintptr_t>(current_);
+            std::size_t const padding = internal::AlignUp(address, alignment) - address;
+            if ((padding > remaining_) || (bytes > (remaining_ - padding)))
+            {
+                return nullptr;
+            }
+            void *p = current_ + padding;
+            current_ += padding + bytes;
+            remaining_ -= padding + bytes;
+            return p;
+        }
+
+        MemoryResource *const upstream_;
+        std::uint8_t *const buffer_;
+        std::size_t const bufferSize_;
+
+        std::mutex mutex_;
+        std::uint8_t *current_;
+        std::size_t remaining_;
+        std::size_t nextChunkSize_;
+        Chunk *chunks_;
+    };
+
+    /**
+     * \brief Pool of equally sized blocks carved out of a caller-provided buffer.
+     *
+     * Every request up to the block size takes one block from a free list and returns it on
+     * deallocate(), so memory is reused without fragmentation. Larger or over-aligned requests, and
+     * requests when the pool is empty, go to the upstream resource.
+     *
+     * The resource is thread-safe.
+     */
+    class FixedPoolResource final : public MemoryResource
+    {
+    public:
+        /**
+         * \brief Construct a pool over a caller-provided buffer.
+         *
+         * \param[in] buffer        the buffer, it must outlive the resource
+         * \param[in] size          the size of the buffer
+         * \param[in] blockSize     the size of one block, rounded up to alignof(std::max_align_t)
+         * \param[in] upstream      the resource serving the requests the pool cannot serve
+         */
+        FixedPoolResource(void *buffer, std::size_t size, std::size_t blockSize, MemoryResource *upstream = NullMemoryResource()) noexcept
+            : upstream_(upstream),
+              blockSize_(internal::AlignUp((blockSize < sizeof(Block)) ? sizeof(Block) : blockSize, kAlignment)),
+              begin_(static_cast<std::uint8_t *>(buffer)), end_(begin_ + size), free_(nullptr)
+        {
+            std::uintptr_t const address = reinterpret_cast<std::uintptr_t>(begin_);
+            std::uint8_t *block = begin_ + (internal::AlignUp(address, kAlignment) - address);
+            for (; (block <= end_) && (static_cast<std::size_t>(end_ - block) >= blockSize_); block += blockSize_)
+            {
+                Block *node = reinterpret_cast<Block *>(block);
+                node->next = free_;
+                free_ = node;
+            }
+        }
+
+        FixedPoolResource(FixedPoolResource const &) = delete;
+        FixedPoolResource& operator=(FixedPoolResource const &) = delete;
+
+        /**
+         * \brief Return the block size.
+         *
+         * \return std::size_t  the block size
+         */
+        std::size_t BlockSize() const noexcept
+        {
+            return blockSize_;
+        }
+
+    private:
+        struct Block
+        {
+            Block *next;
+        };
+
+        static constexpr std::size_t kAlignment = alignof(std::max_align_t);
+
+        void* do_allocate(std::size_t bytes, std::size_t alignment) override
+        {
+            if ((bytes <= blockSize_) && (alignment <= kAlignment))
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                if (free_ != nullptr)
+                {
+                    Block *block = free_;
+                    free_ = block->next;
+                    return block;
+                }
+            }
+            return upstream_->allocate(bytes, alignment);
+        }
+
+        void do_deallocate(void *p, std::size_t bytes, std::size_t alignment) noexcept override
+        {
+            std::uint8_t *const block = static_cast<std::uint8_t *>(p);
+            if ((block < begin_) || (block >= end_))
+            {
+                upstream_->deallocate(p, bytes, alignment);
+                return;
+            }
+
+            std::lock_guard<std::mutex> lock(mutex_);
+            Block *node = reinterpret_cast<Block *>(block);
+            node->next = free_;
+            free_ = node;
+        }
+
+        MemoryResource *const upstream_;
+        std::size_t const blockSize_;
+        std::uint8_t *const begin_;
+        std::uint8_t *const end_;
+
+        std::mutex mutex_;
+        Block *free_;
+    };
+
+    /**
+     * \brief Allocator that forwards to a MemoryResource, modelled after std::pmr::polymorphic_allocator.
+     *
+     * The resource is chosen when the allocator is constructed and is not propagated on container
+     * assignment. Copies of a container made with the copy constructor use the default resource.
+     *
+     * \tparam T    the type of the allocated objects
+     */
+    template <typename T>
+    class PolymorphicAllocator
+    {
+    public:
+        using value_type = T;
+
+        /**
+         * \brief Construct an allocator using GetDefaultMemoryResource().
+         *
+         */
+        PolymorphicAllocator() noexcept : resource_(GetDefaultMemoryResource())
+        {
+        }
+
+        /**
+         * \brief Construct an allocator using the given resource.
+         *
+         * \param[in] resource  the resource, must not be nullptr
+         */
+        PolymorphicAllocator(MemoryResource *resource) noexcept : resource_(resource)
+        {
+        }
+
+        PolymorphicAllocator(PolymorphicAllocator const &other) = default;
+
+        template <typename U>
+        PolymorphicAllocator(PolymorphicAllocator<U> const &other) noexcept : resource_(other.resource())
+        {
+        }
+
+        PolymorphicAllocator& operator=(PolymorphicAllocator const &) = delete;
+
+        /**
+         * \brief Allocate storage for n objects.
+         *
+         * \param[in] n     the number of objects
+         * \return T*       the storage
+         * \throws std::bad_alloc   if the request cannot be served
+         */
+        T* allocate(std::size_t n)
+        {
+            if (n > (std::numeric_limits<std::size_t>::max() / sizeof(T)))
+            {
+                internal::ThrowOrAbort<std::bad_alloc>("PolymorphicAllocator::allocate");
+            }
+            return static_cast<T *>(resource_->allocate(n * sizeof(T), alignof(T)));
+        }
+
+        /**
+         * \brief Return storage obtained by allocate(n).
+         *
+         * \param[in] p     the storage
+         * \param[in] n     the number of objects
+         */
+        void deallocate(T *p, std::size_t n) noexcept
+        {
+            resource_->deallocate(p, n * sizeof(T), alignof(T));
+        }
+
+        /**
+         * \brief Return the allocator for a copy of a container, which uses the default resource.
+         *
+         * \return PolymorphicAllocator     the allocator
+         */
+        PolymorphicAllocator select_on_container_copy_construction() const noexcept
+        {
+            return PolymorphicAllocator();
+        }
+
+        /**
+         * \brief Return the resource.
+         *
+         * \return MemoryResource*  the resource
+         */
+        MemoryResource* resource() const noexcept
+        {
+            return resource_;
+        }
+
+    private:
+        MemoryResource *resource_;
+    };
+
+    template <typename T, typename U>
+    inline bool operator==(PolymorphicAllocator<T> const &lhs, PolymorphicAllocator<U> const &rhs) noexcept
+    {
+        return *lhs.resource() == *rhs.resource();
+    }
+
+    template <typename T, typename U>
+    inline bool operator!=(PolymorphicAllocator<T> const &lhs, PolymorphicAllocator<U> const &rhs) noexcept
+    {
+        return !(lhs == rhs);
+    }
+}
+}
@@ -12,6 +12,9 @@
 
 #pragma once
 
+#include <utility>
+#include "future.h"
+
 namespace ara
 {
 namespace core
@@ -20,18 +23,21 @@ namespace core
     /**
      * \brief Specialization of class Promise for "void" values.
      * 
-     * \tparam E    the type of error
+     * \tparam E    the type of error, constructible from future_errc (checked at compile time)
      */
     template<typename E>
-    class Promise<void, E> final
+    class Promise<void, E> final : private internal::PromiseBase<void, E>
     {
+        using Base = internal::PromiseBase<void, E>;
+
+    public:
         // SWS_CORE_06341
         /**
          * \brief Default constructor.
          * This function shall behave the same as the corresponding std::promise function.
          * 
          */
-        Promise();
+        Promise() = default;
 
         // SWS_CORE_06342
         /**
@@ -40,7 +46,7 @@ namespace core
          * 
          * \param[in] other     the other instance
          */
-        Promise(Promise &&other) noexcept;
+        Promise(Promise &&other) noexcept = default;
 
         // SWS_CORE_06350
         /**
@@ -55,7 +61,7 @@ namespace core
          * This function shall behave the same as the corresponding std::promise function.
          * 
          */
-        ~Promise();
+        ~Promise() = default;
 
         // SWS_CORE_06343
         /**
@@ -65,7 +71,7 @@ namespace core
          * \param[in] other     the other instance
          * \return Promise&     *this
          */
-        Promise& operator=(Promise &&other) noexcept;
+        Promise& operator=(Promise &&other) noexcept = default;
 
         // SWS_CORE_06351
         /**
@@ -82,7 +88,10 @@ namespace core
          * 
          * \param[in] other     the other instance
          */
-        void swap(Promise &other) noexcept;
+        void swap(Promise &other) noexcept
+        {
+            Base::swap(other);
+        }
 
         // SWS_CORE_06344
         /**
@@ -93,14 +102,17 @@ namespace core
          * 
          * \return Future<void, E>  a Future
          */
-        Future<void, E> get_future();
+        using Base::get_future;
 
         // SWS_CORE_06345
         /**
          * \brief Make the shared state ready.
          * 
          */
-        void set_value();
+        void set_value()
+        {
+            this->Store(Result<void, E>());
+        }
 
         // SWS_CORE_06353
         /**
@@ -108,15 +120,13 @@ namespace core
          * 
          * \param[in] error     the error to store
          */
-        void SetError(E &&error);
-
         // SWS_CORE_06354
         /**
          * \brief Copy an error into the shared state and make the state ready.
          * 
          * \param[in] error     the error to store
          */
-        void SetError(E const &error);
+        using Base::SetError;
     };
 } // namespace core
 } // namespace ara
@@ -4,30 +4,267 @@
  * \brief
  * \version 0.1
  * \date 2020-12-04
- * 
+ *
  * \copyright Copyright (c) 2020
- * 
+ *
  */
 // R19-11
 
 #pragma once
 
+#include <new>
+#include <type_traits>
+#include <utility>
 #include "error_code.h"
 
+/**
+ * \brief Mark a function whose return value must not be ignored.
+ *
+ */
+#if (__cplusplus >= 201703L)
+#define ARA_CORE_NODISCARD [[nodiscard]]
+#elif defined(__GNUC__)
+#define ARA_CORE_NODISCARD __attribute__((warn_unused_result))
+#else
+#define ARA_CORE_NODISCARD
+#endif
+
 namespace ara
 {
     namespace core
     {
+        template <typename T, typename E>
+        class Result;
+
+        namespace internal
+        {
+            struct ValueTag {};
+            struct ErrorTag {};
+
+            /**
+             * \brief Stand-in value of Result<void, E>.
+             *
+             */
+            struct Empty
+            {
+            };
+
+            template <typename R>
+            struct IsResult : std::false_type
+            {
+            };
+
+            template <typename T, typename E>
+            struct IsResult<Result<T, E>> : std::true_type
+            {
+            };
+
+            /**
+             * \brief Storage of a Result: the value or the error in a union, followed by the discriminator.
+             *
+             * This is the variant for types that are not both trivially copyable. Switching between value and
+             * error copies the source first, so a throwing copy leaves *this unchanged.
+             */
+            template <typename T, typename E, bool = std::is_trivially_copyable<T>::value && std::is_trivially_copyable<E>::value>
+            struct ResultStorage
+            {
+                template <typename... Args>
+                explicit ResultStorage(ValueTag, Args &&... args) : value_(std::forward<Args>(args)...), hasValue_(true)
+                {
+                }
+
+                template <typename... Args>
+                explicit ResultStorage(ErrorTag, Args &&... args) : error_(std::forward<Args>(args)...), hasValue_(false)
+                {
+                }
+
+                ResultStorage(ResultStorage const &other) : hasValue_(other.hasValue_)
+                {
+                    if (hasValue_)
+                    {
+                        new (&value_) T(other.value_);
+                    }
+                    else
+                    {
+                        new (&error_) E(other.error_);
+                    }
+                }
+
+                ResultStorage(ResultStorage &&other) noexcept(
+                    std::is_nothrow_move_constructible<T>::value && std::is_nothrow_move_constructible<E>::value)
+                    : hasValue_(other.hasValue_)
+                {
+                    if (hasValue_)
+                    {
+                        new (&value_) T(std::move(other.value_));
+                    }
+                    else
+                    {
+                        new (&error_) E(std::move(other.error_));
+                    }
+                }
+
+                ResultStorage& operator=(ResultStorage const &other)
+                {
+                    if (this == &other)
+                    {
+                    }
+                    else if (hasValue_ && other.hasValue_)
+                    {
+                        value_ = other.value_;
+                    }
+                    else if (!hasValue_ && !other.hasValue_)
+                    {
+                        error_ = other.error_;
+                    }
+                    else
+                    {
+                        ResultStorage temp(other);
+                        Destroy();
+                        new (this) ResultStorage(std::move(temp));
+                    }
+                    return *this;
+                }
+
+                ResultStorage& operator=(ResultStorage &&other) noexcept(
+                    std::is_nothrow_move_constructible<T>::value && std::is_nothrow_move_assignable<T>::value
+                    && std::is_nothrow_move_constructible<E>::value && std::is_nothrow_move_assignable<E>::value)
+                {
+                    if (this == &other)
+                    {
+                    }
+                    else if (hasValue_ && other.hasValue_)
+                    {
+                        value_ = std::move(other.value_);
+                    }
+                    else if (!hasValue_ && !other.hasValue_)
+                    {
+                        error_ = std::move(other.error_);
+                    }
+                    else
+                    {
+                        Destroy();
+                        new (this) ResultStorage(std::move(other));
+                    }
+                    return *this;
+                }
+
+                ~ResultStorage()
+                {
+                    Destroy();
+                }
+
+                void Destroy() noexcept
+                {
+                    if (hasValue_)
+                    {
+                        value_.~T();
+                    }
+                    else
+                    {
+                        error_.~E();
+                    }
+                }
+
+                union
+                {
+                    T value_;
+                    E error_;
+                };
+                bool hasValue_;
+            };
+
+            /**
+             * \brief Storage of a Result whose value and error types are trivially copyable. All special members
+             * are trivial, so such a Result is copied like a plain struct and returned in registers where the ABI
+             * allows it.
+             *
+             */
+            template <typename T, typename E>
+            struct ResultStorage<T, E, true>
+            {
+                template <typename... Args>
+                constexpr explicit ResultStorage(ValueTag, Args &&... args) : value_(std::forward<Args>(args)...), hasValue_(true)
+                {
+                }
+
+                template <typename... Args>
+                constexpr explicit ResultStorage(ErrorTag, Args &&... args) : error_(std::forward<Args>(args)...), hasValue_(false)
+                {
+                }
+
+                void Destroy() noexcept
+                {
+                }
+
+                union
+                {
+                    T value_;
+                    E error_;
+                };
+                bool hasValue_;
+            };
+
+            /**
+             * \brief Wrap the outcome of f(args...) into a Result<U, E>, also for U = void.
+             *
+             */
+            template <typename U, typename E>
+            struct MapInvoker
+            {
+                template <typename F, typename... Args>
+                static Result<U, E> Invoke(F &&f, Args &&... args)
+                {
+                    return Result<U, E>(std::forward<F>(f)(std::forward<Args>(args)...));
+                }
+            };
+
+            template <typename E>
+            struct MapInvoker<void, E>
+            {
+                template <typename F, typename... Args>
+                static Result<void, E> Invoke(F &&f, Args &&... args)
+                {
+                    std::forward<F>(f)(std::forward<Args>(args)...);
+                    return Result<void, E>();
+                }
+            };
+
+            /**
+             * \brief Return type of Result::Bind() for a callable returning U.
+             *
+             */
+            template <typename U, typename E>
+            struct BindResult
+            {
+                using type = Result<U, E>;
+            };
+
+            template <typename U, typename E2, typename E>
+            struct BindResult<Result<U, E2>, E>
+            {
+                using type = Result<U, E2>;
+            };
+
+            template <typename F, typename... Args>
+            using InvokeResult = typename std::decay<decltype(std::declval<F>()(std::declval<Args>()...))>::type;
+        } // namespace internal
+
         // SWS_CORE_00701
         /**
          * \brief This class is a type that contains either a value or an error.
          *
+         * The value and the error share a union followed by a one-byte discriminator, so sizeof(Result) is
+         * max(sizeof(T), sizeof(E)) + 1, rounded up to the alignment. A Result is trivially copyable and
+         * trivially destructible when both T and E are trivially copyable.
+         *
          * \tparam T    the type of value
          * \tparam E    the type of error
          */
         template<typename T, typename E = ErrorCode>
         class Result final
         {
+        public:
             // SWS_CORE_00711
             /**
              * \brief Type alias for the type T of values .
@@ -46,7 +283,9 @@ namespace ara
              *
              * \param[in] t     the value to put into the Result
              */
-            Result(T const &t);
+            Result(T const &t) : storage_(internal::ValueTag(), t)
+            {
+            }
 
             // SWS_CORE_00722
             /**
@@ -54,7 +293,9 @@ namespace ara
              *
              * \param[in] t     the value to put into the Result
              */
-            Result(T const &&t);
+            Result(T &&t) : storage_(internal::ValueTag(), std::move(t))
+            {
+            }
 
             // SWS_CORE_00723
             /**
@@ -62,7 +303,9 @@ namespace ara
              *
              * \param[in] e     the error to put into the Result
              */
-            Result(E const &e);
+            explicit Result(E const &e) : storage_(internal::ErrorTag(), e)
+            {
+            }
 
             // SWS_CORE_00724
             /**
@@ -70,7 +313,9 @@ namespace ara
              *
              * \param[in] e     the error to put into the Result
              */
-            Result(E const &&e);
+            explicit Result(E &&e) : storage_(internal::ErrorTag(), std::move(e))
+            {
+            }
 
             // SWS_CORE_00725
             /**
@@ -78,15 +323,17 @@ namespace ara
              *
              * \param[in] other     the other instance
              */
-            Result(Result const &other);
+            Result(Result const &other) = default;
 
             // SWS_CORE_00726
             /**
              * \brief Move-construct a new Result from another instance.
              *
+             * Noexcept if std::is_nothrow_move_constructible<T>::value && std::is_nothrow_move_constructible<E>::value.
+             *
              * \param[in] other     the other instance
              */
-            Result(Result const &&other) noexcept(std:is_nothrow_move_constructible<T>::value &&std::is_nothrow_move_constructible<E>::value);
+            Result(Result &&other) = default;
 
             // SWS_CORE_00727
             /**
@@ -96,7 +343,7 @@ namespace ara
              * destructible<E>::value is true.
              *
              */
-            ~Result();
+            ~Result() = default;
 
             // SWS_CORE_00731
             /**
@@ -106,7 +353,10 @@ namespace ara
              *
              * \return Result   a Result that contains the value t
              */
-            static Result FromValue(T const &t);
+            static Result FromValue(T const &t)
+            {
+                return Result(t);
+            }
 
             // SWS_CORE_00732
             /**
@@ -116,256 +366,330 @@ namespace ara
              *
              * \return Result   a Result that contains the value t
              */
-            static Result FromValue(T &&t);
+            static Result FromValue(T &&t)
+            {
+                return Result(std::move(t));
+            }
 
             // SWS_CORE_00733
             /**
              * \brief Build a new Result from a value that is constructed in-place from the given arguments.
-             * 
+             *
              * This function shall not participate in overload resolution unless: std::is_constructible<T,
              * Args&&...>::value is true, and the first type of the expanded parameter pack is not T, and the
              * first type of the expanded parameter pack is not a specialization of Result
-             * 
+             *
              * \tparam Args     the types of arguments given to this function
              * \param[in] args  the arguments used for constructing the value
-             * 
+             *
              * \return Result   a Result that contains a value
              */
-            template <typename... Args>
-            static Result FromValue(Args &&... args);
+            template <typename... Args, typename = typename std::enable_if<std::is_constructible<T, Args &&...>::value>::type>
+            static Result FromValue(Args &&... args)
+            {
+                return Result(internal::ValueTag(), std::forward<Args>(args)...);
+            }
 
             // SWS_CORE_00734
             /**
              * \brief Build a new Result from the specified error (given as lvalue).
-             * 
+             *
              * \param[in] e     the error to put into the Result
-             * 
+             *
              * \return Result   a Result that contains the error e
              */
-            static Result FromError(E const &e);
+            static Result FromError(E const &e)
+            {
+                return Result(e);
+            }
 
             // SWS_CORE_00735
             /**
              * \brief Build a new Result from the specified error (given as rvalue).
-             * 
+             *
              * \param[in] e     the error to put into the Result
-             * 
+             *
              * \return Result   a Result that contains the error e
              */
-            static Result FromError(E const &&e);
+            static Result FromError(E &&e)
+            {
+                return Result(std::move(e));
+            }
 
             // SWS_CORE_00736
             /**
              * \brief Build a new Result from an error that is constructed in-place from the given arguments.
-             * 
+             *
              * This function shall not participate in overload resolution unless: std::is_constructible<E,
              * Args&&...>::value is true, and the first type of the expanded parameter pack is not E, and the
              * first type of the expanded parameter pack is not a specialization of Result
-             * 
+             *
              * \tparam Args     the types of arguments given to this function
-             * 
+             *
              * \param[in] args  the arguments used for constructing the error
-             * 
+             *
              * \return Result   a Result that contains an error
              */
-            template <typename.. Args>
-            static Result FromError(Args &&... args);
+            template <typename... Args, typename = typename std::enable_if<std::is_constructible<E, Args &&...>::value>::type>
+            static Result FromError(Args &&... args)
+            {
+                return Result(internal::ErrorTag(), std::forward<Args>(args)...);
+            }
 
             // SWS_CORE_00741
             /**
              * \brief Copy-assign another Result to this instance.
-             * 
+             *
              * \param[in] other     the other instance
-             * 
+             *
              * \return Result&      *this, containing the contents of other
              */
-            Result& operator=(Result const &other);
+            Result& operator=(Result const &other) = default;
 
             // SWS_CORE_00742
             /**
              * \brief Move-assign another Result to this instance.
-             * 
+             *
+             * Noexcept if T and E are both nothrow move constructible and nothrow move assignable.
+             *
              * \param[in] other     the other instance
-             * 
+             *
              * \return Result&      *this, containing the contents of other
              */
-            Result& operator=(Result &&other) noexcept(
-                  std::is_nothrow_move_constructible<T>::value &&std::is_nothrow_move_assignable<T>::value 
-                &&std::is_nothrow_move_constructible<E>::value &&std::is_nothrow_move_assignable<E>::value);
+            Result& operator=(Result &&other) = default;
 
             // SWS_CORE_00743
             /**
              * \brief Put a new value into this instance, constructed in-place from the given arguments.
-             * 
+             *
              * \tparam Args     the types of arguments given to this function
-             * 
+             *
              * \param[in] args  the arguments used for constructing the value
-             * 
+             *
              * \return None
              */
             template <typename... Args>
-            void EmplaceValue(Args &&... args);
+            void EmplaceValue(Args &&... args)
+            {
+                storage_ = Storage(internal::ValueTag(), std::forward<Args>(args)...);
+            }
 
             // SWS_CORE_00744
             /**
              * \brief Put a new error into this instance, constructed in-place from the given arguments.
-             * 
+             *
              * \tparam Args     the types of arguments given to this function
-             * 
+             *
              * \param[in] args  the arguments used for constructing the error
              */
             template <typename... Args>
-            void EmplaceError(Args &&... args);
+            void EmplaceError(Args &&... args)
+            {
+                storage_ = Storage(internal::ErrorTag(), std::forward<Args>(args)...);
+            }
 
             // SWS_CORE_00745
             /**
              * \brief Exchange the contents of this instance with those of other.
-             * 
+             *
              * \param[in] other     the other instance
              */
             void Swap(Result &other) noexcept(
                   std::is_nothrow_move_constructible<T>::value &&std::is_nothrow_move_assignable<T>::value
                 &&std::is_nothrow_move_constructible<E>::value &&std::is_nothrow_move_assignable<E>::value
-            );
+            )
+            {
+                using std::swap;
+                if (HasValue() && other.HasValue())
+                {
+                    swap(storage_.value_, other.storage_.value_);
+                }
+                else if (!HasValue() && !other.HasValue())
+                {
+                    swap(storage_.error_, other.storage_.error_);
+                }
+                else
+                {
+                    Result temp(std::move(other));
+                    other = std::move(*this);
+                    *this = std::move(temp);
+                }
+            }
 
             // SWS_CORE_00751
             /**
              * \brief Check whether *this contains a value.
-             * 
+             *
              * \return true     if *this contains a value
              * \return false    otherwise
              */
-            bool hasValue() const noexcept;
+            bool HasValue() const noexcept
+            {
+                return storage_.hasValue_;
+            }
 
             // SWS_CORE_00752
             /**
              * \brief Check whether *this contains a value.
-             * 
+             *
              * \return true     if *this contains a value
              * \return false    otherwise
              */
-            explicit operator bool() const noexcept;
+            explicit operator bool() const noexcept
+            {
+                return storage_.hasValue_;
+            }
 
             // SWS_CORE_00753
             /**
              * \brief Access the contained value.
-             * 
+             *
              * This function’s behavior is undefined if *this does not contain a value.
-             * 
+             *
              * \return T const&     a const_reference to the contained value
              */
-            T const& operator*() const &;
+            T const& operator*() const &
+            {
+                return storage_.value_;
+            }
 
             // SWS_CORE_00759
             /**
              * \brief Access the contained value.
-             * 
+             *
              * This function’s behavior is undefined if *this does not contain a value.
-             * 
+             *
              * \return T&&  an rvalue reference to the contained value
              */
-            T&& operator* () &&;
+            T&& operator* () &&
+            {
+                return std::move(storage_.value_);
+            }
 
             // SWS_CORE_00754
             /**
              * \brief Access the contained value.
-             * 
+             *
              * This function’s behavior is undefined if *this does not contain a value.
-             * 
+             *
              * \return T const*     a pointer to the contained value
              */
-            T const* operator->() const;
+            T const* operator->() const
+            {
+                return &storage_.value_;
+            }
 
             // SWS_CORE_00755
             /**
              * \brief Access the contained value.
-             * 
+             *
              * The behavior of this function is undefined if *this does not contain a value.
-             * 
+             *
              * \return T const&     a const reference to the contained value
              */
-            T const& Value() const &;
+            T const& Value() const &
+            {
+                return storage_.value_;
+            }
 
             // SWS_CORE_00756
             /**
              * \brief Access the contained value.
-             * 
+             *
              * The behavior of this function is undefined if *this does not contain a value.
-             * 
+             *
              * \return T&&  an rvalue reference to the contained value
              */
-            T&& Value() &&;
+            T&& Value() &&
+            {
+                return std::move(storage_.value_);
+            }
 
             // SWS_CORE_00757
             /**
              * \brief Access the contained error.
-             * 
+             *
              * The behavior of this function is undefined if *this does not contain an error.
-             * 
+             *
              * \return E const&     a const reference to the contained error
              */
-            E const& Error() const &;
+            E const& Error() const &
+            {
+                return storage_.error_;
+            }
 
             // SWS_CORE_00758
             /**
              * \brief Access the contained error.
-             * 
+             *
              * The behavior of this function is undefined if *this does not contain an error.
-             * 
+             *
              * \return E&&  an rvalue reference to the contained error
              */
-            E&& Error() const &&;
+            E&& Error() &&
+            {
+                return std::move(storage_.error_);
+            }
 
             // SWS_CORE_00761
             /**
-             * \brief eturn the contained value or the given default value.
-             * 
+             * \brief Return the contained value or the given default value.
+             *
              * If *this contains a value, it is returned. Otherwise, the specified default value is returned, static_
              * cast’d to T.
-             * 
+             *
              * \tparam U                the type of defaultValue
-             * 
+             *
              * \param[in] defaultValue  the value to use if *this does not contain a value
-             * 
+             *
              * \return T                the value
              */
             template <typename U>
-            T ValueOr(U &&defaultValue) const &;
+            T ValueOr(U &&defaultValue) const &
+            {
+                return HasValue() ? Value() : static_cast<T>(std::forward<U>(defaultValue));
+            }
 
             // SWS_CORE_00762
             /**
              * \brief Return the contained value or the given default value.
-             * 
+             *
              * If *this contains a value, it is returned. Otherwise, the specified default value is returned, static_
              * cast’d to T.
-             * 
+             *
              * \tparam U                the type of defaultValue
              * \param[in] defaultValue  the value to use if *this does not contain a value
              * \return T                the value
              */
             template<typename U>
-            T ValueOr(U &&defaultValue) &&;
+            T ValueOr(U &&defaultValue) &&
+            {
+                return HasValue() ? std::move(storage_.value_) : static_cast<T>(std::forward<U>(defaultValue));
+            }
 
             // SWS_CORE_00763
             /**
              * \brief Return the contained error or the given default error.
-             * 
+             *
              * If *this contains an error, it is returned. Otherwise, the specified default error is returned, static_
              * cast’d to E.
-             * 
+             *
              * \tparam G                the type of defaultError
              * \param[in] defaultValue  the error to use if *this does not contain an error
              * \return E                the error
              */
             template <typename G>
-            E ErrorOr(G &&defaultValue) const;
+            E ErrorOr(G &&defaultValue) const
+            {
+                return HasValue() ? static_cast<E>(std::forward<G>(defaultValue)) : Error();
+            }
 
             // SWS_CORE_00765
             /**
              * \brief Return whether this instance contains the given error.
-             * 
+             *
              * This call compares the argument error, static_cast’d to E, with the return value from Error().
-             * 
+             *
              * \tparam G        the type of the error argument error
              * \param[in] error the error to check
              * \return true     if *this contains an error that is equivalent to the
@@ -373,81 +697,202 @@ namespace ara
              * \return false    otherwise
              */
             template <typename G>
-            bool CheckError(G &&error) const;
+            bool CheckError(G &&error) const
+            {
+                return !HasValue() && (Error() == static_cast<E>(std::forward<G>(error)));
+            }
 
             // SWS_CORE_00766
             /**
              * \brief Return the contained value or throw an exception.
-             * 
-             * This function does not participate in overload resolution when the compiler toolchain does not
-             * support C++ exceptions.
-             * 
+             *
+             * In builds without exceptions (ARA_CORE_EXCEPTIONS == 0) it calls Abort() with the message of the
+             * error instead of throwing.
+             *
              * \return T const&     a const reference to the contained value
              */
-            T const& ValueOrThrow() const & noexcept(false);
+            T const& ValueOrThrow() const & noexcept(false)
+            {
+                if (!HasValue())
+                {
+                    Error().ThrowAsException();
+                }
+                return Value();
+            }
 
             // SWS_CORE_00769
             /**
              * \brief Return the contained value or throw an exception.
-             * 
-             * This function does not participate in overload resolution when the compiler toolchain does not
-             * support C++ exceptions.
-             * 
+             *
+             * In builds without exceptions (ARA_CORE_EXCEPTIONS == 0) it calls Abort() with the message of the
+             * error instead of throwing.
+             *
              * \return T&&  an rvalue reference to the contained value
-             * 
+             *
              * \exceptions <TYPE>   the exception type associated with the contained error
              */
-            T&& ValueOrThrow() && noexcept(false);
+            T&& ValueOrThrow() && noexcept(false)
+            {
+                if (!HasValue())
+                {
+                    Error().ThrowAsException();
+                }
+                return std::move(storage_.value_);
+            }
 
             // SWS_CORE_00767
             /**
              * \brief Return the contained value or return the result of a function call.
-             * 
+             *
              * If *this contains a value, it is returned. Otherwise, the specified callable is invoked and its return
              * value which is to be compatible to type T is returned from this function.
-             * 
+             *
              * The Callable is expected to be compatible to this interface: T f(E const&);
-             * 
+             *
              * \tparam F        the type of the Callable f
              * \param[in] f     the Callable
              * \return T        the value
              */
             template <typename F>
-            T Resolve(F &&f) const;
+            T Resolve(F &&f) const
+            {
+                return HasValue() ? Value() : static_cast<T>(std::forward<F>(f)(Error()));
+            }
 
             // SWS_CORE_00768
             /**
              * \brief Apply the given Callable to the value of this instance, and return a new Result with the result of
              * the call.
-             * 
+             *
              * The Callable is expected to be compatible to one of these two interfaces: Result<XXX, E> f(T
              * const&); XXX f(T const&); meaning that the Callable either returns a Result<XXX> or a XXX
              * directly, where XXX can be any type that is suitable for use by class Result.
-             * 
+             *
              * The return type of this function is decltype(f(Value())) for a template argument F that returns a
              * Result type, and it is Result<decltype(f(Value())), E> for a template argument F that does not
              * return a Result type.
-             * 
+             *
              * If this instance does not contain a value, a new Result<XXX, E> is still created and returned,
              * with the original error contents of this instance being copied into the new instance.
-             * 
+             *
              * \tparam F            the type of the Callable f
              * \param[in] f         the Callable
              * \return SEE_BELOW    a new Result instance of the possibly transformed type
              */
+            template <typename F, typename U = internal::InvokeResult<F, T const &>>
+            auto Bind(F &&f) const -> typename internal::BindResult<U, E>::type
+            {
+                return BindImpl(std::forward<F>(f), internal::IsResult<U>());
+            }
+
+            /**
+             * \brief Transform the value with a Callable, pass an error on unchanged.
+             *
+             * The Callable is expected to be compatible to this interface: U f(T const&); where U may be void.
+             *
+             * \tparam F            the type of the Callable f
+             * \param[in] f         the Callable
+             * \return Result<U, E> the result of f, or the error of this instance
+             */
+            template <typename F, typename U = internal::InvokeResult<F, T const &>>
+            ARA_CORE_NODISCARD Result<U, E> Map(F &&f) const &
+            {
+                return HasValue() ? internal::MapInvoker<U, E>::Invoke(std::forward<F>(f), Value()) : Result<U, E>(Error());
+            }
+
+            template <typename F, typename U = internal::InvokeResult<F, T &&>>
+            ARA_CORE_NODISCARD Result<U, E> Map(F &&f) &&
+            {
+                return HasValue() ? internal::MapInvoker<U, E>::Invoke(std::forward<F>(f), std::move(storage_.value_))
+                                  : Result<U, E>(std::move(storage_.error_));
+            }
+
+            /**
+             * \brief Chain an operation that can fail itself, pass an error on unchanged.
+             *
+             * The Callable is expected to be compatible to this interface: Result<U, E> f(T const&);
+             *
+             * \tparam F            the type of the Callable f
+             * \param[in] f         the Callable
+             * \return R            the Result returned by f, or the error of this instance
+             */
+            template <typename F, typename R = internal::InvokeResult<F, T const &>>
+            ARA_CORE_NODISCARD R AndThen(F &&f) const &
+            {
+                static_assert(internal::IsResult<R>::value, "the callable given to AndThen must return a Result");
+                return HasValue() ? std::forward<F>(f)(Value()) : R(Error());
+            }
+
+            template <typename F, typename R = internal::InvokeResult<F, T &&>>
+            ARA_CORE_NODISCARD R AndThen(F &&f) &&
+            {
+                static_assert(internal::IsResult<R>::value, "the callable given to AndThen must return a Result");
+                return HasValue() ? std::forward<F>(f)(std::move(storage_.value_)) : R(std::move(storage_.error_));
+            }
+
+            /**
+             * \brief Recover from an error, pass a value on unchanged.
+             *
+             * The Callable is expected to be compatible to this interface: Result<T, G> f(E const&);
+             *
+             * \tparam F            the type of the Callable f
+             * \param[in] f         the Callable
+             * \return R            the value of this instance, or the Result returned by f
+             */
+            template <typename F, typename R = internal::InvokeResult<F, E const &>>
+            ARA_CORE_NODISCARD R OrElse(F &&f) const &
+            {
+                static_assert(internal::IsResult<R>::value, "the callable given to OrElse must return a Result");
+                return HasValue() ? R(Value()) : std::forward<F>(f)(Error());
+            }
+
+            template <typename F, typename R = internal::InvokeResult<F, E &&>>
+            ARA_CORE_NODISCARD R OrElse(F &&f) &&
+            {
+                static_assert(internal::IsResult<R>::value, "the callable given to OrElse must return a Result");
+                return HasValue() ? R(std::move(storage_.value_)) : std::forward<F>(f)(std::move(storage_.error_));
+            }
+
+        private:
+            using Storage = internal::ResultStorage<T, E>;
+
+            template <typename... Args>
+            explicit Result(internal::ValueTag tag, Args &&... args) : storage_(tag, std::forward<Args>(args)...)
+            {
+            }
+
+            template <typename... Args>
+            explicit Result(internal::ErrorTag tag, Args &&... args) : storage_(tag, std::forward<Args>(args)...)
+            {
+            }
+
             template <typename F>
-            auto Bind(F &&f) const -> SEE_BELOW;
+            auto BindImpl(F &&f, std::true_type) const -> decltype(AndThen(std::forward<F>(f)))
+            {
+                return AndThen(std::forward<F>(f));
+            }
+
+            template <typename F>
+            auto BindImpl(F &&f, std::false_type) const -> decltype(Map(std::forward<F>(f)))
+            {
+                return Map(std::forward<F>(f));
+            }
+
+            Storage storage_;
         };
-    
+
         // SWS_CORE_00801
         /**
          * \brief Specialization of class Result for "void" values.
-         * 
+         *
+         * Only the error takes space; sizeof(Result<void, E>) is sizeof(E) + 1, rounded up to the alignment.
+         *
          * \tparam E    the type of error
          */
         template <typename E>
         class Result<void, E> final
         {
+        public:
             // SWS_CORE_00811
             /**
              * \brief Type alias for the type T of values, always "void" for this specialization .
@@ -463,158 +908,202 @@ namespace ara
             // SWS_CORE_00821
             /**
              * \brief Construct a new Result with a "void" value.
-             * 
+             *
              */
-            Result() noexcept;
+            Result() noexcept : storage_(internal::ValueTag())
+            {
+            }
 
             // SWS_CORE_00823
             /**
              * \brief Construct a new Result from the specified error (given as lvalue).
-             * 
+             *
              * \param[in] e     the error to put into the Result
              */
-            explicit Result(E const &e);
+            explicit Result(E const &e) : storage_(internal::ErrorTag(), e)
+            {
+            }
 
             // SWS_CORE_00824
             /**
              * \brief Construct a new Result from the specified error (given as rvalue).
-             * 
+             *
              * \param[in] e     the error to put into the Result
              */
-            explicit Result(E &&e);
+            explicit Result(E &&e) : storage_(internal::ErrorTag(), std::move(e))
+            {
+            }
 
             // SWS_CORE_00825
             /**
              * \brief Copy-construct a new Result from another instance.
-             * 
+             *
              * \param[in] other     the other instance
              */
-            Result(Result const &other);
+            Result(Result const &other) = default;
 
             // SWS_CORE_00826
             /**
              * \brief Move-construct a new Result from another instance.
-             * 
+             *
+             * Noexcept if std::is_nothrow_move_constructible<E>::value.
+             *
              * \param[in] other     the other instance
              */
-            Result(Result &&other) noexcept(std::is_nothrow_move_constructible<E>::value);
+            Result(Result &&other) = default;
 
             // SWS_CORE_00827
             /**
              * \brief Destructor.
-             * 
+             *
              * This destructor is trivial if std::is_trivially_destructible<E>::value is true.
              */
-            ~Result();
+            ~Result() = default;
 
             // SWS_CORE_00831
             /**
              * \brief Build a new Result with "void" as value.
-             * 
+             *
              * \return Result   a Result that contains a "void" value
              */
-            static Result FromValue();
+            static Result FromValue() noexcept
+            {
+                return Result();
+            }
 
             // SWS_CORE_00834
             /**
              * \brief Build a new Result from the specified error (given as lvalue).
-             * 
+             *
              * \param[in] e     the error to put into the Result
              * \return Result   a Result that contains the error e
              */
-            static Result FromError(E const &e);
+            static Result FromError(E const &e)
+            {
+                return Result(e);
+            }
 
             // SWS_CORE_00835
             /**
              * \brief Build a new Result from the specified error (given as rvalue).
-             * 
+             *
              * \param[in] e     the error to put into the Result
              * \return Result   a Result that contains the error e
              */
-            static Result FromError(E const &&e);
+            static Result FromError(E &&e)
+            {
+                return Result(std::move(e));
+            }
 
             // SWS_CORE_00836
             /**
              * \brief Build a new Result from an error that is constructed in-place from the given arguments.
-             * 
+             *
              * This function shall not participate in overload resolution unless: std::is_constructible<E,
              * Args&&...>::value is true, and the first type of the expanded parameter pack is not E, and the
              * first type of the expanded parameter pack is not a specialization of Result
-             * 
+             *
              * \tparam Args     the types of arguments given to this function
              * \param[in] args  the parameter pack used for constructing the error
              * \return Result   a Result that contains an error
              */
-            template<typename... Args>
-            static Result FromError(Args& ... args);
+            template <typename... Args, typename = typename std::enable_if<std::is_constructible<E, Args &&...>::value>::type>
+            static Result FromError(Args &&... args)
+            {
+                return Result(internal::ErrorTag(), std::forward<Args>(args)...);
+            }
 
             // SWS_CORE_00841
             /**
              * \brief Copy-assign another Result to this instance.
-             * 
+             *
              * \param[in] other     the other instance
              * \return Result&      *this, containing the contents of other
              */
-            Result& operator=(Result const &other);
+            Result& operator=(Result const &other) = default;
 
             // SWS_CORE_00842
             /**
              * \brief Move-assign another Result to this instance.
-             * 
+             *
              * \param[in] other     the other instance
              * \return Result&      *this, containing the contents of other
-             * 
+             *
              * conditionally noexcept
              */
-            Result& operator=(Result &&other) noexcept(
-                std::is_nothrow_move_constructible<E>::value && std::is_nothrow_move_assignable<E>::value);
+            Result& operator=(Result &&other) = default;
 
             // SWS_CORE_00843
             /**
              * \brief Put a new value into this instance, constructed in-place from the given arguments.
-             * 
+             *
              * \tparam Args     the types of arguments given to this function
              * \param[in] args  the arguments used for constructing the value
              */
             template<typename... Args>
-            void EmplaceValue(Args &&... args) noexcept;
+            void EmplaceValue(Args &&...) noexcept
+            {
+                storage_ = Storage(internal::ValueTag());
+            }
 
             // SWS_CORE_00844
             /**
              * \brief Put a new error into this instance, constructed in-place from the given arguments.
-             * 
+             *
              * \tparam Args     the types of arguments given to this function
              * \param[in] args  the arguments used for constructing the error
              */
             template<typename... Args>
-            void EmplaceError(Args &&... args);
+            void EmplaceError(Args &&... args)
+            {
+                storage_ = Storage(internal::ErrorTag(), std::forward<Args>(args)...);
+            }
 
             // SWS_CORE_00845
             /**
              * \brief Exchange the contents of this instance with those of other.
-             * 
+             *
              * \param[in] other     the other instance
              */
             void Swap(Result &other) noexcept(
-                std::is_nothrow_move_constructible<E>::value && std::is_nothrow_move_assignable<E>::value);
+                std::is_nothrow_move_constructible<E>::value && std::is_nothrow_move_assignable<E>::value)
+            {
+                using std::swap;
+                if (!HasValue() && !other.HasValue())
+                {
+                    swap(storage_.error_, other.storage_.error_);
+                }
+                else if (HasValue() != other.HasValue())
+                {
+                    Result temp(std::move(other));
+                    other = std::move(*this);
+                    *this = std::move(temp);
+                }
+            }
 
             // SWS_CORE_00851
             /**
              * \brief Check whether *this contains a value.
-             * 
+             *
              * \return true     if *this contains a value
              * \return false    otherwise
              */
-            bool HasValue() const noexcept;
+            bool HasValue() const noexcept
+            {
+                return storage_.hasValue_;
+            }
 
             // SWS_CORE_00852
             /**
              * \brief Check whether *this contains a value.
-             * 
+             *
              * \return true     if *this contains a value
              * \return false    otherwise
              */
-            explicit operator bool () const noexcept;
+            explicit operator bool () const noexcept
+            {
+                return storage_.hasValue_;
+            }
 
             // SWS_CORE_00853
             /**
@@ -622,7 +1111,9 @@ namespace ara
              * This function only exists for helping with generic programming.
              * The behavior of this function is undefined if *this does not contain a value.
              */
-            void operator*() const;
+            void operator*() const
+            {
+            }
 
             // SWS_CORE_00855
             /**
@@ -630,72 +1121,94 @@ namespace ara
              * This function only exists for helping with generic programming.
              * The behavior of this function is undefined if *this does not contain a value.
              */
-            void Value() const;
+            void Value() const
+            {
+            }
 
             // SWS_CORE_00857
             /**
              * \brief Access the contained error.
              * The behavior of this function is undefined if *this does not contain an error.
-             * 
+             *
              * \return E const&     a const reference to the contained error
              */
-            E const& Error() const &;
+            E const& Error() const &
+            {
+                return storage_.error_;
+            }
 
             // SWS_CORE_00858
             /**
              * \brief Access the contained error.
              * The behavior of this function is undefined if *this does not contain an error.
-             * 
+             *
              * \return E&&  an rvalue reference to the contained error
              */
-            E&& Error() &&;
+            E&& Error() &&
+            {
+                return std::move(storage_.error_);
+            }
 
             // SWS_CORE_00861
             /**
              * \brief Do nothing.
              * This function only exists for helping with generic programming.
-             * 
+             *
              * \tparam U    the type of defaultValue
              * \param[in] defaultValue  the value to use if *this does not contain a value
              */
             template<typename U>
-            void ValueOr(U &&defaultValue) const;
+            void ValueOr(U &&) const
+            {
+            }
 
             // SWS_CORE_00863
             /**
              * \brief Return the contained error or the given default error.
              * If *this contains an error, it is returned. Otherwise, the specified default error is returned, static_
              * cast’d to E.
-             * 
+             *
              * \tparam G    the type of defaultError
              * \param[in] defaultError  the error to use if *this does not contain an error
              * \return E    the error
              */
             template<typename G>
-            E ErrorOr(G &&defaultError) const;
+            E ErrorOr(G &&defaultError) const
+            {
+                return HasValue() ? static_cast<E>(std::forward<G>(defaultError)) : Error();
+            }
 
             // SWS_CORE_00865
             /**
              * \brief Return whether this instance contains the given error.
              * This call compares the argument error, static_cast’d to E, with the return value from Error().
-             * 
+             *
              * \tparam G    the type of the error argument error
              * \param[in] error     the error to check
              * \return true     if *this contains an error that is equivalent to the given error
              * \return false    otherwise
              */
             template<typename G>
-            bool CheckError(G &&error) const;
+            bool CheckError(G &&error) const
+            {
+                return !HasValue() && (Error() == static_cast<E>(std::forward<G>(error)));
+            }
 
             // SWS_CORE_00866
             /**
              * \brief Return the contained value or throw an exception.
-             * This function does not participate in overload resolution when the compiler toolchain does not
-             * support C++ exceptions.
-             * 
+             * In builds without exceptions (ARA_CORE_EXCEPTIONS == 0) it calls Abort() with the message of the
+             * error instead of throwing.
+             *
              * \exception <TYPE>    the exception type associated with the contained error
              */
-            void ValueOrThrow() const noexcept(false);
+            void ValueOrThrow() const noexcept(false)
+            {
+                if (!HasValue())
+                {
+                    Error().ThrowAsException();
+                }
+            }
 
             // SWS_CORE_00867
             /**
@@ -703,12 +1216,101 @@ namespace ara
              * If *this contains a value, this function does nothing. Otherwise, the specified callable is invoked.
              * The Callable is expected to be compatible to this interface: void f(E const&);
              * This function only exists for helping with generic programming.
-             * 
+             *
              * \tparam F    the type of the Callable f
              * \param[in] f the Callable
              */
             template<typename F>
-            void Resolve(F &&f) const;
+            void Resolve(F &&f) const
+            {
+                if (!HasValue())
+                {
+                    std::forward<F>(f)(Error());
+                }
+            }
+
+            /**
+             * \brief Call a Callable if this instance contains a value, and return a new Result with the result of
+             * the call. The Callable may return a Result or a plain value, see Result<T, E>::Bind().
+             *
+             * \tparam F            the type of the Callable f
+             * \param[in] f         the Callable
+             * \return SEE_BELOW    a new Result instance of the possibly transformed type
+             */
+            template <typename F, typename U = internal::InvokeResult<F>>
+            auto Bind(F &&f) const -> typename internal::BindResult<U, E>::type
+            {
+                return BindImpl(std::forward<F>(f), internal::IsResult<U>());
+            }
+
+            /**
+             * \brief Produce a value with a Callable, pass an error on unchanged.
+             *
+             * The Callable is expected to be compatible to this interface: U f(); where U may be void.
+             *
+             * \tparam F            the type of the Callable f
+             * \param[in] f         the Callable
+             * \return Result<U, E> the result of f, or the error of this instance
+             */
+            template <typename F, typename U = internal::InvokeResult<F>>
+            ARA_CORE_NODISCARD Result<U, E> Map(F &&f) const &
+            {
+                return HasValue() ? internal::MapInvoker<U, E>::Invoke(std::forward<F>(f)) : Result<U, E>(Error());
+            }
+
+            /**
+             * \brief Chain an operation that can fail itself, pass an error on unchanged.
+             *
+             * The Callable is expected to be compatible to this interface: Result<U, E> f();
+             *
+             * \tparam F            the type of the Callable f
+             * \param[in] f         the Callable
+             * \return R            the Result returned by f, or the error of this instance
+             */
+            template <typename F, typename R = internal::InvokeResult<F>>
+            ARA_CORE_NODISCARD R AndThen(F &&f) const &
+            {
+                static_assert(internal::IsResult<R>::value, "the callable given to AndThen must return a Result");
+                return HasValue() ? std::forward<F>(f)() : R(Error());
+            }
+
+            /**
+             * \brief Recover from an error, pass a value on unchanged.
+             *
+             * The Callable is expected to be compatible to this interface: Result<void, G> f(E const&);
+             *
+             * \tparam F            the type of the Callable f
+             * \param[in] f         the Callable
+             * \return R            a Result with a value if this instance has one, or the Result returned by f
+             */
+            template <typename F, typename R = internal::InvokeResult<F, E const &>>
+            ARA_CORE_NODISCARD R OrElse(F &&f) const &
+            {
+                static_assert(internal::IsResult<R>::value, "the callable given to OrElse must return a Result");
+                return HasValue() ? R() : std::forward<F>(f)(Error());
+            }
+
+        private:
+            using Storage = internal::ResultStorage<internal::Empty, E>;
+
+            template <typename... Args>
+            explicit Result(internal::ErrorTag tag, Args &&... args) : storage_(tag, std::forward<Args>(args)...)
+            {
+            }
+
+            template <typename F>
+            auto BindImpl(F &&f, std::true_type) const -> decltype(AndThen(std::forward<F>(f)))
+            {
+                return AndThen(std::forward<F>(f));
+            }
+
+            template <typename F>
+            auto BindImpl(F &&f, std::false_type) const -> decltype(Map(std::forward<F>(f)))
+            {
+                return Map(std::forward<F>(f));
+            }
+
+            Storage storage_;
         };
 
         // SWS_CORE_00780
@@ -716,173 +1318,219 @@ namespace ara
          * \brief Compare two Result instances for equality.
          * A Result that contains a value is unequal to every Result containing an error. A Result is equal
          * to another Result only if both contain the same type, and the value of that type compares equal.
-         * 
-         * \tparam T 
-         * \tparam E 
-         * \param[in] lhs   the left hand side of the comparison 
+         *
+         * \tparam T
+         * \tparam E
+         * \param[in] lhs   the left hand side of the comparison
          * \param[in] rhs   the right hand side of the comparison
          * \return true     if the two instances compare equal
          * \return false    otherwise
          */
         template<typename T, typename E>
-        bool operator==(Result<T, E> const &lhs, Result<T, E> const &rhs);
+        bool operator==(Result<T, E> const &lhs, Result<T, E> const &rhs)
+        {
+            if (lhs.HasValue() != rhs.HasValue())
+            {
+                return false;
+            }
+            return lhs.HasValue() ? (lhs.Value() == rhs.Value()) : (lhs.Error() == rhs.Error());
+        }
+
+        template<typename E>
+        bool operator==(Result<void, E> const &lhs, Result<void, E> const &rhs)
+        {
+            if (lhs.HasValue() != rhs.HasValue())
+            {
+                return false;
+            }
+            return lhs.HasValue() || (lhs.Error() == rhs.Error());
+        }
 
         // SWS_CORE_00781
         /**
          * \brief Compare two Result instances for inequality.
          * A Result that contains a value is unequal to every Result containing an error. A Result is equal
          * to another Result only if both contain the same type, and the value of that type compares equal.
-         * 
-         * \tparam T 
-         * \tparam E 
-         * \param[in] lhs   the left hand side of the comparison 
+         *
+         * \tparam T
+         * \tparam E
+         * \param[in] lhs   the left hand side of the comparison
          * \param[in] rhs   the right hand side of the comparison
          * \return true     if the two instances compare unequal
          * \return false    otherwise
          */
         template<typename T, typename E>
-        bool operator!=(Result<T, E> const &lhs, Result<T, E> const &rhs);
+        bool operator!=(Result<T, E> const &lhs, Result<T, E> const &rhs)
+        {
+            return !(lhs == rhs);
+        }
 
         // SWS_CORE_00782
         /**
          * \brief Compare a Result instance for equality to a value.
          * A Result that contains no value is unequal to every value. A Result is equal to a value only if the
          * Result contains a value of the same type, and the values compare equal.
-         * 
-         * \tparam T 
-         * \tparam E 
+         *
+         * \tparam T
+         * \tparam E
          * \param[in] lhs   the Result instance
          * \param[in] rhs   the value to compare with
          * \return true     if the Result’s value compares equal to the rhs value
          * \return false    otherwise
          */
         template<typename T, typename E>
-        bool operator==(Result<T, E> const &lhs, T const &rhs);
+        bool operator==(Result<T, E> const &lhs, T const &rhs)
+        {
+            return lhs.HasValue() && (lhs.Value() == rhs);
+        }
 
         // SWS_CORE_00783
         /**
          * \brief   Compare a Result instance for equality to a value.
          * A Result that contains no value is unequal to every value. A Result is equal to a value only if the
          * Result contains a value of the same type, and the values compare equal.
-         * 
-         * \tparam T 
-         * \tparam E 
+         *
+         * \tparam T
+         * \tparam E
          * \param[in] lhs   the value to compare with
          * \param[in] rhs   the Result instance
          * \return true     if the Result’s value compares equal to the lhs value
          * \return false    otherwise
          */
         template<typename T, typename E>
-        bool operator==(T const &lhs, Result<T, E> const &rhs);
+        bool operator==(T const &lhs, Result<T, E> const &rhs)
+        {
+            return rhs == lhs;
+        }
 
         // SWS_CORE_00784
         /**
          * \brief Compare a Result instance for inequality to a value.
          * A Result that contains no value is unequal to every value. A Result is equal to a value only if the
          * Result contains a value of the same type, and the values compare equal.
-         * 
-         * \tparam T 
-         * \tparam E 
+         *
+         * \tparam T
+         * \tparam E
          * \param[in] lhs   the Result instance
          * \param[in] rhs   the value to compare with
          * \return true     if the Result’s value compares unequal to the rhs value
          * \return false    otherwise
          */
         template<typename T, typename E>
-        bool operator!=(Result<T, E> const &lhs, T const &rhs);
+        bool operator!=(Result<T, E> const &lhs, T const &rhs)
+        {
+            return !(lhs == rhs);
+        }
 
         // SWS_CORE_00785
         /**
          * \brief Compare a Result instance for inequality to a value.
          * A Result that contains no value is unequal to every value. A Result is equal to a value only if the
          * Result contains a value of the same type, and the values compare equal.
-         * 
-         * \tparam T 
-         * \tparam E 
+         *
+         * \tparam T
+         * \tparam E
          * \param[in] lhs   the value to compare with
          * \param[in] rhs   the Result instance
          * \return true     if the Result’s value compares unequal to the lhs value
          * \return false    otherwise
          */
         template<typename T, typename E>
-        bool operator!=(T const &lhs, Result<T, E> const &rhs);
-        
+        bool operator!=(T const &lhs, Result<T, E> const &rhs)
+        {
+            return !(rhs == lhs);
+        }
+
         // SWS_CORE_00786
         /**
          * \brief Compare a Result instance for equality to an error.
          * A Result that contains no error is unequal to every error. A Result is equal to an error only if the
          * Result contains an error of the same type, and the errors compare equal.
-         * 
-         * \tparam T 
-         * \tparam E 
+         *
+         * \tparam T
+         * \tparam E
          * \param[in] lhs   the Result instance
          * \param[in] rhs   the error to compare with
          * \return true     if the Result’s error compares equal to the rhs error
          * \return false    otherwise
          */
         template<typename T, typename E>
-        bool operator==(Result<T, E> const &lhs, E const &rhs);
+        bool operator==(Result<T, E> const &lhs, E const &rhs)
+        {
+            return !lhs.HasValue() && (lhs.Error() == rhs);
+        }
 
         // SWS_CORE_00787
         /**
          * \brief Compare a Result instance for equality to an error.
          * A Result that contains no error is unequal to every error. A Result is equal to an error only if the
          * Result contains an error of the same type, and the errors compare equal.
-         * 
-         * \tparam T 
-         * \tparam E 
+         *
+         * \tparam T
+         * \tparam E
          * \param[in] lhs   the error to compare with
          * \param[in] rhs   the Result instance
          * \return true     if the Result’s error compares equal to the lhs error
          * \return false    otherwise
          */
         template<typename T, typename E>
-        bool operator==(E const &lhs, Result<T, E> const &rhs);
+        bool operator==(E const &lhs, Result<T, E> const &rhs)
+        {
+            return rhs == lhs;
+        }
 
         // SWS_CORE_00788
         /**
          * \brief Compare a Result instance for inequality to an error.
          * A Result that contains no error is unequal to every error. A Result is equal to an error only if the
          * Result contains an error of the same type, and the errors compare equal.
-         * 
-         * \tparam T 
-         * \tparam E 
-         * \param[in] lhs   the Result instance 
+         *
+         * \tparam T
+         * \tparam E
+         * \param[in] lhs   the Result instance
          * \param[in] rhs   the error to compare with
          * \return true     if the Result’s error compares unequal to the rhs error
          * \return false    otherwise
          */
         template<typename T, typename E>
-        bool operator!=(Result<T, E> const &lhs, E const &rhs);
+        bool operator!=(Result<T, E> const &lhs, E const &rhs)
+        {
+            return !(lhs == rhs);
+        }
 
         // SWS_CORE_00789
         /**
          * \brief Compare a Result instance for inequality to an error.
          * A Result that contains no error is unequal to every error. A Result is equal to an error only if the
          * Result contains an error of the same type, and the errors compare equal.
-         * 
-         * \tparam T 
-         * \tparam E 
-         * \param[in] lhs   the error to compare with 
+         *
+         * \tparam T
+         * \tparam E
+         * \param[in] lhs   the error to compare with
          * \param[in] rhs   the Result instance
          * \return true     if the Result’s error compares unequal to the lhs error
          * \return false    otherwise
          */
         template<typename T, typename E>
-        bool operator!=(E const &lhs, Result<T, E> const &rhs);
+        bool operator!=(E const &lhs, Result<T, E> const &rhs)
+        {
+            return !(rhs == lhs);
+        }
 
         // SWS_CORE_00796
         /**
          * \brief Swap the contents of the two given arguments.
-         * 
-         * \tparam T 
-         * \tparam E 
+         *
+         * \tparam T
+         * \tparam E
          * \param[in] lhs   one instance
          * \param[in] rhs   another instance
          */
         template<typename T, typename E>
-        void swap(Result<T, E> &lhs, Result<T, E> &rhs) noexcept(noexcept(lhs.Swap(rhs)));
-
+        void swap(Result<T, E> &lhs, Result<T, E> &rhs) noexcept(noexcept(lhs.Swap(rhs)))
+        {
+            lhs.Swap(rhs);
+        }
 
     } // namespace core
 
@@ -0,0 +1,446 @@
+/**
+ * \file shared_state.h
+ * \author Vincent WANG (vin@misday.com)
+ * \brief Shared state between a Promise and its Future.
+ * \version 0.1
+ * \date 2021-11-12
+ *
+ * \copyright Copyright (c) 2021
+ *
+ */
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cerrno>
+#include <climits>
+#include <cstdint>
+#include <new>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <time.h>
+#include "abort.h"
+#include "executor.h"
+#include "result.h"
+#include "shared_state_pool.h"
+
+#if defined(__linux__)
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace ara
+{
+namespace core
+{
+    namespace internal
+    {
+        static_assert(sizeof(std::atomic<std::uint32_t>) == sizeof(std::uint32_t), "a futex is a plain 32 bit word");
+
+        /**
+         * \brief Tell the CPU that the caller is spinning.
+         *
+         */
+        inline void CpuRelax() noexcept
+        {
+#if defined(__x86_64__) || defined(__i386__)
+            __builtin_ia32_pause();
+#elif defined(__aarch64__)
+            asm volatile("yield" ::: "memory");
+#endif
+        }
+
+        /**
+         * \brief Clock that an absolute futex timeout refers to.
+         *
+         */
+        enum class FutexClock : std::uint8_t
+        {
+            kMonotonic,     /*< CLOCK_MONOTONIC, the clock of std::chrono::steady_clock */
+            kRealtime,      /*< CLOCK_REALTIME, the clock of std::chrono::system_clock */
+        };
+
+        /**
+         * \brief Sleep until word no longer holds expected, a wake-up or the deadline. May return spuriously.
+         *
+         * The deadline is absolute (FUTEX_WAIT_BITSET), so the kernel itself tracks it against the given clock,
+         * including jumps of CLOCK_REALTIME, and a retry after a spurious wake-up needs no clock reading.
+         *
+         * \param[in] word      the futex word
+         * \param[in] expected  the value the caller last saw
+         * \param[in] deadline  absolute deadline, nullptr to wait without limit
+         * \param[in] clock     the clock of deadline
+         * \return false        if the deadline has passed
+         */
+        inline bool FutexWait(std::atomic<std::uint32_t> const &word, std::uint32_t expected, ::timespec const *deadline,
+                              FutexClock clock) noexcept
+        {
+#if defined(__linux__)
+            int const op = FUTEX_WAIT_BITSET_PRIVATE | ((clock == FutexClock::kRealtime) ? FUTEX_CLOCK_REALTIME : 0);
+            return (::syscall(SYS_futex, reinterpret_cast<std::uint32_t const *>(&word), op, expected, deadline, nullptr,
+                              FUTEX_BITSET_MATCH_ANY) == 0) ||
+                   (errno != ETIMEDOUT);
+#else
+            (void)word;
+            (void)expected;
+            std::this_thread::yield();
+            if (deadline == nullptr)
+            {
+                return true;
+            }
+            ::timespec now;
+            (void)::clock_gettime((clock == FutexClock::kRealtime) ? CLOCK_REALTIME : CLOCK_MONOTONIC, &now);
+            return (now.tv_sec < deadline->tv_sec) ||
+                   ((now.tv_sec == deadline->tv_sec) && (now.tv_nsec < deadline->tv_nsec));
+#endif
+        }
+
+        /**
+         * \brief Convert a time point to the absolute timespec of its clock, rounding up.
+         *
+         * \param[in] deadline  the time point
+         * \return ::timespec   the time since the epoch of the clock, 0 for time points before it
+         */
+        template <typename Clock, typename Duration>
+        ::timespec ToTimespec(std::chrono::time_point<Clock, Duration> const &deadline) noexcept
+        {
+            auto const sinceEpoch = deadline.time_since_epoch();
+            auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(sinceEpoch);
+            if (ns < sinceEpoch)
+            {
+                ++ns;
+            }
+            ::timespec result{0, 0};
+            if (ns.count() > 0)
+            {
+                result.tv_sec = static_cast<::time_t>(ns.count() / 1000000000);
+                result.tv_nsec = static_cast<long>(ns.count() % 1000000000);
+            }
+            return result;
+        }
+
+        /**
+         * \brief Wake all threads sleeping in FutexWait() on word.
+         *
+         * \param[in] word      the futex word
+         */
+        inline void FutexWakeAll(std::atomic<std::uint32_t> &word) noexcept
+        {
+#if defined(__linux__)
+            (void)::syscall(SYS_futex, reinterpret_cast<std::uint32_t *>(&word), FUTEX_WAKE_PRIVATE, INT_MAX, nullptr,
+                            nullptr, 0);
+#else
+            (void)word;
+#endif
+        }
+
+        /**
+         * \brief The single-shot channel between a Promise and its Future, allocated once per Promise from a
+         * SharedStatePool unless ARA_CORE_SHARED_STATE_POOL is 0.
+         *
+         * Everything is driven by one atomic 32 bit word: the Promise constructs the Result in place and then
+         * publishes it by setting kReady with release semantics, so checking readiness is a single acquire
+         * load. A waiter spins for a short while, then announces itself with kWaiters and sleeps on the word
+         * as a futex; the Promise only issues the wake-up system call when kWaiters is set.
+         *
+         * The Promise is the only writer of the Result, so no lock or compare-and-swap is needed to store it.
+         *
+         * A continuation registered by Future::then() is published the same way with kContinuation. Whoever
+         * of the two sets its bit last sees the other one and runs the continuation, so it runs exactly once:
+         * either inline in Promise::set_value() or in Future::then() if the state was ready already. Exceptions
+         * never propagate out of an inline continuation.
+         *
+         * \tparam T    the type of value
+         * \tparam E    the type of error
+         */
+        template <typename T, typename E>
+        class SharedState final
+        {
+        public:
+            static constexpr std::uint32_t kReady = 1U;         /*< the Result is constructed and published */
+            static constexpr std::uint32_t kWaiters = 2U;       /*< a thread sleeps or is about to sleep on the word */
+            static constexpr std::uint32_t kRetrieved = 4U;     /*< the Future was handed out */
+            static constexpr std::uint32_t kContinuation = 8U;  /*< a continuation is stored */
+
+            /**
+             * \brief Number of readiness checks before a waiter goes to sleep.
+             *
+             */
+            static constexpr int kSpinCount = 128;
+
+            SharedState() noexcept : state_(0U), refs_(1U)
+            {
+            }
+
+            SharedState(SharedState const &) = delete;
+            SharedState& operator=(SharedState const &) = delete;
+
+#if ARA_CORE_SHARED_STATE_POOL
+            static void* operator new(std::size_t size)
+            {
+                static_cast<void>(size);
+                return SharedStatePool<sizeof(SharedState), alignof(SharedState)>::Allocate();
+            }
+
+            static void operator delete(void *p) noexcept
+            {
+                SharedStatePool<sizeof(SharedState), alignof(SharedState)>::Deallocate(p);
+            }
+#endif
+
+            ~SharedState()
+            {
+                if ((state_.load(std::memory_order_relaxed) & kReady) != 0U)
+                {
+                    Get()->~Result<T, E>();
+                }
+            }
+
+            void AddRef() noexcept
+            {
+                refs_.fetch_add(1U, std::memory_order_relaxed);
+            }
+
+            /**
+             * \brief Drop one reference, and free the state with the last one.
+             *
+             */
+            void Release() noexcept
+            {
+                if (refs_.fetch_sub(1U, std::memory_order_acq_rel) == 1U)
+                {
+                    delete this;
+                }
+            }
+
+            /**
+             * \brief Mark the Future as handed out.
+             *
+             * \return true     if this is the first call
+             * \return false    if the Future was already retrieved
+             */
+            bool Retrieve() noexcept
+            {
+                return (state_.fetch_or(kRetrieved, std::memory_order_relaxed) & kRetrieved) == 0U;
+            }
+
+            bool IsReady() const noexcept
+            {
+                return (state_.load(std::memory_order_acquire) & kReady) != 0U;
+            }
+
+            /**
+             * \brief Construct the Result from the given arguments and make the state ready. Promise only.
+             *
+             * \param[in] args      the arguments of a Result<T, E> constructor
+             * \return true         if the state was made ready
+             * \return false        if it already was
+             */
+            template <typename... Args>
+            bool Emplace(Args &&... args)
+            {
+                if ((state_.load(std::memory_order_relaxed) & kReady) != 0U)
+                {
+                    return false;
+                }
+                new (&storage_) Result<T, E>(std::forward<Args>(args)...);
+                std::uint32_t const previous = state_.fetch_or(kReady, std::memory_order_acq_rel);
+                if ((previous & kWaiters) != 0U)
+                {
+                    FutexWakeAll(state_);
+                }
+                if ((previous & kContinuation) != 0U)
+                {
+                    RunContinuation();
+                }
+                return true;
+            }
+
+            /**
+             * \brief Store the continuation, and run it right away if the state is ready. Future only, once.
+             *
+             * The continuation owns the Future's reference, so the state must not be touched after this call.
+             *
+             * \param[in] continuation     the continuation
+             */
+            void SetContinuation(Task &&continuation)
+            {
+                continuation_ = std::move(continuation);
+                if ((state_.fetch_or(kContinuation, std::memory_order_acq_rel) & kReady) != 0U)
+                {
+                    RunContinuation();
+                }
+            }
+
+            /**
+             * \brief Block until the state is ready.
+             *
+             */
+            void Wait() const noexcept
+            {
+                (void)SleepUntil(nullptr, FutexClock::kMonotonic);
+            }
+
+            /**
+             * \brief Block until the state is ready or the steady_clock deadline has passed.
+             *
+             * std::chrono::steady_clock is CLOCK_MONOTONIC, so the deadline is handed to the kernel as is.
+             *
+             * \param[in] deadline  the deadline
+             * \return true         if the state is ready
+             * \return false        on timeout
+             */
+            template <typename Duration>
+            bool WaitUntil(std::chrono::time_point<std::chrono::steady_clock, Duration> const &deadline) const noexcept
+            {
+                ::timespec const absolute = ToTimespec(deadline);
+                return SleepUntil(&absolute, FutexClock::kMonotonic);
+            }
+
+            /**
+             * \brief Block until the state is ready or the system_clock deadline has passed.
+             *
+             * The kernel waits against CLOCK_REALTIME, so setting the system time moves the wake-up with it.
+             *
+             * \param[in] deadline  the deadline
+             * \return true         if the state is ready
+             * \return false        on timeout
+             */
+            template <typename Duration>
+            bool WaitUntil(std::chrono::time_point<std::chrono::system_clock, Duration> const &deadline) const noexcept
+            {
+                ::timespec const absolute = ToTimespec(deadline);
+                return SleepUntil(&absolute, FutexClock::kRealtime);
+            }
+
+            /**
+             * \brief Block until the state is ready or the deadline of any other clock has passed.
+             *
+             * The deadline is translated to steady_clock once. A clock that does not advance like steady_clock
+             * is checked again on timeout, so the wait never ends before the deadline.
+             *
+             * \param[in] deadline  the deadline
+             * \return true         if the state is ready
+             * \return false        on timeout
+             */
+            template <typename Clock, typename Duration>
+            bool WaitUntil(std::chrono::time_point<Clock, Duration> const &deadline) const noexcept
+            {
+                for (;;)
+                {
+                    auto const now = Clock::now();
+                    if (now >= deadline)
+                    {
+                        return IsReady();
+                    }
+                    if (WaitUntil(std::chrono::steady_clock::now() + (deadline - now)))
+                    {
+                        return true;
+                    }
+                }
+            }
+
+            /**
+             * \brief Access the Result of a ready state.
+             *
+             * \return Result<T, E>*    the Result
+             */
+            Result<T, E>* Get() noexcept
+            {
+                return reinterpret_cast<Result<T, E> *>(&storage_);
+            }
+
+            /**
+             * \brief Store a continuation that does not own a reference, unless the state is ready already.
+             * Future only, once.
+             *
+             * \param[in] continuation     the continuation
+             * \return true                if the continuation will be run when the state becomes ready
+             * \return false               if the state is ready, the continuation is dropped then
+             */
+            bool Subscribe(Task &&continuation)
+            {
+                continuation_ = std::move(continuation);
+                if ((state_.fetch_or(kContinuation, std::memory_order_acq_rel) & kReady) != 0U)
+                {
+                    continuation_ = Task();
+                    return false;
+                }
+                return true;
+            }
+
+        private:
+            // Runs the continuation from the stack, as it may drop the last reference to this state. Called from
+            // set_value() after the state is ready and from the noexcept destructor of Promise, so nothing may
+            // escape: a continuation that throws is destroyed, which breaks the Promise it owns.
+            void RunContinuation() noexcept
+            {
+                Task continuation(std::move(continuation_));
+                ARA_CORE_TRY
+                {
+                    continuation();
+                }
+                ARA_CORE_CATCH(...)
+                {
+                }
+            }
+
+            // Spin for a while, then sleep until the state is ready. Returns false if the deadline passed first.
+            bool SleepUntil(::timespec const *deadline, FutexClock clock) const noexcept
+            {
+                for (int i = 0; i < kSpinCount; ++i)
+                {
+                    if (IsReady())
+                    {
+                        return true;
+                    }
+                    CpuRelax();
+                }
+
+                std::uint32_t current = state_.load(std::memory_order_acquire);
+                while ((current & kReady) == 0U)
+                {
+                    if ((current & kWaiters) == 0U)
+                    {
+                        std::uint32_t const announced = current | kWaiters;
+                        if (!state_.compare_exchange_weak(current, announced, std::memory_order_acquire))
+                        {
+                            continue;
+                        }
+                        current = announced;
+                    }
+                    if (!FutexWait(state_, current, deadline, clock))
+                    {
+                        return IsReady();
+                    }
+                    current = state_.load(std::memory_order_acquire);
+                }
+                return true;
+            }
+
+            mutable std::atomic<std::uint32_t> state_;
+            std::atomic<std::uint32_t> refs_;
+            Task continuation_;
+            typename std::aligned_storage<sizeof(Result<T, E>), alignof(Result<T, E>)>::type storage_;
+        };
+
+        template <typename T, typename E>
+        constexpr std::uint32_t SharedState<T, E>::kReady;
+
+        template <typename T, typename E>
+        constexpr std::uint32_t SharedState<T, E>::kWaiters;
+
+        template <typename T, typename E>
+        constexpr std::uint32_t SharedState<T, E>::kRetrieved;
+
+        template <typename T, typename E>
+        constexpr std::uint32_t SharedState<T, E>::kContinuation;
+
+        template <typename T, typename E>
+        constexpr int SharedState<T, E>::kSpinCount;
+    } // namespace internal
+} // namespace core
+} // namespace ara
@@ -0,0 +1,226 @@
+/**
+ * \file shared_state_pool.h
+ * \author Vincent WANG (vin@misday.com)
+ * \brief Per-thread recycling of the shared states of Promise and Future.
+ * \version 0.1
+ * \date 2021-11-12
+ *
+ * \copyright Copyright (c) 2021
+ *
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <new>
+
+/**
+ * \brief Whether shared states of Promise/Future are recycled through SharedStatePool (1) or taken from the
+ * heap for every Promise (0).
+ *
+ * Set by the ARA_CORE_SHARED_STATE_POOL CMake option.
+ */
+#ifndef ARA_CORE_SHARED_STATE_POOL
+#define ARA_CORE_SHARED_STATE_POOL 1
+#endif
+
+namespace ara
+{
+namespace core
+{
+    namespace internal
+    {
+        /**
+         * \brief A recycler of memory blocks of one size, with a free list per thread.
+         *
+         * A block returns to the free list of the thread that first allocated it. The owning thread pushes
+         * and pops its local list without synchronization; other threads push onto a lock-free remote list
+         * that the owner takes over in one exchange when its local list runs empty. So once the number of
+         * Promises in flight has peaked, creating one does not allocate, no matter which thread drops the
+         * last reference to its state.
+         *
+         * Blocks are only given back to the heap when their owning thread has exited; until then, the pool
+         * of a thread holds as many blocks as it had in flight at most. A block released after its owner
+         * exited goes back to the heap directly.
+         *
+         * \tparam Size     the size of a block
+         * \tparam Align    the alignment of a block
+         */
+        template <std::size_t Size, std::size_t Align>
+        class SharedStatePool final
+        {
+            static_assert(Align <= alignof(std::max_align_t), "over-aligned blocks are not supported");
+
+        public:
+            /**
+             * \brief Get a block, from the local list of the calling thread if possible.
+             *
+             * \return void*            the block
+             * \throws std::bad_alloc   if the heap is exhausted
+             */
+            static void* Allocate()
+            {
+                Cache *cache = current_;
+                if (cache == nullptr)
+                {
+                    cache = Attach();
+                }
+                return cache->Allocate();
+            }
+
+            /**
+             * \brief Return a block obtained by Allocate(), from any thread.
+             *
+             * \param[in] p     the block
+             */
+            static void Deallocate(void *p) noexcept
+            {
+                Block *const block = Block::From(p);
+                Cache *const owner = block->owner;
+                if (owner == current_)
+                {
+                    owner->PushLocal(block);
+                }
+                else
+                {
+                    owner->PushRemote(block);
+                }
+            }
+
+        private:
+            struct Cache;
+
+            struct alignas(std::max_align_t) Block
+            {
+                Cache *owner;
+                Block *next;
+
+                void* Payload() noexcept
+                {
+                    return this + 1;
+                }
+
+                static Block* From(void *payload) noexcept
+                {
+                    return static_cast<Block *>(payload) - 1;
+                }
+            };
+
+            // The blocks of one thread. Only the owning thread touches local, so recycling a block on the
+            // thread that allocated it takes no atomic operation. blocks counts the blocks taken from the heap
+            // plus one while the thread runs; whoever drops it to zero frees the Cache.
+            struct Cache
+            {
+                Cache() noexcept : local(nullptr), remote(nullptr), blocks(1U)
+                {
+                }
+
+                void* Allocate()
+                {
+                    if (local == nullptr)
+                    {
+                        local = remote.exchange(nullptr, std::memory_order_acquire);
+                    }
+                    Block *block = local;
+                    if (block != nullptr)
+                    {
+                        local = block->next;
+                    }
+                    else
+                    {
+                        block = static_cast<Block *>(::operator new(sizeof(Block) + Size));
+                        block->owner = this;
+                        blocks.fetch_add(1U, std::memory_order_relaxed);
+                    }
+                    return block->Payload();
+                }
+
+                void PushLocal(Block *block) noexcept
+                {
+                    block->next = local;
+                    local = block;
+                }
+
+                // Once the owner has exited, the remote list is closed and the block goes back to the heap.
+                void PushRemote(Block *block) noexcept
+                {
+                    Block *head = remote.load(std::memory_order_relaxed);
+                    do
+                    {
+                        if (head == Closed())
+                        {
+                            ::operator delete(block);
+                            Unref(1U);
+                            return;
+                        }
+                        block->next = head;
+                    } while (!remote.compare_exchange_weak(head, block, std::memory_order_release,
+                                                           std::memory_order_relaxed));
+                }
+
+                // Called by the owning thread when it exits.
+                void Close() noexcept
+                {
+                    std::size_t const freed = Free(local) + Free(remote.exchange(Closed(), std::memory_order_acquire));
+                    local = nullptr;
+                    Unref(freed + 1U);
+                }
+
+                void Unref(std::size_t count) noexcept
+                {
+                    if (blocks.fetch_sub(count, std::memory_order_acq_rel) == count)
+                    {
+                        delete this;
+                    }
+                }
+
+                static std::size_t Free(Block *block) noexcept
+                {
+                    std::size_t count = 0U;
+                    while (block != nullptr)
+                    {
+                        Block *const next = block->next;
+                        ::operator delete(block);
+                        block = next;
+                        ++count;
+                    }
+                    return count;
+                }
+
+                static Block* Closed() noexcept
+                {
+                    return reinterpret_cast<Block *>(alignof(Block));
+                }
+
+                Block *local;
+                std::atomic<Block *> remote;
+                std::atomic<std::size_t> blocks;
+            };
+
+            // Closes the Cache of a thread when the thread exits.
+            struct ThreadExit
+            {
+                ~ThreadExit()
+                {
+                    current_->Close();
+                    current_ = nullptr;
+                }
+            };
+
+            static Cache* Attach()
+            {
+                static thread_local ThreadExit threadExit;
+                static_cast<void>(threadExit);
+                current_ = new Cache();
+                return current_;
+            }
+
+            static thread_local Cache *current_;
+        };
+
+        template <std::size_t Size, std::size_t Align>
+        thread_local typename SharedStatePool<Size, Align>::Cache *SharedStatePool<Size, Align>::current_ = nullptr;
+    } // namespace internal
+} // namespace core
+} // namespace ara
@@ -14,6 +14,10 @@
 
 #include <cstddef>
 #include <iterator>
+#include <limits>
+#include <type_traits>
+#include <utility>
+#include "array.h"
 
 namespace ara
 {
@@ -28,6 +32,64 @@ namespace core
      */
     constexpr std::size_t dynamic_extent = std::numeric_limits<std::size_t>::max();
 
+    template<typename T, std::size_t Extent>
+    class Span;
+
+    namespace internal
+    {
+        template<typename T>
+        struct IsSpan : std::false_type
+        {
+        };
+
+        template<typename T, std::size_t Extent>
+        struct IsSpan<Span<T, Extent>> : std::true_type
+        {
+        };
+
+        template<typename T>
+        struct IsArray : std::false_type
+        {
+        };
+
+        template<typename T, std::size_t N>
+        struct IsArray<Array<T, N>> : std::true_type
+        {
+        };
+
+        // Whether a U(*)[] converts to a T(*)[], i.e. whether a Span of U can be viewed as a Span of T.
+        template<typename U, typename T>
+        using IsSpanCompatible = std::is_convertible<U (*)[], T (*)[]>;
+
+        template<typename Container, typename T, typename = void>
+        struct IsSpanContainer : std::false_type
+        {
+        };
+
+        template<typename Container, typename T>
+        struct IsSpanContainer<Container, T,
+                               decltype(static_cast<void>(std::declval<Container &>().size()),
+                                        static_cast<void>(std::declval<Container &>().data()))>
+            : std::integral_constant<bool,
+                                     !IsSpan<typename std::remove_cv<Container>::type>::value &&
+                                         !IsArray<typename std::remove_cv<Container>::type>::value &&
+                                         !std::is_array<Container>::value &&
+                                         IsSpanCompatible<typename std::remove_pointer<decltype(
+                                                              std::declval<Container &>().data())>::type,
+                                                          T>::value>
+        {
+        };
+
+        template<std::size_t Extent, std::size_t Offset, std::size_t Count>
+        struct SubspanExtent
+            : std::integral_constant<std::size_t,
+                                     (Count != dynamic_extent)
+                                         ? Count
+                                         : ((Extent != dynamic_extent) ? (Extent - Offset) : dynamic_extent)>
+        {
+        };
+    } // namespace internal
+
     // SWS_CORE_01900
     /**
      * \brief A view over a contiguous sequence of objects.
@@ -38,6 +100,7 @@ namespace core
     template<typename T, std::size_t Extent = dynamic_extent>
     class Span
     {
+    public:
         // SWS_CORE_01911
         /**
          * \brief Alias for the type of elements in this Span.
@@ -96,7 +159,7 @@ namespace core
          * ConstexprIterator.
          * 
          */
-        using iterator = implementation_defined;
+        using iterator = pointer;
 
         // SWS_CORE_01918
         /**
@@ -106,7 +169,7 @@ namespace core
          * ConstexprIterator.
          * 
          */
-        using const_iterator = implementation_defined;
+        using const_iterator = element_type const*;
 
         // SWS_CORE_01919
         /**
@@ -120,14 +183,14 @@ namespace core
          * \brief The type of a const_reverse_iterator to elements.
          * 
          */
-        using const_reverse_iterator = std_reverse_iterator<const_iterator>;
+        using const_reverse_iterator = std::reverse_iterator<const_iterator>;
 
         // SWS_CORE_01931
         /**
          * \brief A constant reflecting the configured Extent of this Span.
          * 
          */
-        constexpr index_type extent = Extent;
+        static constexpr index_type extent = Extent;
 
         // SWS_CORE_01941
         /**
@@ -135,7 +198,10 @@ namespace core
          * This constructor shall not participate in overload resolution unless Extent <= 0 is true.
          * 
          */
-        constexpr Span() noexcept;
+        template<std::size_t E = Extent, typename = typename std::enable_if<(E == 0U) || (E == dynamic_extent)>::type>
+        constexpr Span() noexcept : data_(nullptr), size_(0U)
+        {
+        }
 
         // SWS_CORE_01942
         /**
@@ -147,7 +213,9 @@ namespace core
          * \param[in] ptr   the pointer
          * \param[in] count the number of elements to take from ptr
          */
-        constexpr Span(pointer ptr, index_type count);
+        constexpr Span(pointer ptr, index_type count) : data_(ptr), size_(count)
+        {
+        }
 
         // SWS_CORE_01943
         /**
@@ -159,7 +227,10 @@ namespace core
          * \param[in] firstElem pointer to the first element 
          * \param[in] lastElem  pointer to past the last element
          */
-        constexpr Span(pointer firstElem, pointer lastElem);
+        constexpr Span(pointer firstElem, pointer lastElem)
+            : data_(firstElem), size_(static_cast<index_type>(lastElem - firstElem))
+        {
+        }
 
         // SWS_CORE_01944
         /**
@@ -172,8 +243,11 @@ namespace core
          * 
          * \param[in] arr   the raw array
          */
-        template<std::size_t N>
-        constexpr Span(element_type(&arr)[N]) noexcept;
+        template<std::size_t N,
+                 typename = typename std::enable_if<(Extent == dynamic_extent) || (N == Extent)>::type>
+        constexpr Span(element_type(&arr)[N]) noexcept : data_(arr), size_(N)
+        {
+        }
 
         // SWS_CORE_01945
         /**
@@ -185,8 +259,11 @@ namespace core
          * \tparam N the size of the Array
          * \param[in] arr   the array
          */
-        template<std::size_t N>
-        constexpr Span(Array<value_type, N> &arr) noexcept;
+        template<std::size_t N,
+                 typename = typename std::enable_if<(Extent == dynamic_extent) || (N == Extent)>::type>
+        constexpr Span(Array<value_type, N> &arr) noexcept : data_(arr.data()), size_(N)
+        {
+        }
 
         // SWS_CORE_01946
         /**
@@ -198,8 +275,12 @@ namespace core
          * \tparam N the size of the Array
          * \param[in] arr   the array
          */
-        template<std::size_t N>
-        constexpr Span(Array<value_type, N> const &arr) noexcept;
+        template<std::size_t N,
+                 typename = typename std::enable_if<((Extent == dynamic_extent) || (N == Extent)) &&
+                                                    std::is_const<element_type>::value>::type>
+        constexpr Span(Array<value_type, N> const &arr) noexcept : data_(arr.data()), size_(N)
+        {
+        }
 
         // SWS_CORE_01947
         /**
@@ -216,8 +297,11 @@ namespace core
          * 
          * \param[in] cont  the container
          */
-        template<typename Container>
-        constexpr Span(Container &cont);
+        template<typename Container,
+                 typename = typename std::enable_if<internal::IsSpanContainer<Container, element_type>::value>::type>
+        constexpr Span(Container &cont) : data_(cont.data()), size_(static_cast<index_type>(cont.size()))
+        {
+        }
 
         // SWS_CORE_01948
         /**
@@ -235,8 +319,12 @@ namespace core
          * \tparam Container the type of container
          * \param[in] cont  the container
          */
-        template<typename Container>
-        constexpr Span(Container const &cont);
+        template<typename Container,
+                 typename = typename std::enable_if<
+                     internal::IsSpanContainer<Container const, element_type>::value>::type>
+        constexpr Span(Container const &cont) : data_(cont.data()), size_(static_cast<index_type>(cont.size()))
+        {
+        }
 
         // SWS_CORE_01949
         /**
@@ -258,8 +346,12 @@ namespace core
          * 
          * \param[in] s the other Span instance
          */
-        template<typename U, std::size_t N>
-        constexpr Span(Span<U, N> const &s) noexcept;
+        template<typename U, std::size_t N,
+                 typename = typename std::enable_if<((Extent == dynamic_extent) || (N == Extent)) &&
+                                                    internal::IsSpanCompatible<U, element_type>::value>::type>
+        constexpr Span(Span<U, N> const &s) noexcept : data_(s.data()), size_(s.size())
+        {
+        }
 
         // SWS_CORE_01951
         /**
@@ -285,7 +377,10 @@ namespace core
          * \return Span<element_type, Count>  the subspan
          */
         template<std::size_t Count>
-        constexpr Span<element_type, Count> first() const;
+        constexpr Span<element_type, Count> first() const
+        {
+            return Span<element_type, Count>(data_, Count);
+        }
 
         // SWS_CORE_01962
         /**
@@ -294,7 +389,10 @@ namespace core
          * \param[in] count     the number of elements to take over
          * \return Span<element_type, dynamic_extent>     the subspan
          */
-        constexpr Span<element_type, dynamic_extent> first(index_type count) const;
+        constexpr Span<element_type, dynamic_extent> first(index_type count) const
+        {
+            return Span<element_type, dynamic_extent>(data_, count);
+        }
 
         // SWS_CORE_01963
         /**
@@ -304,7 +402,10 @@ namespace core
          * \return Span<element_type, Count>  the subspan
          */
         template<std::size_t Count>
-        constexpr Span<element_type, Count> last() const;
+        constexpr Span<element_type, Count> last() const
+        {
+            return Span<element_type, Count>(data_ + (size_ - Count), Count);
+        }
 
         // SWS_CORE_01964
         /**
@@ -313,7 +414,10 @@ namespace core
          * \param[in] count the number of elements to take over
          * \return Span<element_type, dynamic_extent> 
          */
-        constexpr Span<element_type, dynamic_extent> last(index_type count) const;
+        constexpr Span<element_type, dynamic_extent> last(index_type count) const
+        {
+            return Span<element_type, dynamic_extent>(data_ + (size_ - count), count);
+        }
 
         // SWS_CORE_01965
         /**
@@ -328,7 +432,12 @@ namespace core
          * \return Span<element_type, SEE_BELOW>    the subspan
          */
         template<std::size_t Offset, std::size_t Count = dynamic_extent>
-        constexpr auto subspan() const -> Span<element_type, SEE_BELOW>;
+        constexpr auto subspan() const
+            -> Span<element_type, internal::SubspanExtent<Extent, Offset, Count>::value>
+        {
+            return Span<element_type, internal::SubspanExtent<Extent, Offset, Count>::value>(
+                data_ + Offset, (Count != dynamic_extent) ? Count : (size_ - Offset));
+        }
 
         // SWS_CORE_01966
         /**
@@ -338,7 +447,11 @@ namespace core
          * \param[in] count     the number of elements to take over
          * \return Span<element_type, dynamic_extent>     the subspan
          */
-        constexpr Span<element_type, dynamic_extent> subspan(index_type offset, index_type count=dynamic_extent) const;
+        constexpr Span<element_type, dynamic_extent> subspan(index_type offset, index_type count=dynamic_extent) const
+        {
+            return Span<element_type, dynamic_extent>(data_ + offset,
+                                                      (count != dynamic_extent) ? count : (size_ - offset));
+        }
 
         // SWS_CORE_01967
         /**
@@ -346,7 +459,10 @@ namespace core
          * 
          * \return index_type     the number of elements contained in this Span
          */
-        constexpr index_type size() const noexcept;
+        constexpr index_type size() const noexcept
+        {
+            return size_;
+        }
 
         // SWS_CORE_01968
         /**
@@ -354,7 +470,10 @@ namespace core
          * 
          * \return index_type     the number of bytes covered by this Span
          */
-        constexpr index_type size_bytes() const noexcept;
+        constexpr index_type size_bytes() const noexcept
+        {
+            return size_ * sizeof(element_type);
+        }
 
         // SWS_CORE_01969
         /**
@@ -363,7 +482,10 @@ namespace core
          * \return true     if this Span contains 0 elements
          * \return false    otherwise
          */
-        constexpr bool empty() const noexcept;
+        constexpr bool empty() const noexcept
+        {
+            return size_ == 0U;
+        }
 
         // SWS_CORE_01970
         /**
@@ -372,7 +494,10 @@ namespace core
          * \param[in] idx   the index into this Span
          * \return reference  the reference
          */
-        constexpr reference operator[](index_type idx) const;
+        constexpr reference operator[](index_type idx) const
+        {
+            return data_[idx];
+        }
 
         // SWS_CORE_01971
         /**
@@ -380,7 +505,10 @@ namespace core
          * 
          * \return pointer    the pointer
          */
-        constexpr pointer data() const noexcept;
+        constexpr pointer data() const noexcept
+        {
+            return data_;
+        }
 
         // SWS_CORE_01972
         /**
@@ -388,7 +516,10 @@ namespace core
          * 
          * \return iterator   the iterator
          */
-        constexpr iterator begin() const noexcept;
+        constexpr iterator begin() const noexcept
+        {
+            return data_;
+        }
 
         // SWS_CORE_01973
         /**
@@ -396,7 +527,10 @@ namespace core
          * 
          * \return iterator   the iterator
          */
-        constexpr iterator end() const noexcept;
+        constexpr iterator end() const noexcept
+        {
+            return data_ + size_;
+        }
 
         // SWS_CORE_01974
         /**
@@ -404,7 +538,10 @@ namespace core
          * 
          * \return const_iterator     the const_iterator
          */
-        constexpr const_iterator cbegin() const noexcept;
+        constexpr const_iterator cbegin() const noexcept
+        {
+            return data_;
+        }
 
         // SWS_CORE_01975
         /**
@@ -412,7 +549,10 @@ namespace core
          * 
          * \return const_iterator   the const_iterator
          */
-        constexpr const_iterator cend() const noexcept;
+        constexpr const_iterator cend() const noexcept
+        {
+            return data_ + size_;
+        }
 
         // SWS_CORE_01976
         /**
@@ -420,7 +560,10 @@ namespace core
          * 
          * \return reverse_iterator     the reverse_iterator
          */
-        constexpr reverse_iterator rbegin() const noexcept;
+        constexpr reverse_iterator rbegin() const noexcept
+        {
+            return reverse_iterator(end());
+        }
 
         // SWS_CORE_01977
         /**
@@ -428,7 +571,10 @@ namespace core
          * 
          * \return reverse_iterator     the reverse_iterator
          */
-        constexpr reverse_iterator rend() const noexcept;
+        constexpr reverse_iterator rend() const noexcept
+        {
+            return reverse_iterator(begin());
+        }
 
         // SWS_CORE_01978
         /**
@@ -436,7 +582,10 @@ namespace core
          * 
          * \return const_reverse_iterator     the const_reverse_iterator
          */
-        constexpr const_reverse_iterator crbegin() const noexcept;
+        constexpr const_reverse_iterator crbegin() const noexcept
+        {
+            return const_reverse_iterator(cend());
+        }
 
         // SWS_CORE_01979
         /**
@@ -444,12 +593,22 @@ namespace core
          * 
          * \return const_reverse_iterator   the reverse_iterator
          */
-        constexpr const_reverse_iterator crend() const noexcept;
+        constexpr const_reverse_iterator crend() const noexcept
+        {
+            return const_reverse_iterator(cbegin());
+        }
+
+    private:
+        pointer data_;
+        index_type size_;
     };
 
+    template<typename T, std::size_t Extent>
+    constexpr typename Span<T, Extent>::index_type Span<T, Extent>::extent;
+
     // SWS_CORE_01990
     /**
-     * \brief 
+     * \brief Create a new Span from the given pointer and size.
      * 
      * \tparam T    the type of elements
      * 
@@ -459,7 +618,10 @@ namespace core
      * \return Span<T>  the new Span
      */
     template<typename T>
-    constexpr Span<T> MakeSpan(T *ptr, typename Span<T>::index_type count);
+    constexpr Span<T> MakeSpan(T *ptr, typename Span<T>::index_type count)
+    {
+        return Span<T>(ptr, count);
+    }
 
     // SWS_CORE_01991
     /**
@@ -471,7 +633,10 @@ namespace core
      * \return Span<T>  the new Span
      */
     template<typename T>
-    constexpr Span<T> MakeSpan(T *firstElem, T *lastElem);
+    constexpr Span<T> MakeSpan(T *firstElem, T *lastElem)
+    {
+        return Span<T>(firstElem, lastElem);
+    }
 
     // SWS_CORE_01992
     /**
@@ -485,7 +650,10 @@ namespace core
      * \return Span<T, N>   the new Span
      */
     template<typename T, std::size_t N>
-    constexpr Span<T, N> MakeSpan(T(&arr)[N]) noexcept;
+    constexpr Span<T, N> MakeSpan(T(&arr)[N]) noexcept
+    {
+        return Span<T, N>(arr);
+    }
 
     // SWS_CORE_01993
     /**
@@ -496,7 +664,10 @@ namespace core
      * \return Span<typename Container::value_type>     the new Span
      */
     template<typename Container>
-    constexpr Span<typename Container::value_type> MakeSpan(Container &cont);
+    constexpr Span<typename Container::value_type> MakeSpan(Container &cont)
+    {
+        return Span<typename Container::value_type>(cont);
+    }
 
     // SWS_CORE_01994
     /**
@@ -507,7 +678,10 @@ namespace core
      * \return Span<typename Container::value_type const>   the new Span
      */
     template<typename Container>
-    constexpr Span<typename Container::value_type const> MakeSpan(Container const &cont);
+    constexpr Span<typename Container::value_type const> MakeSpan(Container const &cont)
+    {
+        return Span<typename Container::value_type const>(cont);
+    }
 
 } // namespace core
 } // namespace ara
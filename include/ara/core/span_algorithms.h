@@ -0,0 +1,102 @@
+/**
+ * \file span_algorithms.h
+ * \author Vincent WANG (vin@misday.com)
+ * \brief Byte kernels over Span: search, comparison, byte order, XOR and CRC.
+ *
+ * Shared by the payload processing of com, E2E and crypto. On x86-64 the implementation is picked once per
+ * process from the instruction sets of the CPU (AVX2, SSE4.2 or plain code), elsewhere the plain code is
+ * used. Every path gives the same results.
+ *
+ * \version 0.1
+ * \date 2021-11-12
+ *
+ * \copyright Copyright (c) 2021
+ *
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include "span.h"
+
+namespace ara
+{
+namespace core
+{
+    /**
+     * \brief Find the first occurrence of a byte.
+     *
+     * \param[in] data      the bytes to search
+     * \param[in] value     the byte to look for
+     * \return std::size_t  the index of the first byte equal to value, or data.size() if there is none
+     */
+    std::size_t FindByte(Span<std::uint8_t const> data, std::uint8_t value) noexcept;
+
+    /**
+     * \brief Check whether two byte ranges have the same size and contents.
+     *
+     * \param[in] lhs   the first bytes
+     * \param[in] rhs   the second bytes
+     * \return true     if both are equal
+     * \return false    otherwise
+     */
+    bool EqualBytes(Span<std::uint8_t const> lhs, Span<std::uint8_t const> rhs) noexcept;
+
+    /**
+     * \brief Compare two byte ranges lexicographically, as unsigned bytes.
+     *
+     * \param[in] lhs   the first bytes
+     * \param[in] rhs   the second bytes
+     * \return int      a negative value, zero or a positive value if lhs is less than, equal to or greater
+     *                  than rhs
+     */
+    int CompareBytes(Span<std::uint8_t const> lhs, Span<std::uint8_t const> rhs) noexcept;
+
+    /**
+     * \brief Reverse the byte order of every word of a buffer in place, e.g. to convert big-endian payload
+     * to host order.
+     *
+     * Bytes at the end that do not make up a whole word are left as they are, and so is the whole buffer if
+     * width is not 2, 4 or 8.
+     *
+     * \param[in,out] data  the words
+     * \param[in] width     the size of a word in bytes: 2, 4 or 8
+     */
+    void SwapByteOrder(Span<std::uint8_t> data, std::size_t width) noexcept;
+
+    /**
+     * \brief XOR a byte range into another one: target[i] ^= source[i] for the first
+     * min(target.size(), source.size()) bytes.
+     *
+     * The ranges shall either be the same or not overlap.
+     *
+     * \param[in,out] target    the bytes to modify
+     * \param[in] source        the bytes to XOR into target
+     */
+    void XorBytes(Span<std::uint8_t> target, Span<std::uint8_t const> source) noexcept;
+
+    /**
+     * \brief CRC-32 of IEEE 802.3 (polynomial 0x04C11DB7, reflected), as Crc_CalculateCRC32() of the
+     * AUTOSAR CRC library.
+     *
+     * A CRC over several pieces is computed by passing the result of one piece as crc of the next.
+     *
+     * \param[in] data      the bytes
+     * \param[in] crc       the CRC of the preceding bytes, 0 for the first piece
+     * \return std::uint32_t    the CRC of the preceding bytes and data
+     */
+    std::uint32_t Crc32(Span<std::uint8_t const> data, std::uint32_t crc = 0U) noexcept;
+
+    /**
+     * \brief CRC-32C (Castagnoli, polynomial 0x1EDC6F41, reflected), which SSE4.2 computes in hardware.
+     *
+     * A CRC over several pieces is computed by passing the result of one piece as crc of the next.
+     *
+     * \param[in] data      the bytes
+     * \param[in] crc       the CRC of the preceding bytes, 0 for the first piece
+     * \return std::uint32_t    the CRC of the preceding bytes and data
+     */
+    std::uint32_t Crc32C(Span<std::uint8_t const> data, std::uint32_t crc = 0U) noexcept;
+} // namespace core
+} // namespace ara
@@ -0,0 +1,554 @@
+/**
+ * \file static_string.h
+ * \author Vincent WANG (vin@misday.com)
+ * \brief
+ * \version 0.1
+ * \date 2021-11-12
+ *
+ * \copyright Copyright (c) 2021
+ *
+ */
+// R19-11
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <ostream>
+#include <stdexcept>
+#include <string>
+#include "abort.h"
+#include "string_view.h"
+
+namespace ara
+{
+namespace core
+{
+    /**
+     * \brief A string with the interface of BasicString whose characters live inside the object.
+     *
+     * A StaticString never allocates and is trivially copyable. Operations that would grow it beyond N
+     * characters fail instead and leave the string unchanged: they return false where BasicString returns
+     * *this. Operations that cannot grow it have the signatures of BasicString.
+     *
+     * \tparam N    the maximum number of characters, not counting the terminating '\0'
+     */
+    template <std::size_t N>
+    class StaticString final
+    {
+    public:
+        using traits_type = std::char_traits<char>;
+        using value_type = char;
+        using size_type = std::size_t;
+        using difference_type = std::ptrdiff_t;
+        using reference = char &;
+        using const_reference = char const &;
+        using pointer = char *;
+        using const_pointer = char const *;
+        using iterator = char *;
+        using const_iterator = char const *;
+        using reverse_iterator = std::reverse_iterator<iterator>;
+        using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+        static constexpr size_type npos = static_cast<size_type>(-1);
+
+        StaticString() noexcept : size_(0U)
+        {
+            data_[0] = '\0';
+        }
+
+        /**
+         * \brief Construct a new StaticString from a string literal, whose length is checked at compile time.
+         *
+         * \param[in] literal   the string literal
+         */
+        template <std::size_t M>
+        StaticString(char const (&literal)[M]) noexcept : size_(traits_type::length(literal))
+        {
+            static_assert((M - 1U) <= N, "string literal exceeds the capacity of the StaticString");
+            traits_type::copy(data_, literal, size_ + 1U);
+        }
+
+        /**
+         * \brief Implicitly convert this StaticString to a StringView.
+         *
+         * \return StringView   a view over the characters of this string
+         */
+        operator StringView() const noexcept
+        {
+            return StringView(data_, size_);
+        }
+
+        /**
+         * \brief Replace the contents with count characters from s.
+         *
+         * \param[in] s         the characters, may point into this string
+         * \param[in] count     the number of characters
+         * \return true         if the characters fit
+         * \return false        otherwise, the contents are unchanged
+         */
+        bool assign(char const *s, size_type count) noexcept
+        {
+            return Replace(0U, size_, s, count);
+        }
+
+        bool assign(StringView sv) noexcept
+        {
+            return assign(sv.data(), sv.size());
+        }
+
+        bool assign(size_type count, char c) noexcept
+        {
+            return ReplaceFill(0U, size_, count, c);
+        }
+
+        reference at(size_type pos)
+        {
+            if (pos >= size_)
+            {
+                internal::ThrowOrAbort<std::out_of_range>("StaticString::at");
+            }
+            return data_[pos];
+        }
+
+        const_reference at(size_type pos) const
+        {
+            if (pos >= size_)
+            {
+                internal::ThrowOrAbort<std::out_of_range>("StaticString::at");
+            }
+            return data_[pos];
+        }
+
+        reference operator[](size_type pos) noexcept
+        {
+            return data_[pos];
+        }
+
+        const_reference operator[](size_type pos) const noexcept
+        {
+            return data_[pos];
+        }
+
+        reference front() noexcept
+        {
+            return data_[0];
+        }
+
+        const_reference front() const noexcept
+        {
+            return data_[0];
+        }
+
+        reference back() noexcept
+        {
+            return data_[size_ - 1U];
+        }
+
+        const_reference back() const noexcept
+        {
+            return data_[size_ - 1U];
+        }
+
+        char const* data() const noexcept
+        {
+            return data_;
+        }
+
+        char* data() noexcept
+        {
+            return data_;
+        }
+
+        char const* c_str() const noexcept
+        {
+            return data_;
+        }
+
+        iterator begin() noexcept
+        {
+            return data_;
+        }
+
+        const_iterator begin() const noexcept
+        {
+            return data_;
+        }
+
+        const_iterator cbegin() const noexcept
+        {
+            return data_;
+        }
+
+        iterator end() noexcept
+        {
+            return data_ + size_;
+        }
+
+        const_iterator end() const noexcept
+        {
+            return data_ + size_;
+        }
+
+        const_iterator cend() const noexcept
+        {
+            return data_ + size_;
+        }
+
+        reverse_iterator rbegin() noexcept
+        {
+            return reverse_iterator(end());
+        }
+
+        const_reverse_iterator rbegin() const noexcept
+        {
+            return const_reverse_iterator(end());
+        }
+
+        reverse_iterator rend() noexcept
+        {
+            return reverse_iterator(begin());
+        }
+
+        const_reverse_iterator rend() const noexcept
+        {
+            return const_reverse_iterator(begin());
+        }
+
+        bool empty() const noexcept
+        {
+            return size_ == 0U;
+        }
+
+        /**
+         * \brief Check whether another character would overflow the string.
+         *
+         * \return true     if size() == capacity()
+         * \return false    otherwise
+         */
+        bool full() const noexcept
+        {
+            return size_ == N;
+        }
+
+        size_type size() const noexcept
+        {
+            return size_;
+        }
+
+        size_type length() const noexcept
+        {
+            return size_;
+        }
+
+        static constexpr size_type max_size() noexcept
+        {
+            return N;
+        }
+
+        static constexpr size_type capacity() noexcept
+        {
+            return N;
+        }
+
+        void clear() noexcept
+        {
+            size_ = 0U;
+            data_[0] = '\0';
+        }
+
+        /**
+         * \brief Insert count characters from s before index.
+         *
+         * \param[in] index     the position to insert at, must not exceed size()
+         * \param[in] s         the characters, may point into this string
+         * \param[in] count     the number of characters
+         * \return true         if the characters fit
+         * \return false        otherwise, the contents are unchanged
+         */
+        bool insert(size_type index, char const *s, size_type count)
+        {
+            CheckPosition(index, "StaticString::insert");
+            return Replace(index, 0U, s, count);
+        }
+
+        bool insert(size_type index, StringView sv)
+        {
+            return insert(index, sv.data(), sv.size());
+        }
+
+        bool insert(size_type index, size_type count, char c)
+        {
+            CheckPosition(index, "StaticString::insert");
+            return ReplaceFill(index, 0U, count, c);
+        }
+
+        StaticString& erase(size_type index = 0U, size_type count = npos)
+        {
+            CheckPosition(index, "StaticString::erase");
+            (void)Replace(index, std::min(count, size_ - index), nullptr, 0U);
+            return *this;
+        }
+
+        iterator erase(const_iterator first, const_iterator last) noexcept
+        {
+            size_type const index = static_cast<size_type>(first - data_);
+            (void)Replace(index, static_cast<size_type>(last - first), nullptr, 0U);
+            return data_ + index;
+        }
+
+        bool push_back(char c) noexcept
+        {
+            if (full())
+            {
+                return false;
+            }
+            data_[size_] = c;
+            data_[++size_] = '\0';
+            return true;
+        }
+
+        void pop_back() noexcept
+        {
+            data_[--size_] = '\0';
+        }
+
+        /**
+         * \brief Append count characters from s.
+         *
+         * \param[in] s         the characters, may point into this string
+         * \param[in] count     the number of characters
+         * \return true         if the characters fit
+         * \return false        otherwise, the contents are unchanged
+         */
+        bool append(char const *s, size_type count) noexcept
+        {
+            return Replace(size_, 0U, s, count);
+        }
+
+        bool append(StringView sv) noexcept
+        {
+            return append(sv.data(), sv.size());
+        }
+
+        bool append(size_type count, char c) noexcept
+        {
+            return ReplaceFill(size_, 0U, count, c);
+        }
+
+        bool replace(size_type pos, size_type count, StringView sv)
+        {
+            CheckPosition(pos, "StaticString::replace");
+            return Replace(pos, std::min(count, size_ - pos), sv.data(), sv.size());
+        }
+
+        StaticString substr(size_type pos = 0U, size_type count = npos) const
+        {
+            CheckPosition(pos, "StaticString::substr");
+            StaticString result;
+            (void)result.assign(data_ + pos, std::min(count, size_ - pos));
+            return result;
+        }
+
+        size_type copy(char *dest, size_type count, size_type pos = 0U) const
+        {
+            return StringView(*this).copy(dest, count, pos);
+        }
+
+        /**
+         * \brief Change the number of characters, filling new ones with c.
+         *
+         * \param[in] count     the new size
+         * \param[in] c         the fill character
+         * \return true         if count <= N
+         * \return false        otherwise, the contents are unchanged
+         */
+        bool resize(size_type count, char c = '\0') noexcept
+        {
+            if (count > size_)
+            {
+                return append(count - size_, c);
+            }
+            size_ = count;
+            data_[size_] = '\0';
+            return true;
+        }
+
+        void swap(StaticString &other) noexcept
+        {
+            std::swap(*this, other);
+        }
+
+        size_type find(StringView sv, size_type pos = 0U) const noexcept
+        {
+            return StringView(*this).find(sv, pos);
+        }
+
+        size_type find(char c, size_type pos = 0U) const noexcept
+        {
+            return StringView(*this).find(c, pos);
+        }
+
+        size_type rfind(StringView sv, size_type pos = npos) const noexcept
+        {
+            return StringView(*this).rfind(sv, pos);
+        }
+
+        size_type rfind(char c, size_type pos = npos) const noexcept
+        {
+            return StringView(*this).rfind(c, pos);
+        }
+
+        size_type find_first_of(StringView sv, size_type pos = 0U) const noexcept
+        {
+            return StringView(*this).find_first_of(sv, pos);
+        }
+
+        size_type find_last_of(StringView sv, size_type pos = npos) const noexcept
+        {
+            return StringView(*this).find_last_of(sv, pos);
+        }
+
+        size_type find_first_not_of(StringView sv, size_type pos = 0U) const noexcept
+        {
+            return StringView(*this).find_first_not_of(sv, pos);
+        }
+
+        size_type find_last_not_of(StringView sv, size_type pos = npos) const noexcept
+        {
+            return StringView(*this).find_last_not_of(sv, pos);
+        }
+
+        int compare(StringView sv) const noexcept
+        {
+            return StringView(*this).compare(sv);
+        }
+
+    private:
+        void CheckPosition(size_type pos, char const *what) const
+        {
+            if (pos > size_)
+            {
+                internal::ThrowOrAbort<std::out_of_range>(what);
+            }
+        }
+
+        bool Replace(size_type pos, size_type count1, char const *s, size_type count2) noexcept
+        {
+            if ((count2 > count1) && ((count2 - count1) > (N - size_)))
+            {
+                return false;
+            }
+            internal::ReplaceInPlace(data_, size_, pos, count1, s, count2);
+            size_ = size_ - count1 + count2;
+            data_[size_] = '\0';
+            return true;
+        }
+
+        bool ReplaceFill(size_type pos, size_type count1, size_type count2, char c) noexcept
+        {
+            if ((count2 > count1) && ((count2 - count1) > (N - size_)))
+            {
+                return false;
+            }
+            traits_type::move(data_ + pos + count2, data_ + pos + count1, size_ - pos - count1);
+            traits_type::assign(data_ + pos, count2, c);
+            size_ = size_ - count1 + count2;
+            data_[size_] = '\0';
+            return true;
+        }
+
+        size_type size_;
+        char data_[N + 1U];
+    };
+
+    template <std::size_t N>
+    constexpr typename StaticString<N>::size_type StaticString<N>::npos;
+
+    template <std::size_t N, std::size_t M>
+    inline bool operator==(StaticString<N> const &lhs, StaticString<M> const &rhs) noexcept
+    {
+        return StringView(lhs) == StringView(rhs);
+    }
+
+    template <std::size_t N>
+    inline bool operator==(StaticString<N> const &lhs, char const *rhs) noexcept
+    {
+        return StringView(lhs) == StringView(rhs);
+    }
+
+    template <std::size_t N>
+    inline bool operator==(char const *lhs, StaticString<N> const &rhs) noexcept
+    {
+        return StringView(lhs) == StringView(rhs);
+    }
+
+    template <std::size_t N, std::size_t M>
+    inline bool operator!=(StaticString<N> const &lhs, StaticString<M> const &rhs) noexcept
+    {
+        return !(lhs == rhs);
+    }
+
+    template <std::size_t N>
+    inline bool operator!=(StaticString<N> const &lhs, char const *rhs) noexcept
+    {
+        return !(lhs == rhs);
+    }
+
+    template <std::size_t N>
+    inline bool operator!=(char const *lhs, StaticString<N> const &rhs) noexcept
+    {
+        return !(lhs == rhs);
+    }
+
+    template <std::size_t N, std::size_t M>
+    inline bool operator<(StaticString<N> const &lhs, StaticString<M> const &rhs) noexcept
+    {
+        return lhs.compare(rhs) < 0;
+    }
+
+    template <std::size_t N, std::size_t M>
+    inline bool operator<=(StaticString<N> const &lhs, StaticString<M> const &rhs) noexcept
+    {
+        return lhs.compare(rhs) <= 0;
+    }
+
+    template <std::size_t N, std::size_t M>
+    inline bool operator>(StaticString<N> const &lhs, StaticString<M> const &rhs) noexcept
+    {
+        return lhs.compare(rhs) > 0;
+    }
+
+    template <std::size_t N, std::size_t M>
+    inline bool operator>=(StaticString<N> const &lhs, StaticString<M> const &rhs) noexcept
+    {
+        return lhs.compare(rhs) >= 0;
+    }
+
+    template <std::size_t N>
+    inline std::ostream& operator<<(std::ostream &os, StaticString<N> const &s)
+    {
+        return os << StringView(s);
+    }
+
+    template <std::size_t N>
+    void swap(StaticString<N> &lhs, StaticString<N> &rhs) noexcept
+    {
+        lhs.swap(rhs);
+    }
+}
+}
+
+namespace std
+{
+    template <std::size_t N>
+    struct hash<ara::core::StaticString<N>>
+    {
+        std::size_t operator()(ara::core::StaticString<N> const &s) const noexcept
+        {
+            return ara::core::internal::HashBytes(s.data(), s.size());
+        }
+    };
+} // namespace std
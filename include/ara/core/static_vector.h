@@ -0,0 +1,615 @@
+/**
+ * \file static_vector.h
+ * \author Vincent WANG (vin@misday.com)
+ * \brief
+ * \version 0.1
+ * \date 2021-11-12
+ *
+ * \copyright Copyright (c) 2021
+ *
+ */
+// R19-11
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include "abort.h"
+
+namespace ara
+{
+namespace core
+{
+    namespace internal
+    {
+        /**
+         * \brief Element storage of StaticVector, for element types that are not trivially copyable.
+         *
+         */
+        template <typename T, std::size_t N, bool = std::is_trivially_copyable<T>::value>
+        class StaticVectorStorage
+        {
+        protected:
+            StaticVectorStorage() noexcept : size_(0U)
+            {
+            }
+
+            StaticVectorStorage(StaticVectorStorage const &other) : size_(0U)
+            {
+                for (; size_ < other.size_; ++size_)
+                {
+                    new (Data() + size_) T(other.Data()[size_]);
+                }
+            }
+
+            StaticVectorStorage(StaticVectorStorage &&other) noexcept(std::is_nothrow_move_constructible<T>::value)
+                : size_(0U)
+            {
+                for (; size_ < other.size_; ++size_)
+                {
+                    new (Data() + size_) T(std::move(other.Data()[size_]));
+                }
+            }
+
+            StaticVectorStorage& operator=(StaticVectorStorage const &other)
+            {
+                if (this != &other)
+                {
+                    Destroy(0U);
+                    for (; size_ < other.size_; ++size_)
+                    {
+                        new (Data() + size_) T(other.Data()[size_]);
+                    }
+                }
+                return *this;
+            }
+
+            StaticVectorStorage& operator=(StaticVectorStorage &&other) noexcept(std::is_nothrow_move_constructible<T>::value)
+            {
+                if (this != &other)
+                {
+                    Destroy(0U);
+                    for (; size_ < other.size_; ++size_)
+                    {
+                        new (Data() + size_) T(std::move(other.Data()[size_]));
+                    }
+                }
+                return *this;
+            }
+
+            ~StaticVectorStorage()
+            {
+                Destroy(0U);
+            }
+
+            T* Data() noexcept
+            {
+                return reinterpret_cast<T *>(storage_);
+            }
+
+            T const* Data() const noexcept
+            {
+                return reinterpret_cast<T const *>(storage_);
+            }
+
+            /**
+             * \brief Destroy the elements from index first on.
+             *
+             * \param[in] first     the new size
+             */
+            void Destroy(std::size_t first) noexcept
+            {
+                while (size_ > first)
+                {
+                    Data()[--size_].~T();
+                }
+            }
+
+            typename std::aligned_storage<sizeof(T), alignof(T)>::type storage_[N];
+            std::size_t size_;
+        };
+
+        /**
+         * \brief Element storage of StaticVector for trivially copyable element types, itself trivially copyable.
+         *
+         */
+        template <typename T, std::size_t N>
+        class StaticVectorStorage<T, N, true>
+        {
+        protected:
+            StaticVectorStorage() noexcept : size_(0U)
+            {
+            }
+
+            T* Data() noexcept
+            {
+                return reinterpret_cast<T *>(storage_);
+            }
+
+            T const* Data() const noexcept
+            {
+                return reinterpret_cast<T const *>(storage_);
+            }
+
+            void Destroy(std::size_t first) noexcept
+            {
+                size_ = std::min(size_, first);
+            }
+
+            typename std::aligned_storage<sizeof(T), alignof(T)>::type storage_[N];
+            std::size_t size_;
+        };
+    } // namespace internal
+
+    /**
+     * \brief A container with the interface of Vector whose elements live inside the object.
+     *
+     * A StaticVector never allocates. Operations that would grow it beyond N elements fail instead and leave
+     * the container unchanged: push_back(), emplace_back(), resize() and assign() return false, insert() and
+     * emplace() return end(). A StaticVector is trivially copyable if T is, so it can be memcpy'd into
+     * message payloads and log records.
+     *
+     * \tparam T    the type of contained values
+     * \tparam N    the maximum number of elements
+     */
+    template <typename T, std::size_t N>
+    class StaticVector final : private internal::StaticVectorStorage<T, N>
+    {
+        static_assert(N > 0U, "a StaticVector needs a capacity of at least one element");
+
+        using Storage = internal::StaticVectorStorage<T, N>;
+        using Storage::Data;
+        using Storage::Destroy;
+        using Storage::size_;
+
+    public:
+        using value_type = T;
+        using size_type = std::size_t;
+        using difference_type = std::ptrdiff_t;
+        using reference = T &;
+        using const_reference = T const &;
+        using pointer = T *;
+        using const_pointer = T const *;
+        using iterator = T *;
+        using const_iterator = T const *;
+        using reverse_iterator = std::reverse_iterator<iterator>;
+        using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+        StaticVector() noexcept = default;
+
+        /**
+         * \brief Replace the contents with count copies of value.
+         *
+         * \param[in] count     the number of elements
+         * \param[in] value     the value to copy
+         * \return true         if count elements fit
+         * \return false        otherwise, the contents are unchanged
+         */
+        bool assign(size_type count, T const &value)
+        {
+            if (count > N)
+            {
+                return false;
+            }
+            clear();
+            return resize(count, value);
+        }
+
+        /**
+         * \brief Replace the contents with the elements of [first, last).
+         *
+         * \param[in] first     the first element to copy
+         * \param[in] last      the end of the range
+         * \return true         if all elements fit
+         * \return false        otherwise, the contents are unchanged
+         */
+        template <typename ForwardIt, typename = typename std::iterator_traits<ForwardIt>::iterator_category>
+        bool assign(ForwardIt first, ForwardIt last)
+        {
+            if (static_cast<size_type>(std::distance(first, last)) > N)
+            {
+                return false;
+            }
+            clear();
+            for (; first != last; ++first)
+            {
+                Construct(*first);
+            }
+            return true;
+        }
+
+        bool assign(std::initializer_list<T> values)
+        {
+            return assign(values.begin(), values.end());
+        }
+
+        reference at(size_type pos)
+        {
+            if (pos >= size_)
+            {
+                internal::ThrowOrAbort<std::out_of_range>("StaticVector::at");
+            }
+            return Data()[pos];
+        }
+
+        const_reference at(size_type pos) const
+        {
+            if (pos >= size_)
+            {
+                internal::ThrowOrAbort<std::out_of_range>("StaticVector::at");
+            }
+            return Data()[pos];
+        }
+
+        reference operator[](size_type pos) noexcept
+        {
+            return Data()[pos];
+        }
+
+        const_reference operator[](size_type pos) const noexcept
+        {
+            return Data()[pos];
+        }
+
+        reference front() noexcept
+        {
+            return Data()[0];
+        }
+
+        const_reference front() const noexcept
+        {
+            return Data()[0];
+        }
+
+        reference back() noexcept
+        {
+            return Data()[size_ - 1U];
+        }
+
+        const_reference back() const noexcept
+        {
+            return Data()[size_ - 1U];
+        }
+
+        T* data() noexcept
+        {
+            return Data();
+        }
+
+        T const* data() const noexcept
+        {
+            return Data();
+        }
+
+        iterator begin() noexcept
+        {
+            return Data();
+        }
+
+        const_iterator begin() const noexcept
+        {
+            return Data();
+        }
+
+        const_iterator cbegin() const noexcept
+        {
+            return Data();
+        }
+
+        iterator end() noexcept
+        {
+            return Data() + size_;
+        }
+
+        const_iterator end() const noexcept
+        {
+            return Data() + size_;
+        }
+
+        const_iterator cend() const noexcept
+        {
+            return Data() + size_;
+        }
+
+        reverse_iterator rbegin() noexcept
+        {
+            return reverse_iterator(end());
+        }
+
+        const_reverse_iterator rbegin() const noexcept
+        {
+            return const_reverse_iterator(end());
+        }
+
+        const_reverse_iterator crbegin() const noexcept
+        {
+            return const_reverse_iterator(end());
+        }
+
+        reverse_iterator rend() noexcept
+        {
+            return reverse_iterator(begin());
+        }
+
+        const_reverse_iterator rend() const noexcept
+        {
+            return const_reverse_iterator(begin());
+        }
+
+        const_reverse_iterator crend() const noexcept
+        {
+            return const_reverse_iterator(begin());
+        }
+
+        bool empty() const noexcept
+        {
+            return size_ == 0U;
+        }
+
+        /**
+         * \brief Check whether another element would overflow the container.
+         *
+         * \return true     if size() == capacity()
+         * \return false    otherwise
+         */
+        bool full() const noexcept
+        {
+            return size_ == N;
+        }
+
+        size_type size() const noexcept
+        {
+            return size_;
+        }
+
+        static constexpr size_type max_size() noexcept
+        {
+            return N;
+        }
+
+        static constexpr size_type capacity() noexcept
+        {
+            return N;
+        }
+
+        /**
+         * \brief Check whether newCapacity elements fit; a StaticVector never reallocates.
+         *
+         * \param[in] newCapacity   the number of elements
+         * \return true             if newCapacity <= N
+         * \return false            otherwise
+         */
+        bool reserve(size_type newCapacity) const noexcept
+        {
+            return newCapacity <= N;
+        }
+
+        void clear() noexcept
+        {
+            Destroy(0U);
+        }
+
+        iterator insert(const_iterator pos, T const &value)
+        {
+            return emplace(pos, value);
+        }
+
+        iterator insert(const_iterator pos, T &&value)
+        {
+            return emplace(pos, std::move(value));
+        }
+
+        iterator insert(const_iterator pos, size_type count, T const &value)
+        {
+            iterator const p = begin() + (pos - begin());
+            if (count > (N - size_))
+            {
+                return end();
+            }
+            iterator const last = end();
+            for (size_type i = 0U; i < count; ++i)
+            {
+                Construct(value);
+            }
+            std::rotate(p, last, end());
+            return p;
+        }
+
+        template <typename ForwardIt, typename = typename std::iterator_traits<ForwardIt>::iterator_category>
+        iterator insert(const_iterator pos, ForwardIt first, ForwardIt last)
+        {
+            iterator const p = begin() + (pos - begin());
+            if (static_cast<size_type>(std::distance(first, last)) > (N - size_))
+            {
+                return end();
+            }
+            iterator const oldEnd = end();
+            for (; first != last; ++first)
+            {
+                Construct(*first);
+            }
+            std::rotate(p, oldEnd, end());
+            return p;
+        }
+
+        iterator insert(const_iterator pos, std::initializer_list<T> values)
+        {
+            return insert(pos, values.begin(), values.end());
+        }
+
+        /**
+         * \brief Construct an element in place before pos.
+         *
+         * \param[in] pos       the position to insert at
+         * \param[in] args      the constructor arguments
+         * \return iterator     the new element, or end() if the container is full
+         */
+        template <typename... Args>
+        iterator emplace(const_iterator pos, Args &&... args)
+        {
+            iterator const p = begin() + (pos - begin());
+            if (full())
+            {
+                return end();
+            }
+            Construct(std::forward<Args>(args)...);
+            std::rotate(p, end() - 1, end());
+            return p;
+        }
+
+        iterator erase(const_iterator pos)
+        {
+            return erase(pos, pos + 1);
+        }
+
+        iterator erase(const_iterator first, const_iterator last)
+        {
+            iterator const p = begin() + (first - begin());
+            if (first != last)
+            {
+                iterator const newEnd = std::move(begin() + (last - begin()), end(), p);
+                Destroy(static_cast<size_type>(newEnd - begin()));
+            }
+            return p;
+        }
+
+        /**
+         * \brief Append a copy of value.
+         *
+         * \param[in] value     the value
+         * \return true         if the value was appended
+         * \return false        if the container is full
+         */
+        bool push_back(T const &value)
+        {
+            return emplace_back(value);
+        }
+
+        bool push_back(T &&value)
+        {
+            return emplace_back(std::move(value));
+        }
+
+        /**
+         * \brief Construct an element in place at the end.
+         *
+         * \param[in] args      the constructor arguments
+         * \return true         if the element was appended
+         * \return false        if the container is full
+         */
+        template <typename... Args>
+        bool emplace_back(Args &&... args)
+        {
+            if (full())
+            {
+                return false;
+            }
+            Construct(std::forward<Args>(args)...);
+            return true;
+        }
+
+        void pop_back() noexcept
+        {
+            Destroy(size_ - 1U);
+        }
+
+        /**
+         * \brief Change the number of elements, value-initializing new ones.
+         *
+         * \param[in] count     the new size
+         * \return true         if count <= N
+         * \return false        otherwise, the contents are unchanged
+         */
+        bool resize(size_type count)
+        {
+            if (count > N)
+            {
+                return false;
+            }
+            Destroy(count);
+            while (size_ < count)
+            {
+                Construct();
+            }
+            return true;
+        }
+
+        bool resize(size_type count, T const &value)
+        {
+            if (count > N)
+            {
+                return false;
+            }
+            Destroy(count);
+            while (size_ < count)
+            {
+                Construct(value);
+            }
+            return true;
+        }
+
+        void swap(StaticVector &other)
+        {
+            StaticVector temp(std::move(other));
+            other = std::move(*this);
+            *this = std::move(temp);
+        }
+
+    private:
+        template <typename... Args>
+        void Construct(Args &&... args)
+        {
+            new (Data() + size_) T(std::forward<Args>(args)...);
+            ++size_;
+        }
+    };
+
+    template <typename T, std::size_t N>
+    inline bool operator==(StaticVector<T, N> const &lhs, StaticVector<T, N> const &rhs)
+    {
+        return (lhs.size() == rhs.size()) && std::equal(lhs.begin(), lhs.end(), rhs.begin());
+    }
+
+    template <typename T, std::size_t N>
+    inline bool operator!=(StaticVector<T, N> const &lhs, StaticVector<T, N> const &rhs)
+    {
+        return !(lhs == rhs);
+    }
+
+    template <typename T, std::size_t N>
+    inline bool operator<(StaticVector<T, N> const &lhs, StaticVector<T, N> const &rhs)
+    {
+        return std::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+    }
+
+    template <typename T, std::size_t N>
+    inline bool operator<=(StaticVector<T, N> const &lhs, StaticVector<T, N> const &rhs)
+    {
+        return !(rhs < lhs);
+    }
+
+    template <typename T, std::size_t N>
+    inline bool operator>(StaticVector<T, N> const &lhs, StaticVector<T, N> const &rhs)
+    {
+        return rhs < lhs;
+    }
+
+    template <typename T, std::size_t N>
+    inline bool operator>=(StaticVector<T, N> const &lhs, StaticVector<T, N> const &rhs)
+    {
+        return !(lhs < rhs);
+    }
+
+    template <typename T, std::size_t N>
+    void swap(StaticVector<T, N> &lhs, StaticVector<T, N> &rhs)
+    {
+        lhs.swap(rhs);
+    }
+}
+}
@@ -1,17 +1,32 @@
 /**
  * \file string.h
  * \author Vincent WANG (vin@misday.com)
- * \brief 
+ * \brief
  * \version 0.1
  * \date 2021-11-12
- * 
+ *
  * \copyright Copyright (c) 2021
- * 
+ *
  */
 // R19-11
 
 #pragma once
 
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <ostream>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include "abort.h"
+#include "memory_resource.h"
 #include "string_view.h"
 
 namespace ara
@@ -19,94 +34,1070 @@ namespace ara
 namespace core
 {
     // SWS_CORE_03000
-    template <typename Allocator = IMPLEMENTATION_DEFINED>
+    /**
+     * \brief A sequence of characters, modelled after std::string.
+     *
+     * Strings of up to kInlineCapacity characters, which covers typical shortName paths and key-value
+     * storage keys, are stored inside the object and never allocate. Longer strings take their memory from
+     * the allocator, by default from GetDefaultMemoryResource(); growth at least doubles the capacity.
+     *
+     * \tparam Allocator    the allocator to use for any memory allocation needs
+     */
+    template <typename Allocator = PolymorphicAllocator<char>>
     class BasicString
     {
+        using AllocTraits = std::allocator_traits<Allocator>;
+
+        // objects convertible to StringView, except character pointers which take the overloads for C strings
+        template <typename T>
+        using EnableIfViewLike = typename std::enable_if<std::is_convertible<T const &, StringView>::value
+                                                         && !std::is_convertible<T const &, char const *>::value>::type;
+
+    public:
+        using traits_type = std::char_traits<char>;
+        using value_type = char;
+        using allocator_type = Allocator;
         using size_type = std::size_t;
-        using const_iterator = implementation_defined;
+        using difference_type = std::ptrdiff_t;
+        using reference = char &;
+        using const_reference = char const &;
+        using pointer = char *;
+        using const_pointer = char const *;
+        using iterator = char *;
+        using const_iterator = char const *;
+        using reverse_iterator = std::reverse_iterator<iterator>;
+        using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+        static constexpr size_type npos = static_cast<size_type>(-1);
+
+        /**
+         * \brief Number of characters stored without allocation.
+         *
+         */
+        static constexpr size_type kInlineCapacity = 63U;
+
+        BasicString() noexcept(noexcept(Allocator())) : BasicString(Allocator())
+        {
+        }
+
+        explicit BasicString(Allocator const &alloc) noexcept : alloc_(alloc), data_(inline_), size_(0U)
+        {
+            inline_[0] = '\0';
+        }
+
+        BasicString(size_type count, char c, Allocator const &alloc = Allocator()) : BasicString(alloc)
+        {
+            append(count, c);
+        }
+
+        BasicString(char const *s, size_type count, Allocator const &alloc = Allocator()) : BasicString(alloc)
+        {
+            append(s, count);
+        }
+
+        BasicString(char const *s, Allocator const &alloc = Allocator()) : BasicString(alloc)
+        {
+            append(s, traits_type::length(s));
+        }
+
+        template <typename InputIt, typename = typename std::iterator_traits<InputIt>::iterator_category>
+        BasicString(InputIt first, InputIt last, Allocator const &alloc = Allocator()) : BasicString(alloc)
+        {
+            for (; first != last; ++first)
+            {
+                push_back(*first);
+            }
+        }
+
+        BasicString(std::initializer_list<char> chars, Allocator const &alloc = Allocator()) : BasicString(alloc)
+        {
+            append(chars.begin(), chars.size());
+        }
+
+        BasicString(BasicString const &other)
+            : BasicString(other, AllocTraits::select_on_container_copy_construction(other.alloc_))
+        {
+        }
+
+        BasicString(BasicString const &other, Allocator const &alloc) : BasicString(alloc)
+        {
+            append(other.data_, other.size_);
+        }
+
+        BasicString(BasicString const &other, size_type pos, size_type count = npos, Allocator const &alloc = Allocator())
+            : BasicString(alloc)
+        {
+            append(other, pos, count);
+        }
+
+        BasicString(BasicString &&other) noexcept : alloc_(other.alloc_), data_(inline_), size_(0U)
+        {
+            StealOrCopy(other);
+        }
+
+        BasicString(BasicString &&other, Allocator const &alloc) : alloc_(alloc), data_(inline_), size_(0U)
+        {
+            if (alloc_ == other.alloc_)
+            {
+                StealOrCopy(other);
+            }
+            else
+            {
+                inline_[0] = '\0';
+                append(other.data_, other.size_);
+            }
+        }
+
+        ~BasicString()
+        {
+            Release();
+        }
 
         // SWS_CORE_03301
-        operator StringView() const noexcept;
+        /**
+         * \brief Implicitly convert this BasicString to a StringView.
+         *
+         * \return StringView   a view over the characters of this string
+         */
+        operator StringView() const noexcept
+        {
+            return StringView(data_, size_);
+        }
 
         // SWS_CORE_03302
-        explicit BasicString(StringView sv);
+        /**
+         * \brief Construct a new BasicString from a StringView.
+         *
+         * \param[in] sv    the StringView
+         */
+        explicit BasicString(StringView sv, Allocator const &alloc = Allocator()) : BasicString(alloc)
+        {
+            append(sv.data(), sv.size());
+        }
 
         // SWS_CORE_03303
-        typename <typename T>
-        BasicString(T const& t, size_type pos, size_type n);
+        /**
+         * \brief Construct a new BasicString from a substring of an object convertible to StringView.
+         *
+         * \param[in] t     the object
+         * \param[in] pos   the start of the substring
+         * \param[in] n     the length of the substring
+         */
+        template <typename T, typename = EnableIfViewLike<T>>
+        BasicString(T const &t, size_type pos, size_type n, Allocator const &alloc = Allocator()) : BasicString(alloc)
+        {
+            append(t, pos, n);
+        }
+
+        BasicString& operator=(BasicString const &other)
+        {
+            return (this != &other) ? assign(other.data_, other.size_) : *this;
+        }
+
+        BasicString& operator=(BasicString &&other) noexcept(false)
+        {
+            if (this != &other)
+            {
+                if (alloc_ == other.alloc_)
+                {
+                    Release();
+                    data_ = inline_;
+                    StealOrCopy(other);
+                }
+                else
+                {
+                    assign(other.data_, other.size_);
+                }
+            }
+            return *this;
+        }
+
+        BasicString& operator=(char const *s)
+        {
+            return assign(s, traits_type::length(s));
+        }
+
+        BasicString& operator=(char c)
+        {
+            return assign(1U, c);
+        }
+
+        BasicString& operator=(std::initializer_list<char> chars)
+        {
+            return assign(chars.begin(), chars.size());
+        }
 
         // SWS_CORE_03304
-        BasicString& operator=(StringView sv);
+        /**
+         * \brief Assign a StringView to this BasicString.
+         *
+         * \param[in] sv    the StringView
+         * \return BasicString&     *this
+         */
+        BasicString& operator=(StringView sv)
+        {
+            return assign(sv.data(), sv.size());
+        }
+
+        BasicString& assign(size_type count, char c)
+        {
+            return ReplaceFill(0U, size_, count, c);
+        }
+
+        BasicString& assign(char const *s, size_type count)
+        {
+            return ReplaceCopy(0U, size_, s, count);
+        }
+
+        BasicString& assign(char const *s)
+        {
+            return assign(s, traits_type::length(s));
+        }
+
+        BasicString& assign(BasicString const &other)
+        {
+            return assign(other.data_, other.size_);
+        }
+
+        BasicString& assign(BasicString &&other)
+        {
+            return *this = std::move(other);
+        }
 
         // SWS_CORE_03305
-        BasicString& assign(StringView sv);
+        /**
+         * \brief Assign a StringView to this BasicString.
+         *
+         * \param[in] sv    the StringView
+         * \return BasicString&     *this
+         */
+        BasicString& assign(StringView sv)
+        {
+            return assign(sv.data(), sv.size());
+        }
 
         // SWS_CORE_03306
-        template <typename T>
-        BasicString& assign(T const& t, size_type pos, size_type n = npos);
+        /**
+         * \brief Assign a substring of an object convertible to StringView to this BasicString.
+         *
+         * \param[in] t     the object
+         * \param[in] pos   the start of the substring
+         * \param[in] n     the length of the substring
+         * \return BasicString&     *this
+         */
+        template <typename T, typename = EnableIfViewLike<T>>
+        BasicString& assign(T const &t, size_type pos, size_type n = npos)
+        {
+            StringView const sv = StringView(t).substr(pos, n);
+            return assign(sv.data(), sv.size());
+        }
 
-        // SWS_CORE_03307
-        BasicString& operator+= (StringView sv);
+        allocator_type get_allocator() const
+        {
+            return alloc_;
+        }
 
-        // SWS_CORE_03308
-        BasicString& append(StringView sv);
+        reference at(size_type pos)
+        {
+            CheckPosition(pos + 1U, "BasicString::at");
+            return data_[pos];
+        }
 
-        // SWS_CORE_03309
-        template <typename T>
-        BasicString& append(T const& t, size_type pos, size_type n = npos);
+        const_reference at(size_type pos) const
+        {
+            CheckPosition(pos + 1U, "BasicString::at");
+            return data_[pos];
+        }
+
+        reference operator[](size_type pos) noexcept
+        {
+            return data_[pos];
+        }
+
+        const_reference operator[](size_type pos) const noexcept
+        {
+            return data_[pos];
+        }
+
+        reference front() noexcept
+        {
+            return data_[0];
+        }
+
+        const_reference front() const noexcept
+        {
+            return data_[0];
+        }
+
+        reference back() noexcept
+        {
+            return data_[size_ - 1U];
+        }
+
+        const_reference back() const noexcept
+        {
+            return data_[size_ - 1U];
+        }
+
+        char const* data() const noexcept
+        {
+            return data_;
+        }
+
+        char* data() noexcept
+        {
+            return data_;
+        }
+
+        char const* c_str() const noexcept
+        {
+            return data_;
+        }
+
+        iterator begin() noexcept
+        {
+            return data_;
+        }
+
+        const_iterator begin() const noexcept
+        {
+            return data_;
+        }
+
+        const_iterator cbegin() const noexcept
+        {
+            return data_;
+        }
+
+        iterator end() noexcept
+        {
+            return data_ + size_;
+        }
+
+        const_iterator end() const noexcept
+        {
+            return data_ + size_;
+        }
+
+        const_iterator cend() const noexcept
+        {
+            return data_ + size_;
+        }
+
+        reverse_iterator rbegin() noexcept
+        {
+            return reverse_iterator(end());
+        }
+
+        const_reverse_iterator rbegin() const noexcept
+        {
+            return const_reverse_iterator(end());
+        }
+
+        const_reverse_iterator crbegin() const noexcept
+        {
+            return const_reverse_iterator(end());
+        }
+
+        reverse_iterator rend() noexcept
+        {
+            return reverse_iterator(begin());
+        }
+
+        const_reverse_iterator rend() const noexcept
+        {
+            return const_reverse_iterator(begin());
+        }
+
+        const_reverse_iterator crend() const noexcept
+        {
+            return const_reverse_iterator(begin());
+        }
+
+        bool empty() const noexcept
+        {
+            return size_ == 0U;
+        }
+
+        size_type size() const noexcept
+        {
+            return size_;
+        }
+
+        size_type length() const noexcept
+        {
+            return size_;
+        }
+
+        size_type max_size() const noexcept
+        {
+            return std::min<size_type>(AllocTraits::max_size(alloc_), std::numeric_limits<difference_type>::max()) - 1U;
+        }
+
+        size_type capacity() const noexcept
+        {
+            return IsInline() ? kInlineCapacity : capacity_;
+        }
+
+        void reserve(size_type newCapacity)
+        {
+            if (newCapacity > capacity())
+            {
+                Reallocate(newCapacity);
+            }
+        }
+
+        void shrink_to_fit()
+        {
+            if (!IsInline() && (size_ < capacity_))
+            {
+                Reallocate(size_);
+            }
+        }
+
+        void clear() noexcept
+        {
+            size_ = 0U;
+            data_[0] = '\0';
+        }
+
+        BasicString& insert(size_type index, size_type count, char c)
+        {
+            CheckPosition(index, "BasicString::insert");
+            return ReplaceFill(index, 0U, count, c);
+        }
+
+        BasicString& insert(size_type index, char const *s)
+        {
+            return insert(index, s, traits_type::length(s));
+        }
+
+        BasicString& insert(size_type index, char const *s, size_type count)
+        {
+            CheckPosition(index, "BasicString::insert");
+            return ReplaceCopy(index, 0U, s, count);
+        }
+
+        BasicString& insert(size_type index, BasicString const &other)
+        {
+            return insert(index, other.data_, other.size_);
+        }
+
+        iterator insert(const_iterator pos, char c)
+        {
+            size_type const index = static_cast<size_type>(pos - data_);
+            ReplaceFill(index, 0U, 1U, c);
+            return data_ + index;
+        }
+
+        iterator insert(const_iterator pos, size_type count, char c)
+        {
+            size_type const index = static_cast<size_type>(pos - data_);
+            ReplaceFill(index, 0U, count, c);
+            return data_ + index;
+        }
 
         // SWS_CORE_03310
-        BasicString& insert(size_type pos, StringView sv);
+        /**
+         * \brief Insert a StringView into this BasicString.
+         *
+         * \param[in] pos   the position to insert at
+         * \param[in] sv    the StringView
+         * \return BasicString&     *this
+         */
+        BasicString& insert(size_type pos, StringView sv)
+        {
+            return insert(pos, sv.data(), sv.size());
+        }
 
         // SWS_CORE_03311
-        template <typename T>
-        BasicString& insert(size_type pos1, T const& t, size_type pos2, size_type n = npos);
+        /**
+         * \brief Insert a substring of an object convertible to StringView into this BasicString.
+         *
+         * \param[in] pos1  the position to insert at
+         * \param[in] t     the object
+         * \param[in] pos2  the start of the substring
+         * \param[in] n     the length of the substring
+         * \return BasicString&     *this
+         */
+        template <typename T, typename = EnableIfViewLike<T>>
+        BasicString& insert(size_type pos1, T const &t, size_type pos2, size_type n = npos)
+        {
+            StringView const sv = StringView(t).substr(pos2, n);
+            return insert(pos1, sv.data(), sv.size());
+        }
+
+        BasicString& erase(size_type index = 0U, size_type count = npos)
+        {
+            CheckPosition(index, "BasicString::erase");
+            return ReplaceCopy(index, std::min(count, size_ - index), nullptr, 0U);
+        }
+
+        iterator erase(const_iterator pos)
+        {
+            size_type const index = static_cast<size_type>(pos - data_);
+            ReplaceCopy(index, 1U, nullptr, 0U);
+            return data_ + index;
+        }
+
+        iterator erase(const_iterator first, const_iterator last)
+        {
+            size_type const index = static_cast<size_type>(first - data_);
+            ReplaceCopy(index, static_cast<size_type>(last - first), nullptr, 0U);
+            return data_ + index;
+        }
+
+        void push_back(char c)
+        {
+            if (size_ == capacity())
+            {
+                Reallocate(GrowCapacity(size_ + 1U));
+            }
+            data_[size_] = c;
+            data_[++size_] = '\0';
+        }
+
+        void pop_back() noexcept
+        {
+            data_[--size_] = '\0';
+        }
+
+        BasicString& append(size_type count, char c)
+        {
+            return ReplaceFill(size_, 0U, count, c);
+        }
+
+        BasicString& append(char const *s, size_type count)
+        {
+            return ReplaceCopy(size_, 0U, s, count);
+        }
+
+        BasicString& append(char const *s)
+        {
+            return append(s, traits_type::length(s));
+        }
+
+        BasicString& append(BasicString const &other)
+        {
+            return append(other.data_, other.size_);
+        }
+
+        BasicString& append(BasicString const &other, size_type pos, size_type count = npos)
+        {
+            other.CheckPosition(pos, "BasicString::append");
+            return append(other.data_ + pos, std::min(count, other.size_ - pos));
+        }
+
+        // SWS_CORE_03308
+        /**
+         * \brief Append a StringView to this BasicString.
+         *
+         * \param[in] sv    the StringView
+         * \return BasicString&     *this
+         */
+        BasicString& append(StringView sv)
+        {
+            return append(sv.data(), sv.size());
+        }
+
+        // SWS_CORE_03309
+        /**
+         * \brief Append a substring of an object convertible to StringView to this BasicString.
+         *
+         * \param[in] t     the object
+         * \param[in] pos   the start of the substring
+         * \param[in] n     the length of the substring
+         * \return BasicString&     *this
+         */
+        template <typename T, typename = EnableIfViewLike<T>>
+        BasicString& append(T const &t, size_type pos, size_type n = npos)
+        {
+            StringView const sv = StringView(t).substr(pos, n);
+            return append(sv.data(), sv.size());
+        }
+
+        BasicString& operator+=(BasicString const &other)
+        {
+            return append(other.data_, other.size_);
+        }
+
+        BasicString& operator+=(char c)
+        {
+            push_back(c);
+            return *this;
+        }
+
+        BasicString& operator+=(char const *s)
+        {
+            return append(s);
+        }
+
+        // SWS_CORE_03307
+        /**
+         * \brief Append a StringView to this BasicString.
+         *
+         * \param[in] sv    the StringView
+         * \return BasicString&     *this
+         */
+        BasicString& operator+=(StringView sv)
+        {
+            return append(sv.data(), sv.size());
+        }
+
+        BasicString& replace(size_type pos, size_type count, char const *s, size_type count2)
+        {
+            CheckPosition(pos, "BasicString::replace");
+            return ReplaceCopy(pos, std::min(count, size_ - pos), s, count2);
+        }
+
+        BasicString& replace(size_type pos, size_type count, BasicString const &other)
+        {
+            return replace(pos, count, other.data_, other.size_);
+        }
+
+        BasicString& replace(size_type pos, size_type count, size_type count2, char c)
+        {
+            CheckPosition(pos, "BasicString::replace");
+            return ReplaceFill(pos, std::min(count, size_ - pos), count2, c);
+        }
 
         // SWS_CORE_03312
-        BasicString& replace(size_type pos1, size_type n1, StringView sv);
+        /**
+         * \brief Replace a part of this BasicString with a StringView.
+         *
+         * \param[in] pos1  the start of the part to replace
+         * \param[in] n1    the length of the part to replace
+         * \param[in] sv    the StringView
+         * \return BasicString&     *this
+         */
+        BasicString& replace(size_type pos1, size_type n1, StringView sv)
+        {
+            return replace(pos1, n1, sv.data(), sv.size());
+        }
 
         // SWS_CORE_03313
-        template <typename T>
-        BasicString& replace(size_type pos1, size_type n1, T const& t, size_type pos2, size_type n2 = npos);
+        /**
+         * \brief Replace a part of this BasicString with a substring of an object convertible to StringView.
+         *
+         * \param[in] pos1  the start of the part to replace
+         * \param[in] n1    the length of the part to replace
+         * \param[in] t     the object
+         * \param[in] pos2  the start of the substring
+         * \param[in] n2    the length of the substring
+         * \return BasicString&     *this
+         */
+        template <typename T, typename = EnableIfViewLike<T>>
+        BasicString& replace(size_type pos1, size_type n1, T const &t, size_type pos2, size_type n2 = npos)
+        {
+            StringView const sv = StringView(t).substr(pos2, n2);
+            return replace(pos1, n1, sv.data(), sv.size());
+        }
 
         // SWS_CORE_03314
-        BasicString& replace(const_iterator i1, const_iterator i2, StringView sv);
+        /**
+         * \brief Replace the characters in [i1, i2) with a StringView.
+         *
+         * \param[in] i1    the start of the part to replace
+         * \param[in] i2    the end of the part to replace
+         * \param[in] sv    the StringView
+         * \return BasicString&     *this
+         */
+        BasicString& replace(const_iterator i1, const_iterator i2, StringView sv)
+        {
+            return replace(static_cast<size_type>(i1 - data_), static_cast<size_type>(i2 - i1), sv.data(), sv.size());
+        }
+
+        BasicString substr(size_type pos = 0U, size_type count = npos) const
+        {
+            return BasicString(*this, pos, count, alloc_);
+        }
+
+        size_type copy(char *dest, size_type count, size_type pos = 0U) const
+        {
+            return StringView(*this).copy(dest, count, pos);
+        }
+
+        void resize(size_type count)
+        {
+            resize(count, '\0');
+        }
+
+        void resize(size_type count, char c)
+        {
+            if (count > size_)
+            {
+                append(count - size_, c);
+            }
+            else
+            {
+                size_ = count;
+                data_[size_] = '\0';
+            }
+        }
+
+        void swap(BasicString &other)
+        {
+            if (this == &other)
+            {
+                return;
+            }
+            if (!IsInline() && !other.IsInline() && (alloc_ == other.alloc_))
+            {
+                std::swap(data_, other.data_);
+                std::swap(size_, other.size_);
+                std::swap(capacity_, other.capacity_);
+                return;
+            }
+            BasicString temp(std::move(other), other.alloc_);
+            other = std::move(*this);
+            *this = std::move(temp);
+        }
 
         // SWS_CORE_03315
-        size_type find(StringView sv, size_type pos = 0) const noexcept;
+        size_type find(StringView sv, size_type pos = 0U) const noexcept
+        {
+            return StringView(*this).find(sv, pos);
+        }
+
+        size_type find(char c, size_type pos = 0U) const noexcept
+        {
+            return StringView(*this).find(c, pos);
+        }
 
         // SWS_CORE_03316
-        size_type rfind(StringView sv, size_type pos = npos) const noexcept;
+        size_type rfind(StringView sv, size_type pos = npos) const noexcept
+        {
+            return StringView(*this).rfind(sv, pos);
+        }
+
+        size_type rfind(char c, size_type pos = npos) const noexcept
+        {
+            return StringView(*this).rfind(c, pos);
+        }
 
         // SWS_CORE_03317
-        size_type find_first_of(StringView sv, size_type pos = 0) const noexcept;
+        size_type find_first_of(StringView sv, size_type pos = 0U) const noexcept
+        {
+            return StringView(*this).find_first_of(sv, pos);
+        }
 
         // SWS_CORE_03318
-        size_type find_last_of(StringView sv, size_type pos = npos) const noexcept;
+        size_type find_last_of(StringView sv, size_type pos = npos) const noexcept
+        {
+            return StringView(*this).find_last_of(sv, pos);
+        }
 
         // SWS_CORE_03319
-        size_type find_first_not_of(StringView sv, size_type pos = 0) const noexcept;
+        size_type find_first_not_of(StringView sv, size_type pos = 0U) const noexcept
+        {
+            return StringView(*this).find_first_not_of(sv, pos);
+        }
 
         // SWS_CORE_03320
-        size_type find_last_not_of(StringView sv, size_type pos = npos) const noexcept;
+        size_type find_last_not_of(StringView sv, size_type pos = npos) const noexcept
+        {
+            return StringView(*this).find_last_not_of(sv, pos);
+        }
 
         // SWS_CORE_03321
-        int compare(StringView sv) const noexcept;
+        int compare(StringView sv) const noexcept
+        {
+            return StringView(*this).compare(sv);
+        }
 
         // SWS_CORE_03322
-        int compare(size_type pos1, size_type n1, StringView sv) const;
+        int compare(size_type pos1, size_type n1, StringView sv) const
+        {
+            return StringView(*this).compare(pos1, n1, sv);
+        }
 
         // SWS_CORE_03323
-        template <typename T>
-        int compare(size_type pos1, size_type n1, T const& t, size_type pos2, size_type n2 = npos) const;
+        template <typename T, typename = EnableIfViewLike<T>>
+        int compare(size_type pos1, size_type n1, T const &t, size_type pos2, size_type n2 = npos) const
+        {
+            return StringView(*this).compare(pos1, n1, StringView(t), pos2, n2);
+        }
+
+    private:
+        bool IsInline() const noexcept
+        {
+            return data_ == inline_;
+        }
+
+        void CheckPosition(size_type pos, char const *what) const
+        {
+            if (pos > size_)
+            {
+                internal::ThrowOrAbort<std::out_of_range>(what);
+            }
+        }
+
+        size_type GrowCapacity(size_type required) const
+        {
+            if (required > max_size())
+            {
+                internal::ThrowOrAbort<std::length_error>("BasicString");
+            }
+            size_type const current = capacity();
+            size_type const doubled = (current < (max_size() / 2U)) ? (2U * current) : max_size();
+            return std::max(required, doubled);
+        }
+
+        char* Allocate(size_type newCapacity)
+        {
+            return AllocTraits::allocate(alloc_, newCapacity + 1U);
+        }
+
+        void Release() noexcept
+        {
+            if (!IsInline())
+            {
+                AllocTraits::deallocate(alloc_, data_, capacity_ + 1U);
+            }
+        }
 
-        // SWS_CORE_03296
-        template <typename Allocator>
-        void swap(BasicString<Allocator>& lhs, BasicString<Allocator>& rhs);
+        void Reallocate(size_type newCapacity)
+        {
+            if (newCapacity <= kInlineCapacity)
+            {
+                if (!IsInline())
+                {
+                    char *heap = data_;
+                    size_type const heapCapacity = capacity_;
+                    traits_type::copy(inline_, heap, size_ + 1U);
+                    AllocTraits::deallocate(alloc_, heap, heapCapacity + 1U);
+                    data_ = inline_;
+                }
+                return;
+            }
 
+            char *p = Allocate(newCapacity);
+            traits_type::copy(p, data_, size_ + 1U);
+            Release();
+            data_ = p;
+            capacity_ = newCapacity;
+        }
+
+        void StealOrCopy(BasicString &other) noexcept
+        {
+            if (other.IsInline())
+            {
+                traits_type::copy(inline_, other.inline_, other.size_ + 1U);
+                data_ = inline_;
+            }
+            else
+            {
+                data_ = other.data_;
+                capacity_ = other.capacity_;
+                other.data_ = other.inline_;
+            }
+            size_ = other.size_;
+            other.size_ = 0U;
+            other.inline_[0] = '\0';
+        }
+
+        // Replace count1 characters at pos with count2 characters from s, which may point into this string.
+        BasicString& ReplaceCopy(size_type pos, size_type count1, char const *s, size_type count2)
+        {
+            size_type const tail = size_ - pos - count1;
+            size_type const newSize = size_ - count1 + count2;
+            if ((count2 > count1) && ((count2 - count1) > (max_size() - size_)))
+            {
+                internal::ThrowOrAbort<std::length_error>("BasicString");
+            }
+
+            if (newSize > capacity())
+            {
+                size_type const newCapacity = GrowCapacity(newSize);
+                char *p = Allocate(newCapacity);
+                traits_type::copy(p, data_, pos);
+                traits_type::copy(p + pos, s, count2);
+                traits_type::copy(p + pos + count2, data_ + pos + count1, tail);
+                Release();
+                data_ = p;
+                capacity_ = newCapacity;
+            }
+            else
+            {
+                internal::ReplaceInPlace(data_, size_, pos, count1, s, count2);
+            }
+            size_ = newSize;
+            data_[size_] = '\0';
+            return *this;
+        }
+
+        // Replace count1 characters at pos with count2 copies of c.
+        BasicString& ReplaceFill(size_type pos, size_type count1, size_type count2, char c)
+        {
+            if ((count2 > count1) && ((count2 - count1) > (max_size() - size_)))
+            {
+                internal::ThrowOrAbort<std::length_error>("BasicString");
+            }
+            if ((size_ - count1 + count2) > capacity())
+            {
+                Reallocate(GrowCapacity(size_ - count1 + count2));
+            }
+            traits_type::move(data_ + pos + count2, data_ + pos + count1, size_ - pos - count1);
+            traits_type::assign(data_ + pos, count2, c);
+            size_ = size_ - count1 + count2;
+            data_[size_] = '\0';
+            return *this;
+        }
+
+        Allocator alloc_;
+        char *data_;
+        size_type size_;
+        union
+        {
+            size_type capacity_;                    /*< capacity of the heap buffer, valid if !IsInline() */
+            char inline_[kInlineCapacity + 1U];     /*< characters and terminator of short strings */
+        };
     };
 
+    template <typename Allocator>
+    constexpr typename BasicString<Allocator>::size_type BasicString<Allocator>::npos;
+
+    template <typename Allocator>
+    constexpr typename BasicString<Allocator>::size_type BasicString<Allocator>::kInlineCapacity;
+
+    template <typename Allocator>
+    inline BasicString<Allocator> operator+(BasicString<Allocator> const &lhs, BasicString<Allocator> const &rhs)
+    {
+        BasicString<Allocator> result(lhs);
+        result.reserve(lhs.size() + rhs.size());
+        return std::move(result.append(rhs));
+    }
+
+    template <typename Allocator>
+    inline BasicString<Allocator> operator+(BasicString<Allocator> &&lhs, BasicString<Allocator> const &rhs)
+    {
+        return std::move(lhs.append(rhs));
+    }
+
+    template <typename Allocator>
+    inline BasicString<Allocator> operator+(BasicString<Allocator> const &lhs, char const *rhs)
+    {
+        BasicString<Allocator> result(lhs);
+        return std::move(result.append(rhs));
+    }
+
+    template <typename Allocator>
+    inline BasicString<Allocator> operator+(BasicString<Allocator> &&lhs, char const *rhs)
+    {
+        return std::move(lhs.append(rhs));
+    }
+
+    template <typename Allocator>
+    inline BasicString<Allocator> operator+(char const *lhs, BasicString<Allocator> const &rhs)
+    {
+        BasicString<Allocator> result(lhs, rhs.get_allocator());
+        return std::move(result.append(rhs));
+    }
+
+    template <typename Allocator>
+    inline BasicString<Allocator> operator+(BasicString<Allocator> const &lhs, char rhs)
+    {
+        BasicString<Allocator> result(lhs);
+        result.push_back(rhs);
+        return result;
+    }
+
+    template <typename Allocator>
+    inline bool operator==(BasicString<Allocator> const &lhs, BasicString<Allocator> const &rhs) noexcept
+    {
+        return StringView(lhs) == StringView(rhs);
+    }
+
+    template <typename Allocator>
+    inline bool operator==(BasicString<Allocator> const &lhs, char const *rhs) noexcept
+    {
+        return StringView(lhs) == StringView(rhs);
+    }
+
+    template <typename Allocator>
+    inline bool operator==(char const *lhs, BasicString<Allocator> const &rhs) noexcept
+    {
+        return StringView(lhs) == StringView(rhs);
+    }
+
+    template <typename Allocator>
+    inline bool operator!=(BasicString<Allocator> const &lhs, BasicString<Allocator> const &rhs) noexcept
+    {
+        return !(lhs == rhs);
+    }
+
+    template <typename Allocator>
+    inline bool operator!=(BasicString<Allocator> const &lhs, char const *rhs) noexcept
+    {
+        return !(lhs == rhs);
+    }
+
+    template <typename Allocator>
+    inline bool operator!=(char const *lhs, BasicString<Allocator> const &rhs) noexcept
+    {
+        return !(lhs == rhs);
+    }
+
+    template <typename Allocator>
+    inline bool operator<(BasicString<Allocator> const &lhs, BasicString<Allocator> const &rhs) noexcept
+    {
+        return lhs.compare(rhs) < 0;
+    }
+
+    template <typename Allocator>
+    inline bool operator<=(BasicString<Allocator> const &lhs, BasicString<Allocator> const &rhs) noexcept
+    {
+        return lhs.compare(rhs) <= 0;
+    }
+
+    template <typename Allocator>
+    inline bool operator>(BasicString<Allocator> const &lhs, BasicString<Allocator> const &rhs) noexcept
+    {
+        return lhs.compare(rhs) > 0;
+    }
+
+    template <typename Allocator>
+    inline bool operator>=(BasicString<Allocator> const &lhs, BasicString<Allocator> const &rhs) noexcept
+    {
+        return lhs.compare(rhs) >= 0;
+    }
+
+    template <typename Allocator>
+    inline std::ostream& operator<<(std::ostream &os, BasicString<Allocator> const &s)
+    {
+        return os << StringView(s);
+    }
+
+    // SWS_CORE_03296
+    /**
+     * \brief Exchange the contents of two BasicStrings.
+     *
+     * \param[in,out] lhs   the first string
+     * \param[in,out] rhs   the second string
+     */
+    template <typename Allocator>
+    void swap(BasicString<Allocator> &lhs, BasicString<Allocator> &rhs)
+    {
+        lhs.swap(rhs);
+    }
+
     // SWS_CORE_03001
-    using String = BasicString<IMPLEMENTATION_DEFINED>;
+    /**
+     * \brief A BasicString that uses the default allocator.
+     *
+     */
+    using String = BasicString<>;
 }
 }
+
+namespace std
+{
+    template <typename Allocator>
+    struct hash<ara::core::BasicString<Allocator>>
+    {
+        std::size_t operator()(ara::core::BasicString<Allocator> const &s) const noexcept
+        {
+            return ara::core::internal::HashBytes(s.data(), s.size());
+        }
+    };
+} // namespace std
@@ -1,26 +1,539 @@
 /**
  * \file string_view.h
  * \author Vincent WANG (vin@misday.com)
- * \brief 
+ * \brief
  * \version 0.1
  * \date 2021-11-12
- * 
+ *
  * \copyright Copyright (c) 2021
- * 
+ *
  */
 
 // R19-11
 
 #pragma once
 
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <ostream>
+#include <stdexcept>
+#include <string>
+#include "abort.h"
+
 namespace ara
 {
 namespace core
 {
-    // SWS_CORE_02001
-    class StringView
+    namespace internal
     {
-        
+        /**
+         * \brief FNV-1a hash of a byte range, shared by the hashes of the string types.
+         *
+         * \param[in] data  the bytes
+         * \param[in] size  the number of bytes
+         * \return std::size_t  the hash
+         */
+        inline std::size_t HashBytes(void const *data, std::size_t size) noexcept
+        {
+            std::uint64_t hash = 14695981039346656037ULL;
+            unsigned char const *bytes = static_cast<unsigned char const *>(data);
+            for (std::size_t i = 0U; i < size; ++i)
+            {
+                hash = (hash ^ bytes[i]) * 1099511628211ULL;
+            }
+            return static_cast<std::size_t>(hash);
+        }
+
+        /**
+         * \brief HashBytes() of a character range, usable in constant expressions.
+         *
+         * \param[in] data  the characters
+         * \param[in] size  the number of characters
+         * \return std::size_t  the hash
+         */
+        constexpr std::size_t HashChars(char const *data, std::size_t size) noexcept
+        {
+            std::uint64_t hash = 14695981039346656037ULL;
+            for (std::size_t i = 0U; i < size; ++i)
+            {
+                hash = (hash ^ static_cast<unsigned char>(data[i])) * 1099511628211ULL;
+            }
+            return static_cast<std::size_t>(hash);
+        }
+
+        /**
+         * \brief Replace count1 characters at pos with count2 characters from s, within a buffer that is large
+         * enough for the result. s may point into the buffer itself. The terminator is left to the caller.
+         *
+         * \param[in,out] data  the characters
+         * \param[in] size      the number of characters before the replacement
+         * \param[in] pos       the first character to replace
+         * \param[in] count1    the number of characters to replace
+         * \param[in] s         the replacement characters
+         * \param[in] count2    the number of replacement characters
+         */
+        inline void ReplaceInPlace(char *data, std::size_t size, std::size_t pos, std::size_t count1, char const *s,
+                                   std::size_t count2) noexcept
+        {
+            using Traits = std::char_traits<char>;
+
+            std::size_t const tail = size - pos - count1;
+            char *const hole = data + pos;
+            bool const aliased = (s != nullptr) && std::less<char const *>()(s, data + size) && !std::less<char const *>()(s, data);
+            if (!aliased || (count2 <= count1))
+            {
+                // the source is copied before the tail moves left, so it stays intact
+                if (aliased)
+                {
+                    Traits::move(hole, s, count2);
+                }
+                if (count1 != count2)
+                {
+                    Traits::move(hole + count2, hole + count1, tail);
+                }
+                if (!aliased)
+                {
+                    Traits::copy(hole, s, count2);
+                }
+            }
+            else
+            {
+                // the tail moves right first, and the part of the source inside the tail with it
+                Traits::move(hole + count2, hole + count1, tail);
+                if ((s + count2) <= (hole + count1))
+                {
+                    Traits::move(hole, s, count2);
+                }
+                else if (s >= (hole + count1))
+                {
+                    Traits::copy(hole, s + (count2 - count1), count2);
+                }
+                else
+                {
+                    std::size_t const head = static_cast<std::size_t>((hole + count1) - s);
+                    Traits::move(hole, s, head);
+                    Traits::copy(hole + head, hole + count2, count2 - head);
+                }
+            }
+        }
+    } // namespace internal
+
+    /**
+     * \brief A read-only view over a contiguous sequence of characters, modelled after std::basic_string_view.
+     *
+     * \tparam CharT    the character type
+     * \tparam Traits   the character traits
+     */
+    template <typename CharT, typename Traits = std::char_traits<CharT>>
+    class BasicStringView
+    {
+    public:
+        using traits_type = Traits;
+        using value_type = CharT;
+        using pointer = CharT *;
+        using const_pointer = CharT const *;
+        using reference = CharT &;
+        using const_reference = CharT const &;
+        using const_iterator = CharT const *;
+        using iterator = const_iterator;
+        using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+        using reverse_iterator = const_reverse_iterator;
+        using size_type = std::size_t;
+        using difference_type = std::ptrdiff_t;
+
+        static constexpr size_type npos = static_cast<size_type>(-1);
+
+        constexpr BasicStringView() noexcept : data_(nullptr), size_(0U)
+        {
+        }
+
+        constexpr BasicStringView(const_pointer p, size_type count) noexcept : data_(p), size_(count)
+        {
+        }
+
+        BasicStringView(const_pointer p) noexcept : data_(p), size_(Traits::length(p))
+        {
+        }
+
+        constexpr BasicStringView(BasicStringView const &other) noexcept = default;
+        BasicStringView& operator=(BasicStringView const &other) noexcept = default;
+
+        constexpr const_iterator begin() const noexcept
+        {
+            return data_;
+        }
+
+        constexpr const_iterator cbegin() const noexcept
+        {
+            return data_;
+        }
+
+        constexpr const_iterator end() const noexcept
+        {
+            return data_ + size_;
+        }
+
+        constexpr const_iterator cend() const noexcept
+        {
+            return data_ + size_;
+        }
+
+        const_reverse_iterator rbegin() const noexcept
+        {
+            return const_reverse_iterator(end());
+        }
+
+        const_reverse_iterator crbegin() const noexcept
+        {
+            return const_reverse_iterator(end());
+        }
+
+        const_reverse_iterator rend() const noexcept
+        {
+            return const_reverse_iterator(begin());
+        }
+
+        const_reverse_iterator crend() const noexcept
+        {
+            return const_reverse_iterator(begin());
+        }
+
+        constexpr size_type size() const noexcept
+        {
+            return size_;
+        }
+
+        constexpr size_type length() const noexcept
+        {
+            return size_;
+        }
+
+        constexpr size_type max_size() const noexcept
+        {
+            return static_cast<size_type>(-1) / sizeof(CharT);
+        }
+
+        constexpr bool empty() const noexcept
+        {
+            return size_ == 0U;
+        }
+
+        constexpr const_reference operator[](size_type pos) const
+        {
+            return data_[pos];
+        }
+
+        const_reference at(size_type pos) const
+        {
+            if (pos >= size_)
+            {
+                internal::ThrowOrAbort<std::out_of_range>("BasicStringView::at");
+            }
+            return data_[pos];
+        }
+
+        constexpr const_reference front() const
+        {
+            return data_[0];
+        }
+
+        constexpr const_reference back() const
+        {
+            return data_[size_ - 1U];
+        }
+
+        constexpr const_pointer data() const noexcept
+        {
+            return data_;
+        }
+
+        void remove_prefix(size_type n)
+        {
+            data_ += n;
+            size_ -= n;
+        }
+
+        void remove_suffix(size_type n)
+        {
+            size_ -= n;
+        }
+
+        void swap(BasicStringView &other) noexcept
+        {
+            std::swap(data_, other.data_);
+            std::swap(size_, other.size_);
+        }
+
+        size_type copy(CharT *dest, size_type count, size_type pos = 0U) const
+        {
+            if (pos > size_)
+            {
+                internal::ThrowOrAbort<std::out_of_range>("BasicStringView::copy");
+            }
+            size_type const n = std::min(count, size_ - pos);
+            Traits::copy(dest, data_ + pos, n);
+            return n;
+        }
+
+        BasicStringView substr(size_type pos = 0U, size_type count = npos) const
+        {
+            if (pos > size_)
+            {
+                internal::ThrowOrAbort<std::out_of_range>("BasicStringView::substr");
+            }
+            return BasicStringView(data_ + pos, std::min(count, size_ - pos));
+        }
+
+        int compare(BasicStringView v) const noexcept
+        {
+            int const result = Traits::compare(data_, v.data_, std::min(size_, v.size_));
+            return (result != 0) ? result : ((size_ < v.size_) ? -1 : ((size_ > v.size_) ? 1 : 0));
+        }
+
+        int compare(size_type pos1, size_type count1, BasicStringView v) const
+        {
+            return substr(pos1, count1).compare(v);
+        }
+
+        int compare(size_type pos1, size_type count1, BasicStringView v, size_type pos2, size_type count2) const
+        {
+            return substr(pos1, count1).compare(v.substr(pos2, count2));
+        }
+
+        int compare(const_pointer s) const
+        {
+            return compare(BasicStringView(s));
+        }
+
+        size_type find(BasicStringView v, size_type pos = 0U) const noexcept
+        {
+            if ((pos > size_) || (v.size_ > (size_ - pos)))
+            {
+                return npos;
+            }
+            if (v.size_ == 0U)
+            {
+                return pos;
+            }
+            for (const_pointer p = data_ + pos, last = data_ + (size_ - v.size_); p <= last; ++p)
+            {
+                p = Traits::find(p, static_cast<size_type>(last - p) + 1U, v.data_[0]);
+                if (p == nullptr)
+                {
+                    break;
+                }
+                if (Traits::compare(p + 1, v.data_ + 1, v.size_ - 1U) == 0)
+                {
+                    return static_cast<size_type>(p - data_);
+                }
+            }
+            return npos;
+        }
+
+        size_type find(CharT c, size_type pos = 0U) const noexcept
+        {
+            if (pos >= size_)
+            {
+                return npos;
+            }
+            const_pointer p = Traits::find(data_ + pos, size_ - pos, c);
+            return (p != nullptr) ? static_cast<size_type>(p - data_) : npos;
+        }
+
+        size_type rfind(BasicStringView v, size_type pos = npos) const noexcept
+        {
+            if (v.size_ > size_)
+            {
+                return npos;
+            }
+            for (size_type i = std::min(pos, size_ - v.size_) + 1U; i > 0U; --i)
+            {
+                if (Traits::compare(data_ + i - 1U, v.data_, v.size_) == 0)
+                {
+                    return i - 1U;
+                }
+            }
+            return npos;
+        }
+
+        size_type rfind(CharT c, size_type pos = npos) const noexcept
+        {
+            return rfind(BasicStringView(&c, 1U), pos);
+        }
+
+        size_type find_first_of(BasicStringView v, size_type pos = 0U) const noexcept
+        {
+            for (size_type i = pos; i < size_; ++i)
+            {
+                if (Traits::find(v.data_, v.size_, data_[i]) != nullptr)
+                {
+                    return i;
+                }
+            }
+            return npos;
+        }
+
+        size_type find_first_of(CharT c, size_type pos = 0U) const noexcept
+        {
+            return find(c, pos);
+        }
+
+        size_type find_last_of(BasicStringView v, size_type pos = npos) const noexcept
+        {
+            for (size_type i = (size_ == 0U) ? 0U : (std::min(pos, size_ - 1U) + 1U); i > 0U; --i)
+            {
+                if (Traits::find(v.data_, v.size_, data_[i - 1U]) != nullptr)
+                {
+                    return i - 1U;
+                }
+            }
+            return npos;
+        }
+
+        size_type find_last_of(CharT c, size_type pos = npos) const noexcept
+        {
+            return rfind(c, pos);
+        }
+
+        size_type find_first_not_of(BasicStringView v, size_type pos = 0U) const noexcept
+        {
+            for (size_type i = pos; i < size_; ++i)
+            {
+                if (Traits::find(v.data_, v.size_, data_[i]) == nullptr)
+                {
+                    return i;
+                }
+            }
+            return npos;
+        }
+
+        size_type find_first_not_of(CharT c, size_type pos = 0U) const noexcept
+        {
+            return find_first_not_of(BasicStringView(&c, 1U), pos);
+        }
+
+        size_type find_last_not_of(BasicStringView v, size_type pos = npos) const noexcept
+        {
+            for (size_type i = (size_ == 0U) ? 0U : (std::min(pos, size_ - 1U) + 1U); i > 0U; --i)
+            {
+                if (Traits::find(v.data_, v.size_, data_[i - 1U]) == nullptr)
+                {
+                    return i - 1U;
+                }
+            }
+            return npos;
+        }
+
+        size_type find_last_not_of(CharT c, size_type pos = npos) const noexcept
+        {
+            return find_last_not_of(BasicStringView(&c, 1U), pos);
+        }
+
+    private:
+        const_pointer data_;
+        size_type size_;
     };
+
+    template <typename CharT, typename Traits>
+    constexpr typename BasicStringView<CharT, Traits>::size_type BasicStringView<CharT, Traits>::npos;
+
+    namespace internal
+    {
+        // Puts a parameter into a non-deduced context, so the other parameter alone deduces the
+        // template arguments and this one accepts anything convertible, e.g. a String or a literal.
+        template <typename T>
+        struct Identity
+        {
+            using type = T;
+        };
+    } // namespace internal
+
+    template <typename CharT, typename Traits>
+    inline bool operator==(BasicStringView<CharT, Traits> lhs, BasicStringView<CharT, Traits> rhs) noexcept
+    {
+        return (lhs.size() == rhs.size()) && (lhs.compare(rhs) == 0);
+    }
+
+    template <typename CharT, typename Traits>
+    inline bool operator==(BasicStringView<CharT, Traits> lhs, typename internal::Identity<BasicStringView<CharT, Traits>>::type rhs) noexcept
+    {
+        return (lhs.size() == rhs.size()) && (lhs.compare(rhs) == 0);
+    }
+
+    template <typename CharT, typename Traits>
+    inline bool operator==(typename internal::Identity<BasicStringView<CharT, Traits>>::type lhs, BasicStringView<CharT, Traits> rhs) noexcept
+    {
+        return (lhs.size() == rhs.size()) && (lhs.compare(rhs) == 0);
+    }
+
+    template <typename CharT, typename Traits>
+    inline bool operator!=(BasicStringView<CharT, Traits> lhs, BasicStringView<CharT, Traits> rhs) noexcept
+    {
+        return !(lhs == rhs);
+    }
+
+    template <typename CharT, typename Traits>
+    inline bool operator!=(BasicStringView<CharT, Traits> lhs, typename internal::Identity<BasicStringView<CharT, Traits>>::type rhs) noexcept
+    {
+        return !(lhs == rhs);
+    }
+
+    template <typename CharT, typename Traits>
+    inline bool operator!=(typename internal::Identity<BasicStringView<CharT, Traits>>::type lhs, BasicStringView<CharT, Traits> rhs) noexcept
+    {
+        return !(lhs == rhs);
+    }
+
+    template <typename CharT, typename Traits>
+    inline bool operator<(BasicStringView<CharT, Traits> lhs, BasicStringView<CharT, Traits> rhs) noexcept
+    {
+        return lhs.compare(rhs) < 0;
+    }
+
+    template <typename CharT, typename Traits>
+    inline bool operator<=(BasicStringView<CharT, Traits> lhs, BasicStringView<CharT, Traits> rhs) noexcept
+    {
+        return lhs.compare(rhs) <= 0;
+    }
+
+    template <typename CharT, typename Traits>
+    inline bool operator>(BasicStringView<CharT, Traits> lhs, BasicStringView<CharT, Traits> rhs) noexcept
+    {
+        return lhs.compare(rhs) > 0;
+    }
+
+    template <typename CharT, typename Traits>
+    inline bool operator>=(BasicStringView<CharT, Traits> lhs, BasicStringView<CharT, Traits> rhs) noexcept
+    {
+        return lhs.compare(rhs) >= 0;
+    }
+
+    template <typename CharT, typename Traits>
+    inline std::basic_ostream<CharT, Traits>& operator<<(std::basic_ostream<CharT, Traits> &os, BasicStringView<CharT, Traits> v)
+    {
+        return os.write(v.data(), static_cast<std::streamsize>(v.size()));
+    }
+
+    // SWS_CORE_02001
+    /**
+     * \brief A read-only view over a contiguous sequence of characters.
+     *
+     */
+    using StringView = BasicStringView<char>;
 }
 }
+
+namespace std
+{
+    template <typename CharT, typename Traits>
+    struct hash<ara::core::BasicStringView<CharT, Traits>>
+    {
+        std::size_t operator()(ara::core::BasicStringView<CharT, Traits> v) const noexcept
+        {
+            return ara::core::internal::HashBytes(v.data(), v.size() * sizeof(CharT));
+        }
+    };
+} // namespace std
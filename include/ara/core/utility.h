@@ -13,6 +13,7 @@
 #pragma once
 
 #include <cstddef>
+#include <initializer_list>
 
 namespace ara
 {
@@ -22,8 +23,12 @@ namespace core
     /**
      * \brief A non-integral binary type.
      * 
+     * A scoped enumeration like std::byte, also in C++14.
+     * 
      */
-    using Byte = IMPEMENTATION_DEFINED;
+    enum class Byte : unsigned char
+    {
+    };
 
     // SWS_CORE_04011
     /**
@@ -49,7 +54,7 @@ namespace core
      * \brief The singleton instance of in_place_t.
      * 
      */
-    constexpr in_place_t in_place;
+    constexpr in_place_t in_place{};
 
     // SWS_CORE_04021
     /**
@@ -62,14 +67,14 @@ namespace core
      * \tparam T 
      */
     template<typename T>
-    struct inplace_type_t
+    struct in_place_type_t
     {
         // SWS_CORE_04022
         /**
          * \brief Default constructor.
          * 
          */
-        explicit inplace_type_t() = default;
+        explicit in_place_type_t() = default;
     };
 
     // SWS_CORE_04031
@@ -82,7 +87,7 @@ namespace core
      * 
      * \tparam I  -
      */
-    template<size_t I>
+    template<std::size_t I>
     struct in_place_index_t
     {
         // SWS_CORE_04032
@@ -102,7 +107,10 @@ namespace core
      * \return decltype(c.data())   a pointer to the first element of the container
      */
     template<typename Container>
-    constexpr auto data(Container &c) -> decltype(c.data());
+    constexpr auto data(Container &c) -> decltype(c.data())
+    {
+        return c.data();
+    }
 
     // SWS_CORE_04111
     /**
@@ -113,7 +121,10 @@ namespace core
      * \return decltype(c.data())   a pointer to the first element of the container
      */
     template<typename Container>
-    constexpr auto data(Container const &c) -> decltype(c.data());
+    constexpr auto data(Container const &c) -> decltype(c.data())
+    {
+        return c.data();
+    }
 
     // SWS_CORE_04112
     /**
@@ -127,7 +138,10 @@ namespace core
      * \return T* a pointer to the first element of the array
      */
     template<typename T, std::size_t N>
-    constexpr T* data(T(&array)[N]) noexcept;
+    constexpr T* data(T(&array)[N]) noexcept
+    {
+        return array;
+    }
 
     // SWS_CORE_04113
     /**
@@ -138,7 +152,10 @@ namespace core
      * \return E const* a pointer to the first element of the std::initializer_list
      */
     template<typename E>
-    constexpr E const* data(std::initializer_list<E> il) noexcept;
+    constexpr E const* data(std::initializer_list<E> il) noexcept
+    {
+        return il.begin();
+    }
 
     // SWS_CORE_04120
     /**
@@ -149,7 +166,10 @@ namespace core
      * \return decltype(c.size())   the size of the container
      */
     template<typename Container>
-    constexpr auto size(Container const &c) -> decltype(c.size());
+    constexpr auto size(Container const &c) -> decltype(c.size())
+    {
+        return c.size();
+    }
 
     // SWS_CORE_04121
     /**
@@ -163,7 +183,10 @@ namespace core
      * \return std::size_t  the size of the array, i.e. N
      */
     template<typename T, std::size_t N>
-    constexpr std::size_t size(T const (&array)[N]) noexcept;
+    constexpr std::size_t size(T const (&array)[N]) noexcept
+    {
+        return static_cast<void>(array), N;
+    }
 
     // SWS_CORE_04130
     /**
@@ -174,7 +197,10 @@ namespace core
      * \return decltype(c.empty())  true if the container is empty, false otherwise
      */
     template<typename Container>
-    constexpr auto empty(Container const &c) -> decltype(c.empty());
+    constexpr auto empty(Container const &c) -> decltype(c.empty())
+    {
+        return c.empty();
+    }
 
     // SWS_CORE_04131
     /**
@@ -191,7 +217,10 @@ namespace core
      * \return false    false
      */
     template<typename T, std::size_t N>
-    constexpr bool empty(T const (&array)[N]) constexpr;
+    constexpr bool empty(T const (&array)[N]) noexcept
+    {
+        return static_cast<void>(array), false;
+    }
 
     // SWS_CORE_04132
     /**
@@ -203,7 +232,10 @@ namespace core
      * \return false    otherwise
      */
     template<typename E>
-    constexpr bool empty(std::initializer_list<E> il) noexcept;
+    constexpr bool empty(std::initializer_list<E> il) noexcept
+    {
+        return il.size() == 0U;
+    }
 
 } // namespace core
 } // namespace ara
@@ -12,15 +12,27 @@
 
 #pragma once
 
+#include <vector>
+#include "memory_resource.h"
+
 namespace ara
 {
 namespace core
 {
     // SWS_CORE_01301
-    template <typename T, typename Allocator = IMPLEMENTATION_DEFINED>
-    class Vector
-    {
-        
-    };
+    /**
+     * \brief A container which can change in size.
+     * 
+     * The default allocator takes its memory from GetDefaultMemoryResource(), so a process can serve all
+     * Vectors from pre-reserved memory by installing a MonotonicBufferResource or FixedPoolResource at
+     * startup. A PolymorphicAllocator constructed from a specific resource selects the memory of a single
+     * Vector. Comparison operators (SWS_CORE_01390 ... SWS_CORE_01395) and swap (SWS_CORE_01396) are
+     * those of std::vector.
+     * 
+     * \tparam T            the type of contained values
+     * \tparam Allocator    the type of allocator to use for this container
+     */
+    template <typename T, typename Allocator = PolymorphicAllocator<T>>
+    using Vector = std::vector<T, Allocator>;
 }
 }
@@ -11,7 +11,10 @@
 #ifndef ARA_EXEC_EXEC_ERROR_DOMAIN_H_
 #define ARA_EXEC_EXEC_ERROR_DOMAIN_H_
 
+#include <cstdint>
+#include "ara/core/error_code.h"
 #include "ara/core/error_domain.h"
+#include "ara/core/exception.h"
 
 namespace ara
 {
@@ -22,7 +25,7 @@ namespace ara
          * \brief Defines an enumeration class for the Execution Management error codes.
          * 
          */
-        enum class ExecErrc : ErrorDomain::CodeType
+        enum class ExecErrc : ara::core::ErrorDomain::CodeType
         {
             kGeneralError = 1,          /*< Some unspecified error occurred */
             kInvalidArguments = 2,      /*< Invalid argument was passed */
@@ -41,6 +44,7 @@ namespace ara
          */
         class ExecException : public ara::core::Exception
         {
+        public:
             // SWS_EM_02283
             /**
              * \brief Constructs a new ExecException object containing an error code.
@@ -50,6 +54,37 @@ namespace ara
             explicit ExecException(ara::core::ErrorCode errorCode) noexcept;
         };
 
+        namespace internal
+        {
+            /**
+             * \brief Holder of the static name and messages of ExecErrorDomain, a template so that the header can
+             * define them.
+             *
+             */
+            template <typename = void>
+            struct ExecErrorMessages
+            {
+                static constexpr ara::core::internal::ErrorMessage kMessages[] = {
+                    {static_cast<std::int32_t>(ExecErrc::kGeneralError), "general error"},
+                    {static_cast<std::int32_t>(ExecErrc::kInvalidArguments), "invalid arguments"},
+                    {static_cast<std::int32_t>(ExecErrc::kCommunicationError), "communication error"},
+                    {static_cast<std::int32_t>(ExecErrc::kMetaModelError), "meta model error"},
+                    {static_cast<std::int32_t>(ExecErrc::kCancelled), "transition cancelled"},
+                    {static_cast<std::int32_t>(ExecErrc::kFailed), "transition failed"},
+                };
+
+                static constexpr ara::core::internal::ErrorMessageTable kTable{
+                    0x8000000000000300ULL, "Exec", kMessages, sizeof(kMessages) / sizeof(kMessages[0]),
+                    "unknown exec error"};
+            };
+
+            template <typename Dummy>
+            constexpr ara::core::internal::ErrorMessage ExecErrorMessages<Dummy>::kMessages[];
+
+            template <typename Dummy>
+            constexpr ara::core::internal::ErrorMessageTable ExecErrorMessages<Dummy>::kTable;
+        } // namespace internal
+
         // SWS_EM_02290
         /**
          * \brief Returns a reference to the global ExecErrorDomain object.
@@ -77,8 +112,9 @@ namespace ara
          * 0x8000’0000’0000’0300ULL
          * 
          */
-        class ExecErrorDomain final : public ErrorDomain
+        class ExecErrorDomain final : public ara::core::ErrorDomain
         {
+        public:
             // SWS_EM_02286
             /**
              * \brief Constructs a new ExecErrorDomain object
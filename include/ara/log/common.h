@@ -12,6 +12,17 @@
 #define ARA_LOG_COMMON_H_
 
 #include <cstddef>
+#include <cstdint>
+
+/**
+ * \brief Least severe log level that is compiled in, as numerical LogLevel value (0 = kOff ... 6 = kVerbose).
+ * 
+ * Set by the ARA_LOG_MIN_LEVEL CMake option. Logger calls for more verbose levels return a NullLogStream and
+ * their whole "<<" chain is removed by the compiler.
+ */
+#ifndef ARA_LOG_MIN_LEVEL
+#define ARA_LOG_MIN_LEVEL 6
+#endif
 
 namespace ara
 {
@@ -34,6 +45,18 @@ namespace ara
                                 information) */
         };
 
+        /**
+         * \brief Check whether a log level survives the build-time ARA_LOG_MIN_LEVEL filter.
+         * 
+         * \param[in] level     the log level
+         * \return true         if messages of that level are compiled in
+         * \return false        otherwise
+         */
+        constexpr bool IsCompiledIn(LogLevel level) noexcept
+        {
+            return (level != LogLevel::kOff) && (static_cast<uint8_t>(level) <= ARA_LOG_MIN_LEVEL);
+        }
+
         // 
         /**
          * \brief Log mode. Flags, used to configure the sink for log messages.
@@ -47,6 +70,43 @@ namespace ara
             kConsole = 0x04,/*< Forward to console. */
         };
 
+        /**
+         * \brief Combine two LogMode flags.
+         * 
+         * \param[in] lhs   the left hand side flags
+         * \param[in] rhs   the right hand side flags
+         * \return LogMode  the union of both flag sets
+         */
+        constexpr LogMode operator|(LogMode lhs, LogMode rhs) noexcept
+        {
+            return static_cast<LogMode>(static_cast<uint8_t>(lhs) | static_cast<uint8_t>(rhs));
+        }
+
+        /**
+         * \brief Intersect two LogMode flags.
+         * 
+         * \param[in] lhs   the left hand side flags
+         * \param[in] rhs   the right hand side flags
+         * \return LogMode  the flags set in both operands
+         */
+        constexpr LogMode operator&(LogMode lhs, LogMode rhs) noexcept
+        {
+            return static_cast<LogMode>(static_cast<uint8_t>(lhs) & static_cast<uint8_t>(rhs));
+        }
+
+        /**
+         * \brief Check whether a flag is contained in a LogMode flag set.
+         * 
+         * \param[in] mode  the configured flag set
+         * \param[in] flag  the flag to look for
+         * \return true     if flag is set in mode
+         * \return false    otherwise
+         */
+        constexpr bool HasLogMode(LogMode mode, LogMode flag) noexcept
+        {
+            return (static_cast<uint8_t>(mode) & static_cast<uint8_t>(flag)) != 0U;
+        }
+
         // SWS_LOG_00098
         /**
          * \brief Client state representing the connection state of an external client. .
@@ -0,0 +1,156 @@
+/**
+ * \file log_record.h
+ * \author Vincent WANG (you@domain.com)
+ * \brief Binary layout of a log record as handed from a LogStream to the logging back-end.
+ * \version 0.1
+ * \date 2020-12-08
+ *
+ * \copyright Copyright (c) 2020
+ *
+ */
+#ifndef ARA_LOG_LOG_RECORD_H_
+#define ARA_LOG_LOG_RECORD_H_
+
+#include <cstddef>
+#include <cstdint>
+#include "ara/log/common.h"
+
+namespace ara
+{
+    namespace log
+    {
+        namespace internal
+        {
+            /**
+             * \brief Type tag written in front of every argument of a record payload.
+             *
+             * Fixed size arguments are followed by their raw value in host byte order. kString and
+             * kRawBuffer are followed by a uint16_t length and the bytes themselves.
+             *
+             * kSchema is followed by the uint32_t ID of the field names of the record's arguments and is always
+             * the first argument if present. It is not counted in RecordHeader::argCount. kSchemaDefinition
+             * only appears in binary logs, alone in a record; it is followed by the uint32_t schema ID, a
+             * uint8_t field count and per field the uint8_t argument index, the uint8_t ArgType and the name as
+             * uint8_t length and characters.
+             *
+             * \note The numerical values are part of the binary log format and must not be changed.
+             */
+            enum class ArgType : uint8_t
+            {
+                kBool = 0x01,
+                kUint8 = 0x02,
+                kUint16 = 0x03,
+                kUint32 = 0x04,
+                kUint64 = 0x05,
+                kInt8 = 0x06,
+                kInt16 = 0x07,
+                kInt32 = 0x08,
+                kInt64 = 0x09,
+                kFloat32 = 0x0A,
+                kFloat64 = 0x0B,
+                kString = 0x0C,
+                kRawBuffer = 0x0D,
+                kLogLevel = 0x0E,
+                kHex8 = 0x10,
+                kHex16 = 0x11,
+                kHex32 = 0x12,
+                kHex64 = 0x13,
+                kBin8 = 0x14,
+                kBin16 = 0x15,
+                kBin32 = 0x16,
+                kBin64 = 0x17,
+                kErrorCode = 0x18,
+                kSchema = 0x19,
+                kSchemaDefinition = 0x1A,
+            };
+
+            /**
+             * \brief Raw form of an ara::core::ErrorCode argument (ArgType::kErrorCode).
+             *
+             * The domain name and message are only resolved when the record is rendered, either on the logging
+             * thread through the domain pointer or offline through the domain ID.
+             */
+            struct ErrorCodeArg
+            {
+                std::uint64_t domainId;     /*< ErrorDomain::Id() */
+                std::uint64_t domain;       /*< address of the ErrorDomain, only meaningful inside the
+                                                producing process */
+                std::int32_t value;         /*< ErrorCode::Value() */
+                std::int32_t supportData;   /*< ErrorCode::SupportData() */
+            };
+
+            static_assert(sizeof(ErrorCodeArg) == 24U, "ErrorCodeArg is part of the binary log format");
+
+            /**
+             * \brief Return the size of the raw value following a fixed size argument tag.
+             *
+             * \param[in] type      the argument type
+             * \return std::size_t  the value size, 0 for kString/kRawBuffer/kSchemaDefinition and unknown tags
+             */
+            constexpr std::size_t FixedArgSize(ArgType type) noexcept
+            {
+                return ((type == ArgType::kBool) || (type == ArgType::kUint8) || (type == ArgType::kInt8)
+                        || (type == ArgType::kLogLevel) || (type == ArgType::kHex8) || (type == ArgType::kBin8)) ? 1U
+                     : ((type == ArgType::kUint16) || (type == ArgType::kInt16) || (type == ArgType::kHex16)
+                        || (type == ArgType::kBin16)) ? 2U
+                     : ((type == ArgType::kUint32) || (type == ArgType::kInt32) || (type == ArgType::kFloat32)
+                        || (type == ArgType::kHex32) || (type == ArgType::kBin32) || (type == ArgType::kSchema)) ? 4U
+                     : ((type == ArgType::kUint64) || (type == ArgType::kInt64) || (type == ArgType::kFloat64)
+                        || (type == ArgType::kHex64) || (type == ArgType::kBin64)) ? 8U
+                     : (type == ArgType::kErrorCode) ? sizeof(ErrorCodeArg)
+                     : 0U;
+            }
+
+            /**
+             * \brief Header in front of every record payload.
+             *
+             * A binary log, as read by the offline decoder, is a plain concatenation of records, each a
+             * RecordHeader directly followed by its payload.
+             */
+            struct RecordHeader
+            {
+                std::uint64_t timestamp;    /*< steady clock time of Flush() in nanoseconds */
+                char ctxId[4];              /*< DLT context ID, padded with '\0' */
+                std::uint16_t payloadSize;  /*< number of payload bytes following the header */
+                LogLevel level;             /*< severity of the record */
+                std::uint8_t argCount;      /*< number of encoded arguments */
+            };
+
+            static_assert(sizeof(RecordHeader) == 16U, "RecordHeader is part of the binary log format");
+
+            /**
+             * \brief Name of one structured argument, collected by a LogStream until the record is flushed.
+             *
+             */
+            struct FieldRef
+            {
+                char const *name;           /*< the field name, a string with static storage duration */
+                std::uint8_t argIndex;      /*< index of the argument among the record's arguments */
+                ArgType type;               /*< type of the argument */
+            };
+
+            /**
+             * \brief Maximum number of named arguments of one record, further names are ignored.
+             *
+             */
+            constexpr std::size_t kMaxFields = 16U;
+
+            /**
+             * \brief Maximum size of a record including its header.
+             *
+             * Arguments that do not fit anymore are dropped, strings and raw buffers are cut to the remaining space.
+             */
+            constexpr std::size_t kMaxRecordSize = 512U;
+
+            /**
+             * \brief Maximum size of a record payload.
+             *
+             */
+            constexpr std::size_t kMaxPayloadSize = kMaxRecordSize - sizeof(RecordHeader);
+        } // namespace internal
+    } // namespace log
+
+} // namespace ara
+
+
+#endif // ARA_LOG_LOG_RECORD_H_
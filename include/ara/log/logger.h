@@ -11,20 +11,67 @@
 #ifndef ARA_LOG_LOGGER_H_
 #define ARA_LOG_LOGGER_H_
 
+#include <atomic>
+#include <cstdint>
+#include <string>
+#include <type_traits>
+#include "ara/core/string_view.h"
+#include "ara/log/common.h"
 #include "ara/log/logstream.h"
 
 namespace ara
 {
     namespace log
     {
+        /**
+         * \brief Snapshot of the record counters of one Logger context.
+         * 
+         */
+        struct LogStatistics
+        {
+            std::uint64_t enqueued;     /*< records handed to the logging back-end */
+            std::uint64_t dropped;      /*< records lost because a buffer was full */
+            std::uint64_t flushed;      /*< records written to the configured sinks */
+        };
+
+        namespace internal
+        {
+            /**
+             * \brief Live record counters of one Logger context, updated by the logging back-end.
+             * 
+             */
+            struct ContextCounters
+            {
+                std::atomic<std::uint64_t> enqueued{0U};
+                std::atomic<std::uint64_t> dropped{0U};
+                std::atomic<std::uint64_t> flushed{0U};
+            };
+        } // namespace internal
+
         class Logger
         {
+        public:
+            /**
+             * \brief Construct a new Logger context.
+             * 
+             * Loggers are owned by the Logging framework, use CreateLogger() to obtain one.
+             * 
+             * \param[in] ctxId             The context ID, only the first 4 characters are used (DLT).
+             * \param[in] ctxDescription    The description of the context.
+             * \param[in] ctxDefLogLevel    The initial log level of the context.
+             */
+            Logger(ara::core::StringView ctxId, ara::core::StringView ctxDescription, LogLevel ctxDefLogLevel);
+
+            Logger(Logger const &) = delete;
+            Logger& operator=(Logger const &) = delete;
+
             // SWS_LOG_00064
             /**
              * \brief Creates a LogStream object.
              *  Returned object will accept arguments via the insert stream operator "@c <<".
              * 
-             * \return LogStream LogStream object of Fatal severity.
+             * \return LogStream LogStream object of Fatal severity, or a NullLogStream if Fatal is below the
+             *                   build-time minimum level ARA_LOG_MIN_LEVEL.
              * 
              * \note In the normal usage scenario, the object’s life time of the created LogStream is scoped within
              *  one statement (ends with ; after last passed argument). If one wants to extend the LogStream
@@ -32,7 +79,7 @@ namespace ara
              * 
              * \thread safety
              */
-            LogStream LogFatal() noexcept;
+            internal::StreamFor<LogLevel::kFatal> LogFatal() noexcept;
 
             // SWS_LOG_00065
             /**
@@ -42,7 +89,7 @@ namespace ara
              * \note 
              * \thread safety
              */
-            LogStream LogError() noexcept;
+            internal::StreamFor<LogLevel::kError> LogError() noexcept;
 
             // SWS_LOG_00066
             /**
@@ -52,7 +99,7 @@ namespace ara
              * \note 
              * \thread safety
              */
-            LogStream LogWarn() noexcept;
+            internal::StreamFor<LogLevel::kWarn> LogWarn() noexcept;
 
             // SWS_LOG_00067
             /**
@@ -62,7 +109,7 @@ namespace ara
              * \note 
              * \thread safety
              */
-            LogStream LogInfo() noexcept;
+            internal::StreamFor<LogLevel::kInfo> LogInfo() noexcept;
 
             // SWS_LOG_00068
             /**
@@ -72,7 +119,7 @@ namespace ara
              * \note 
              * \thread safety
              */
-            LogStream LogDebug() noexcept;
+            internal::StreamFor<LogLevel::kDebug> LogDebug() noexcept;
 
             // SWS_LOG_00069
             /**
@@ -82,7 +129,7 @@ namespace ara
              * \note 
              * \thread safety
              */
-            LogStream LogVerbose() noexcept;
+            internal::StreamFor<LogLevel::kVerbose> LogVerbose() noexcept;
 
             // SWS_LOG_00070
             /**
@@ -100,7 +147,104 @@ namespace ara
              * \thread safety reentrant
              */
             bool IsEnabled(LogLevel logLevel) const noexcept;
+
+            /**
+             * \brief Change the reporting level of this context at runtime.
+             * 
+             * \param[in] logLevel  The new log level.
+             * \thread safety reentrant
+             */
+            void SetLogLevel(LogLevel logLevel) noexcept;
+
+            /**
+             * \brief Return the DLT context ID, 4 characters padded with '\0' and not null terminated.
+             * 
+             * \return char const*  pointer to the 4 ID characters
+             */
+            char const* ContextId() const noexcept
+            {
+                return ctxId_;
+            }
+
+            /**
+             * \brief Return the description given to CreateLogger().
+             * 
+             * \return ara::core::StringView    the context description
+             */
+            ara::core::StringView ContextDescription() const noexcept;
+
+            /**
+             * \brief Return the number of records of this context enqueued, dropped and flushed so far.
+             * 
+             * \return LogStatistics    the counters
+             * \thread safety reentrant
+             */
+            LogStatistics Statistics() const noexcept;
+
+            /**
+             * \brief Return the live counters, for the logging back-end.
+             * 
+             * \return internal::ContextCounters&  the counters
+             */
+            internal::ContextCounters& Counters() const noexcept
+            {
+                return counters_;
+            }
+
+        private:
+            template <LogLevel Level>
+            LogStream MakeStream(std::true_type) const noexcept
+            {
+                return LogStream(Level, IsEnabled(Level) ? this : nullptr);
+            }
+
+            template <LogLevel Level>
+            NullLogStream MakeStream(std::false_type) const noexcept
+            {
+                return NullLogStream();
+            }
+
+            char ctxId_[4];
+            std::string ctxDescription_;
+            std::atomic<std::uint8_t> level_;
+            mutable internal::ContextCounters counters_;
         };
+
+        inline internal::StreamFor<LogLevel::kFatal> Logger::LogFatal() noexcept
+        {
+            return MakeStream<LogLevel::kFatal>(std::integral_constant<bool, IsCompiledIn(LogLevel::kFatal)>());
+        }
+
+        inline internal::StreamFor<LogLevel::kError> Logger::LogError() noexcept
+        {
+            return MakeStream<LogLevel::kError>(std::integral_constant<bool, IsCompiledIn(LogLevel::kError)>());
+        }
+
+        inline internal::StreamFor<LogLevel::kWarn> Logger::LogWarn() noexcept
+        {
+            return MakeStream<LogLevel::kWarn>(std::integral_constant<bool, IsCompiledIn(LogLevel::kWarn)>());
+        }
+
+        inline internal::StreamFor<LogLevel::kInfo> Logger::LogInfo() noexcept
+        {
+            return MakeStream<LogLevel::kInfo>(std::integral_constant<bool, IsCompiledIn(LogLevel::kInfo)>());
+        }
+
+        inline internal::StreamFor<LogLevel::kDebug> Logger::LogDebug() noexcept
+        {
+            return MakeStream<LogLevel::kDebug>(std::integral_constant<bool, IsCompiledIn(LogLevel::kDebug)>());
+        }
+
+        inline internal::StreamFor<LogLevel::kVerbose> Logger::LogVerbose() noexcept
+        {
+            return MakeStream<LogLevel::kVerbose>(std::integral_constant<bool, IsCompiledIn(LogLevel::kVerbose)>());
+        }
+
+        inline bool Logger::IsEnabled(LogLevel logLevel) const noexcept
+        {
+            return IsCompiledIn(logLevel)
+                && (static_cast<std::uint8_t>(logLevel) <= level_.load(std::memory_order_relaxed));
+        }
     } // namespace log
     
 } // namespace ara
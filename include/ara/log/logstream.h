@@ -12,7 +12,13 @@
 #define ARA_LOG_LOGSTREAM_H_
 
 #include <cstdint>
+#include <cstring>
+#include <type_traits>
+#include <utility>
 #include "ara/core/error_code.h"
+#include "ara/core/string_view.h"
+#include "ara/log/common.h"
+#include "ara/log/log_record.h"
 
 namespace ara
 {
@@ -28,7 +34,7 @@ namespace ara
          */
         struct LogHex8
         {
-            /* data */
+            uint8_t value;
         };
 
         // SWS_LOG_00109
@@ -38,7 +44,7 @@ namespace ara
          */
         struct LogHex16
         {
-            /* data */
+            uint16_t value;
         };
         
         // SWS_LOG_00110
@@ -48,7 +54,7 @@ namespace ara
          */
         struct LogHex32
         {
-            /* data */
+            uint32_t value;
         };
 
         // SWS_LOG_00111
@@ -58,7 +64,7 @@ namespace ara
          */
         struct LogHex64
         {
-            /* data */
+            uint64_t value;
         };
 
         // SWS_LOG_00112
@@ -68,7 +74,7 @@ namespace ara
          */
         struct LogBin8
         {
-            /* data */
+            uint8_t value;
         };
 
         // SWS_LOG_00113
@@ -78,7 +84,7 @@ namespace ara
          */
         struct LogBin16
         {
-            /* data */
+            uint16_t value;
         };
 
         // SWS_LOG_00114
@@ -88,7 +94,7 @@ namespace ara
          */
         struct LogBin32
         {
-            /* data */
+            uint32_t value;
         };
 
         // SWS_LOG_00115
@@ -98,7 +104,7 @@ namespace ara
          */
         struct LogBin64
         {
-            /* data */
+            uint64_t value;
         };
 
         // SWS_LOG_00116
@@ -111,11 +117,78 @@ namespace ara
          */
         struct LogRawBuffer
         {
-            /* data */
+            const void *const buffer;
+            uint16_t size;
         };
 
+        /**
+         * \brief A value with a field name, see Arg().
+         * 
+         * \tparam T    type of the value, anything a LogStream accepts
+         */
+        template <typename T>
+        struct LogArg
+        {
+            char const *name;
+            T const &value;
+        };
+
+        /**
+         * \brief Attach a field name to a logged value, e.g. logger.LogInfo() << Arg("speed", v).
+         * 
+         * The names and types of all named arguments of a message form a schema that is registered once and
+         * referenced by its ID, so only the values go into the log record. Renderers print "name=value".
+         * 
+         * \tparam T            type of the value
+         * \param[in] name      the field name, a string literal or another string that lives as long as
+         *                      the process
+         * \param[in] value     the value, it must outlive the logging statement
+         * \return LogArg<T>    the named value
+         */
+        template <typename T>
+        constexpr LogArg<T> Arg(char const *name, T const &value) noexcept
+        {
+            return LogArg<T>{name, value};
+        }
+
+        class Logger;
+
+        namespace internal
+        {
+            class CallSite;
+        } // namespace internal
+
         class LogStream
         {
+        public:
+            /**
+             * \brief Construct a new LogStream for one message of the given severity.
+             * 
+             * \param[in] level     severity of the message
+             * \param[in] logger    the Logger (context) the message belongs to, or nullptr if the
+             *                      severity is disabled for that context. A LogStream without a
+             *                      Logger ignores all arguments and never reaches the back-end.
+             * \note The stream owns a fixed-size inline buffer, construction never allocates.
+             */
+            LogStream(LogLevel level, Logger const *logger) noexcept;
+
+            /**
+             * \brief Move the pending message of another LogStream into a new one.
+             * 
+             * \param[in] other     the other instance, which is left without a Logger
+             */
+            LogStream(LogStream &&other) noexcept;
+
+            LogStream(LogStream const &) = delete;
+            LogStream& operator=(LogStream const &) = delete;
+            LogStream& operator=(LogStream &&) = delete;
+
+            /**
+             * \brief Flushes the pending message, even if it has no arguments.
+             * 
+             */
+            ~LogStream();
+
             // SWS_LOG_00039
             /**
              * \brief Sends out the current log buffer and initiates a new message stream.
@@ -367,19 +440,6 @@ namespace ara
              */
             LogStream& operator<<(const char *const value) noexcept;
 
-            // SWS_LOG_00063
-            /**
-             * \brief Appends LogLevel enum parameter as text into message.
-             * 
-             * \param[in] out 
-             * \param[in] value     LogLevel enum parameter as text to be appended to
-             *                      the internal message buffer.
-             * \return LogStream& 
-             * \note 
-             * \thread safety reentrant
-             */
-            LogStream& operator<<(LogStream &out, LogLevel value) noexcept;
-
             // SWS_LOG_00124
             /**
              * \brief Writes an ara::core::ErrorCode into the message, containing a String holding the results of
@@ -392,7 +452,283 @@ namespace ara
              * \thread safety reentrant
              */
             LogStream& operator<<(const ara::core::ErrorCode &value) noexcept;
+
+            /**
+             * \brief Writes a named value into message, see Arg().
+             * 
+             * \tparam T            type of the value
+             * \param[in] arg       the named value
+             * \return LogStream& 
+             * \thread safety reentrant
+             */
+            template <typename T>
+            LogStream& operator<<(const LogArg<T> &arg) noexcept;
+
+        private:
+            friend LogStream& operator<<(LogStream &out, LogLevel value) noexcept;
+            friend class internal::CallSite;
+
+            template <typename T>
+            LogStream& PutScalar(internal::ArgType type, T const &value) noexcept;
+
+            LogStream& PutBytes(internal::ArgType type, const void *data, std::size_t size) noexcept;
+
+            void AppendBytes(internal::ArgType type, const void *data, std::size_t size) noexcept;
+
+            bool ReserveSchema() noexcept;
+
+            void Reset() noexcept;
+
+            std::uint8_t* Payload() noexcept
+            {
+                return record_ + sizeof(internal::RecordHeader);
+            }
+
+            Logger const *logger_;
+            internal::CallSite *site_;   /*< rate-limited call site of the message, see ARA_LOG_RATE_LIMITED */
+            LogLevel level_;
+            std::uint8_t argCount_;
+            std::uint16_t size_;
+            std::uint8_t fieldCount_;
+            bool hasSchema_;
+            internal::FieldRef fields_[internal::kMaxFields];
+            alignas(internal::RecordHeader) std::uint8_t record_[internal::kMaxRecordSize];
+        };
+
+        // SWS_LOG_00063
+        /**
+         * \brief Appends LogLevel enum parameter as text into message.
+         * 
+         * \param[in] out 
+         * \param[in] value     LogLevel enum parameter as text to be appended to
+         *                      the internal message buffer.
+         * \return LogStream& 
+         * \note 
+         * \thread safety reentrant
+         */
+        LogStream& operator<<(LogStream &out, LogLevel value) noexcept;
+
+        /**
+         * \brief LogStream stand-in for log levels removed at build time by ARA_LOG_MIN_LEVEL.
+         * 
+         * Accepts every argument a LogStream accepts and does nothing with it. All members are constexpr
+         * inline, so a complete "<<" chain on a NullLogStream compiles to no code. Argument expressions are
+         * still evaluated unless they are free of side effects.
+         */
+        class NullLogStream final
+        {
+        public:
+            constexpr NullLogStream() noexcept = default;
+
+            /**
+             * \brief Does nothing.
+             * 
+             */
+            void Flush() noexcept
+            {
+            }
+
+            /**
+             * \brief Discards the given value.
+             * 
+             * Only takes part in overload resolution for the types a LogStream accepts, including user-defined
+             * operator<< overloads, so code that compiles with a level removed also compiles with it enabled.
+             * 
+             * \tparam T            type of the value
+             * \return NullLogStream&   *this
+             */
+            template <typename T, typename = decltype(std::declval<LogStream &>() << std::declval<T const &>())>
+            constexpr NullLogStream& operator<<(T const &) noexcept
+            {
+                return *this;
+            }
         };
+
+        namespace internal
+        {
+            /**
+             * \brief Select LogStream or NullLogStream depending on the build-time minimum level.
+             * 
+             */
+            template <LogLevel Level>
+            using StreamFor = typename std::conditional<IsCompiledIn(Level), LogStream, NullLogStream>::type;
+        } // namespace internal
+
+        inline LogStream::LogStream(LogLevel level, Logger const *logger) noexcept
+            : logger_(logger), site_(nullptr), level_(level), argCount_(0U), size_(0U), fieldCount_(0U), hasSchema_(false)
+        {
+        }
+
+        inline LogStream::~LogStream()
+        {
+            if (logger_ != nullptr)
+            {
+                Flush();
+            }
+        }
+
+        inline LogStream& LogStream::PutBytes(internal::ArgType type, const void *data, std::size_t size) noexcept
+        {
+            if (logger_ != nullptr)
+            {
+                AppendBytes(type, data, size);
+            }
+            return *this;
+        }
+
+        template <typename T>
+        inline LogStream& LogStream::PutScalar(internal::ArgType type, T const &value) noexcept
+        {
+            static_assert(std::is_trivially_copyable<T>::value, "only trivially copyable values are encoded raw");
+
+            if ((logger_ != nullptr) && ((size_ + 1U + sizeof(T)) <= internal::kMaxPayloadSize))
+            {
+                std::uint8_t *dst = Payload() + size_;
+                dst[0] = static_cast<std::uint8_t>(type);
+                std::memcpy(dst + 1, &value, sizeof(T));
+                size_ = static_cast<std::uint16_t>(size_ + 1U + sizeof(T));
+                ++argCount_;
+            }
+            return *this;
+        }
+
+        inline LogStream& LogStream::operator<<(bool value) noexcept
+        {
+            return PutScalar(internal::ArgType::kBool, static_cast<std::uint8_t>(value ? 1U : 0U));
+        }
+
+        inline LogStream& LogStream::operator<<(uint8_t value) noexcept
+        {
+            return PutScalar(internal::ArgType::kUint8, value);
+        }
+
+        inline LogStream& LogStream::operator<<(uint16_t value) noexcept
+        {
+            return PutScalar(internal::ArgType::kUint16, value);
+        }
+
+        inline LogStream& LogStream::operator<<(uint32_t value) noexcept
+        {
+            return PutScalar(internal::ArgType::kUint32, value);
+        }
+
+        inline LogStream& LogStream::operator<<(uint64_t value) noexcept
+        {
+            return PutScalar(internal::ArgType::kUint64, value);
+        }
+
+        inline LogStream& LogStream::operator<<(int8_t value) noexcept
+        {
+            return PutScalar(internal::ArgType::kInt8, value);
+        }
+
+        inline LogStream& LogStream::operator<<(int16_t value) noexcept
+        {
+            return PutScalar(internal::ArgType::kInt16, value);
+        }
+
+        inline LogStream& LogStream::operator<<(int32_t value) noexcept
+        {
+            return PutScalar(internal::ArgType::kInt32, value);
+        }
+
+        inline LogStream& LogStream::operator<<(int64_t value) noexcept
+        {
+            return PutScalar(internal::ArgType::kInt64, value);
+        }
+
+        inline LogStream& LogStream::operator<<(float value) noexcept
+        {
+            return PutScalar(internal::ArgType::kFloat32, value);
+        }
+
+        inline LogStream& LogStream::operator<<(double value) noexcept
+        {
+            return PutScalar(internal::ArgType::kFloat64, value);
+        }
+
+        inline LogStream& LogStream::operator<<(const LogRawBuffer &value) noexcept
+        {
+            return PutBytes(internal::ArgType::kRawBuffer, value.buffer, value.size);
+        }
+
+        inline LogStream& LogStream::operator<<(const LogHex8 &value) noexcept
+        {
+            return PutScalar(internal::ArgType::kHex8, value.value);
+        }
+
+        inline LogStream& LogStream::operator<<(const LogHex16 &value) noexcept
+        {
+            return PutScalar(internal::ArgType::kHex16, value.value);
+        }
+
+        inline LogStream& LogStream::operator<<(const LogHex32 &value) noexcept
+        {
+            return PutScalar(internal::ArgType::kHex32, value.value);
+        }
+
+        inline LogStream& LogStream::operator<<(const LogHex64 &value) noexcept
+        {
+            return PutScalar(internal::ArgType::kHex64, value.value);
+        }
+
+        inline LogStream& LogStream::operator<<(const LogBin8 &value) noexcept
+        {
+            return PutScalar(internal::ArgType::kBin8, value.value);
+        }
+
+        inline LogStream& LogStream::operator<<(const LogBin16 &value) noexcept
+        {
+            return PutScalar(internal::ArgType::kBin16, value.value);
+        }
+
+        inline LogStream& LogStream::operator<<(const LogBin32 &value) noexcept
+        {
+            return PutScalar(internal::ArgType::kBin32, value.value);
+        }
+
+        inline LogStream& LogStream::operator<<(const LogBin64 &value) noexcept
+        {
+            return PutScalar(internal::ArgType::kBin64, value.value);
+        }
+
+        inline LogStream& LogStream::operator<<(const ara::core::ErrorCode &value) noexcept
+        {
+            internal::ErrorCodeArg const arg{
+                value.Domain().Id(),
+                static_cast<std::uint64_t>(reinterpret_cast<std::uintptr_t>(&value.Domain())),
+                static_cast<std::int32_t>(value.Value()),
+                static_cast<std::int32_t>(value.SupportData())};
+            return PutScalar(internal::ArgType::kErrorCode, arg);
+        }
+
+        inline LogStream& LogStream::operator<<(const ara::core::StringView &value) noexcept
+        {
+            return PutBytes(internal::ArgType::kString, value.data(), value.size());
+        }
+
+        inline LogStream& LogStream::operator<<(const char *const value) noexcept
+        {
+            return PutBytes(internal::ArgType::kString, value, (value != nullptr) ? std::strlen(value) : 0U);
+        }
+
+        template <typename T>
+        inline LogStream& LogStream::operator<<(const LogArg<T> &arg) noexcept
+        {
+            if ((logger_ == nullptr) || (!hasSchema_ && !ReserveSchema()))
+            {
+                return *this << arg.value;
+            }
+
+            std::uint8_t const index = argCount_;
+            std::uint16_t const offset = size_;
+            *this << arg.value;
+            if ((argCount_ != index) && (fieldCount_ < internal::kMaxFields))
+            {
+                fields_[fieldCount_++] = internal::FieldRef{arg.name, index, static_cast<internal::ArgType>(Payload()[offset])};
+            }
+            return *this;
+        }
     } // namespace log
     
 } // namespace ara
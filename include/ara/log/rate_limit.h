@@ -0,0 +1,257 @@
+/**
+ * \file rate_limit.h
+ * \author Vincent WANG (you@domain.com)
+ * \brief Per call site rate limiting and deduplication of log messages.
+ * \version 0.1
+ * \date 2020-12-08
+ *
+ * \copyright Copyright (c) 2020
+ *
+ */
+#ifndef ARA_LOG_RATE_LIMIT_H_
+#define ARA_LOG_RATE_LIMIT_H_
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include "ara/log/common.h"
+#include "ara/log/logstream.h"
+
+/**
+ * \brief Limit a log statement to a sustained rate with bursts, and collapse identical repetitions.
+ *
+ * \code
+ * ARA_LOG_RATE_LIMITED(logger.LogError(), 10, 50) << "read failed" << error;
+ * \endcode
+ *
+ * A statement over its budget costs a single atomic decrement, its arguments are not encoded. A message
+ * identical to the previous one of the same statement is not forwarded either. Both are counted and reported
+ * by the logging thread as "last message repeated N times", at most once per second and call site.
+ *
+ * \param stream            the LogStream, e.g. logger.LogWarn()
+ * \param ratePerSecond     sustained number of messages per second, an integral constant
+ * \param burst             number of messages that may be logged at once, an integral constant
+ */
+#define ARA_LOG_RATE_LIMITED(stream, ratePerSecond, burst)                                                        \
+    (::ara::log::internal::CallSiteFor<::ara::log::internal::CallSiteKey(__FILE__, __LINE__), (ratePerSecond), \
+                                       (burst)>().Admit(stream))
+
+namespace ara
+{
+    namespace log
+    {
+        namespace internal
+        {
+            /**
+             * \brief Return the compile-time key of a call site, the FNV-1a hash of its file name and line.
+             *
+             * \param[in] file      the file name, usually __FILE__
+             * \param[in] line      the line, usually __LINE__
+             * \return std::uint32_t    the key
+             */
+            constexpr std::uint32_t CallSiteKey(char const *file, std::uint32_t line) noexcept
+            {
+                std::uint32_t hash = 2166136261U;
+                for (; *file != '\0'; ++file)
+                {
+                    hash = (hash ^ static_cast<std::uint8_t>(*file)) * 16777619U;
+                }
+                for (std::uint32_t i = 0U; i < 4U; ++i)
+                {
+                    hash = (hash ^ ((line >> (i * 8U)) & 0xFFU)) * 16777619U;
+                }
+                return hash;
+            }
+
+            /**
+             * \brief Return the FNV-1a hash of an encoded record payload.
+             *
+             * \param[in] payload   the encoded arguments
+             * \param[in] size      the number of payload bytes
+             * \return std::uint64_t    the hash
+             */
+            inline std::uint64_t PayloadHash(std::uint8_t const *payload, std::size_t size) noexcept
+            {
+                std::uint64_t hash = 14695981039346656037ULL;
+                for (std::size_t i = 0U; i < size; ++i)
+                {
+                    hash = (hash ^ payload[i]) * 1099511628211ULL;
+                }
+                return hash;
+            }
+
+            /**
+             * \brief Token bucket and repetition counter of one ARA_LOG_RATE_LIMITED statement.
+             *
+             * Producers only ever decrement the token count; tokens below zero count the throttled messages.
+             * The logging thread refills the bucket, takes over the throttled and repeated counts and reports
+             * them. All call sites form an intrusive list that is only appended to.
+             *
+             * Two statements with the same key, i.e. on the same line of the same file, share one instance.
+             */
+            class CallSite final
+            {
+            public:
+                /**
+                 * \brief Construct a full bucket and register it with the logging thread.
+                 *
+                 * \param[in] key       the call site key, see CallSiteKey()
+                 * \param[in] rate      messages per second
+                 * \param[in] burst     bucket size
+                 */
+                CallSite(std::uint32_t key, std::uint32_t rate, std::uint32_t burst) noexcept;
+
+                CallSite(CallSite const &) = delete;
+                CallSite& operator=(CallSite const &) = delete;
+
+                /**
+                 * \brief Take one token for a new message.
+                 *
+                 * \param[in] stream    the empty stream of the message
+                 * \return LogStream    the stream, disabled if the call site is over its budget
+                 */
+                LogStream Admit(LogStream &&stream) noexcept
+                {
+                    if (stream.logger_ != nullptr)
+                    {
+                        if (tokens_.fetch_sub(1, std::memory_order_relaxed) <= 0)
+                        {
+                            stream.logger_ = nullptr;
+                        }
+                        else
+                        {
+                            logger_.store(stream.logger_, std::memory_order_relaxed);
+                            level_.store(stream.level_, std::memory_order_relaxed);
+                            stream.site_ = this;
+                        }
+                    }
+                    return std::move(stream);
+                }
+
+                /**
+                 * \brief Pass through a stream of a log level removed at build time.
+                 *
+                 * \param[in] stream    the stream
+                 * \return NullLogStream    the stream
+                 */
+                NullLogStream Admit(NullLogStream stream) const noexcept
+                {
+                    return stream;
+                }
+
+                /**
+                 * \brief Check whether a message equals the previous one of this call site, and count it if so.
+                 *
+                 * \param[in] hash      the PayloadHash() of the message
+                 * \return true         if the message is a repetition and shall be dropped
+                 * \return false        otherwise
+                 */
+                bool IsRepeat(std::uint64_t hash) noexcept
+                {
+                    if (lastHash_.exchange(hash, std::memory_order_relaxed) == hash)
+                    {
+                        repeated_.fetch_add(1U, std::memory_order_relaxed);
+                        return true;
+                    }
+                    return false;
+                }
+
+                /**
+                 * \brief Refill the bucket and collect the suppressed messages. Logging thread only.
+                 *
+                 * \param[in] now       steady clock time in nanoseconds
+                 * \return std::uint64_t    the number of suppressed messages to report now, 0 if none or if the
+                 *                          last report was less than a second ago
+                 */
+                std::uint64_t Refill(std::uint64_t now) noexcept;
+
+                /**
+                 * \brief Return the first registered call site.
+                 *
+                 * \return CallSite*    the call site, or nullptr
+                 */
+                static CallSite* First() noexcept;
+
+                /**
+                 * \brief Return the call site registered before this one.
+                 *
+                 * \return CallSite*    the call site, or nullptr
+                 */
+                CallSite* Next() const noexcept
+                {
+                    return next_;
+                }
+
+                /**
+                 * \brief Return the key of the call site.
+                 *
+                 * \return std::uint32_t    the key
+                 */
+                std::uint32_t Key() const noexcept
+                {
+                    return key_;
+                }
+
+                /**
+                 * \brief Return the Logger of the last admitted message.
+                 *
+                 * \return Logger const*    the Logger, never nullptr once a message was admitted
+                 */
+                Logger const* LastLogger() const noexcept
+                {
+                    return logger_.load(std::memory_order_relaxed);
+                }
+
+                /**
+                 * \brief Return the level of the last admitted message.
+                 *
+                 * \return LogLevel     the level
+                 */
+                LogLevel LastLevel() const noexcept
+                {
+                    return level_.load(std::memory_order_relaxed);
+                }
+
+            private:
+                std::uint32_t const key_;
+                std::uint32_t const rate_;
+                std::int64_t const burst_;
+
+                std::atomic<std::int64_t> tokens_;
+                std::atomic<std::uint64_t> lastHash_;
+                std::atomic<std::uint64_t> repeated_;
+                std::atomic<Logger const *> logger_;
+                std::atomic<LogLevel> level_;
+
+                // owned by the logging thread
+                std::uint64_t lastRefill_;
+                std::uint64_t lastReport_;
+                std::uint64_t credit_;   /*< tokens earned but not yet granted, scaled by 1e9 */
+                std::uint64_t pending_;
+
+                CallSite *next_;
+            };
+
+            /**
+             * \brief Return the CallSite of one ARA_LOG_RATE_LIMITED statement.
+             *
+             * \tparam Key      the call site key
+             * \tparam Rate     messages per second
+             * \tparam Burst    bucket size
+             * \return CallSite&    the call site, constructed on first use
+             */
+            template <std::uint32_t Key, std::uint32_t Rate, std::uint32_t Burst>
+            CallSite& CallSiteFor() noexcept
+            {
+                static_assert(Burst > 0U, "a call site needs a bucket of at least one message");
+                static CallSite site(Key, Rate, Burst);
+                return site;
+            }
+        } // namespace internal
+    } // namespace log
+
+} // namespace ara
+
+
+#endif // ARA_LOG_RATE_LIMIT_H_
@@ -0,0 +1,58 @@
+/**
+ * \file abort.cpp
+ * \author Vincent WANG (vin@misday.com)
+ * \brief
+ * \version 0.1
+ * \date 2021-11-12
+ *
+ * \copyright Copyright (c) 2021
+ *
+ */
+#include "ara/core/abort.h"
+
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <mutex>
+
+namespace ara
+{
+namespace core
+{
+    namespace
+    {
+        std::atomic<AbortHandler> abortHandler{nullptr};
+
+        // Held by the first Abort() for good, so that concurrent calls block.
+        std::mutex abortMutex;
+
+        thread_local bool aborting = false;
+    } // namespace
+
+    AbortHandler SetAbortHandler(AbortHandler handler) noexcept
+    {
+        return abortHandler.exchange(handler, std::memory_order_acq_rel);
+    }
+
+    void Abort(char const *text) noexcept
+    {
+        // Abort() called again from the handler, or from what it logs, ends the process right away.
+        if (aborting)
+        {
+            std::abort();
+        }
+        aborting = true;
+        abortMutex.lock();
+
+        std::fprintf(stderr, "[FATAL] ara::core::Abort: %s\n", (text != nullptr) ? text : "");
+        std::fflush(stderr);
+
+        AbortHandler const handler = abortHandler.load(std::memory_order_acquire);
+        if (handler != nullptr)
+        {
+            handler();
+        }
+        std::abort();
+    }
+} // namespace core
+} // namespace ara
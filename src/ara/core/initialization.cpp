@@ -0,0 +1,30 @@
+/**
+ * \file initialization.cpp
+ * \author Vincent WANG (vin@misday.com)
+ * \brief
+ * \version 0.1
+ * \date 2021-11-12
+ *
+ * \copyright Copyright (c) 2021
+ *
+ */
+#include "ara/core/initialization.h"
+
+#include "ara/core/instance_specifier_table.h"
+
+namespace ara
+{
+namespace core
+{
+    Result<void> Initialize()
+    {
+        internal::InstanceSpecifierTable::Instance().Freeze();
+        return Result<void>();
+    }
+
+    Result<void> Deinitialize()
+    {
+        return Result<void>();
+    }
+} // namespace core
+} // namespace ara
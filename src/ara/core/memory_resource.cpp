@@ -0,0 +1,71 @@
+/**
+ * \file memory_resource.cpp
+ * \author Vincent WANG (vin@misday.com)
+ * \brief
+ * \version 0.1
+ * \date 2021-11-12
+ *
+ * \copyright Copyright (c) 2021
+ *
+ */
+#include "ara/core/memory_resource.h"
+
+namespace ara
+{
+namespace core
+{
+    namespace internal
+    {
+#if defined(__cpp_aligned_new)
+        void* NewDeleteResource::do_allocate(std::size_t bytes, std::size_t alignment)
+        {
+            if (alignment > __STDCPP_DEFAULT_NEW_ALIGNMENT__)
+            {
+                return ::operator new(bytes, std::align_val_t(alignment));
+            }
+            return ::operator new(bytes);
+        }
+
+        void NewDeleteResource::do_deallocate(void *p, std::size_t, std::size_t alignment) noexcept
+        {
+            if (alignment > __STDCPP_DEFAULT_NEW_ALIGNMENT__)
+            {
+                ::operator delete(p, std::align_val_t(alignment));
+                return;
+            }
+            ::operator delete(p);
+        }
+#else
+        // Without aligned operator new, an over-aligned block is carved out of a larger one; the address of the
+        // larger block is stored right in front of the aligned one.
+        void* NewDeleteResource::do_allocate(std::size_t bytes, std::size_t alignment)
+        {
+            if (alignment <= alignof(std::max_align_t))
+            {
+                return ::operator new(bytes);
+            }
+
+            std::size_t const overhead = alignment + sizeof(void *);
+            if (bytes > (std::numeric_limits<std::size_t>::max() - overhead))
+            {
+                internal::ThrowOrAbort<std::bad_alloc>("NewDeleteMemoryResource::allocate");
+            }
+            void *const block = ::operator new(bytes + overhead);
+            std::uintptr_t const aligned = AlignUp(reinterpret_cast<std::uintptr_t>(block) + sizeof(void *), alignment);
+            reinterpret_cast<void **>(aligned)[-1] = block;
+            return reinterpret_cast<void *>(aligned);
+        }
+
+        void NewDeleteResource::do_deallocate(void *p, std::size_t, std::size_t alignment) noexcept
+        {
+            if (alignment <= alignof(std::max_align_t))
+            {
+                ::operator delete(p);
+                return;
+            }
+            ::operator delete(static_cast<void **>(p)[-1]);
+        }
+#endif
+    } // namespace internal
+} // namespace core
+} // namespace ara
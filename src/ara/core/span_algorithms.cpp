@@ -0,0 +1,317 @@
+/**
+ * \file span_algorithms.cpp
+ * \author Vincent WANG (vin@misday.com)
+ * \brief
+ * \version 0.1
+ * \date 2021-11-12
+ *
+ * \copyright Copyright (c) 2021
+ *
+ */
+#include "ara/core/span_algorithms.h"
+
+#include <algorithm>
+#include <cstring>
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#define ARA_CORE_SPAN_X86 1
+#include <immintrin.h>
+#endif
+
+namespace ara
+{
+namespace core
+{
+    namespace
+    {
+        struct CrcTables
+        {
+            std::uint32_t entries[8][256];
+        };
+
+        // Tables for slicing-by-8: entries[k][b] is the CRC of byte b followed by k zero bytes.
+        constexpr CrcTables MakeCrcTables(std::uint32_t polynomial) noexcept
+        {
+            CrcTables tables{};
+            for (std::uint32_t i = 0U; i < 256U; ++i)
+            {
+                std::uint32_t crc = i;
+                for (int bit = 0; bit < 8; ++bit)
+                {
+                    crc = (crc >> 1) ^ (((crc & 1U) != 0U) ? polynomial : 0U);
+                }
+                tables.entries[0][i] = crc;
+            }
+            for (std::size_t k = 1U; k < 8U; ++k)
+            {
+                for (std::size_t i = 0U; i < 256U; ++i)
+                {
+                    std::uint32_t const previous = tables.entries[k - 1U][i];
+                    tables.entries[k][i] = (previous >> 8) ^ tables.entries[0][previous & 0xFFU];
+                }
+            }
+            return tables;
+        }
+
+        constexpr CrcTables kCrc32Tables = MakeCrcTables(0xEDB88320U);
+        constexpr CrcTables kCrc32CTables = MakeCrcTables(0x82F63B78U);
+
+        inline std::uint32_t LoadLittleEndian32(std::uint8_t const *p) noexcept
+        {
+            return static_cast<std::uint32_t>(p[0]) | (static_cast<std::uint32_t>(p[1]) << 8) |
+                   (static_cast<std::uint32_t>(p[2]) << 16) | (static_cast<std::uint32_t>(p[3]) << 24);
+        }
+
+        // Reflected CRC over the running register crc (not inverted), eight bytes per step.
+        std::uint32_t CrcSlicing(CrcTables const &tables, std::uint32_t crc, std::uint8_t const *p,
+                                 std::size_t size) noexcept
+        {
+            auto const &t = tables.entries;
+            for (; size >= 8U; size -= 8U, p += 8U)
+            {
+                std::uint32_t const lo = LoadLittleEndian32(p) ^ crc;
+                std::uint32_t const hi = LoadLittleEndian32(p + 4U);
+                crc = t[7][lo & 0xFFU] ^ t[6][(lo >> 8) & 0xFFU] ^ t[5][(lo >> 16) & 0xFFU] ^ t[4][lo >> 24] ^
+                      t[3][hi & 0xFFU] ^ t[2][(hi >> 8) & 0xFFU] ^ t[1][(hi >> 16) & 0xFFU] ^ t[0][hi >> 24];
+            }
+            for (; size > 0U; --size, ++p)
+            {
+                crc = (crc >> 8) ^ t[0][(crc ^ *p) & 0xFFU];
+            }
+            return crc;
+        }
+
+        std::uint32_t Crc32CScalar(std::uint32_t crc, std::uint8_t const *p, std::size_t size) noexcept
+        {
+            return CrcSlicing(kCrc32CTables, crc, p, size);
+        }
+
+        template <std::size_t Width>
+        void SwapWordsScalar(std::uint8_t *p, std::size_t words) noexcept
+        {
+            for (; words > 0U; --words, p += Width)
+            {
+                std::reverse(p, p + Width);
+            }
+        }
+
+        void SwapByteOrderScalar(std::uint8_t *p, std::size_t size, std::size_t width) noexcept
+        {
+            switch (width)
+            {
+            case 2U:
+                SwapWordsScalar<2U>(p, size / 2U);
+                break;
+            case 4U:
+                SwapWordsScalar<4U>(p, size / 4U);
+                break;
+            case 8U:
+                SwapWordsScalar<8U>(p, size / 8U);
+                break;
+            default:
+                break;
+            }
+        }
+
+        void XorBytesScalar(std::uint8_t *target, std::uint8_t const *source, std::size_t size) noexcept
+        {
+            for (; size >= 8U; size -= 8U, target += 8U, source += 8U)
+            {
+                std::uint64_t a;
+                std::uint64_t b;
+                std::memcpy(&a, target, 8U);
+                std::memcpy(&b, source, 8U);
+                a ^= b;
+                std::memcpy(target, &a, 8U);
+            }
+            for (; size > 0U; --size, ++target, ++source)
+            {
+                *target = static_cast<std::uint8_t>(*target ^ *source);
+            }
+        }
+
+#if defined(ARA_CORE_SPAN_X86)
+        // pshufb masks reversing every word of 2, 4 and 8 bytes within 16 bytes.
+        alignas(16) constexpr std::uint8_t kSwapMasks[3][16] = {
+            {1U, 0U, 3U, 2U, 5U, 4U, 7U, 6U, 9U, 8U, 11U, 10U, 13U, 12U, 15U, 14U},
+            {3U, 2U, 1U, 0U, 7U, 6U, 5U, 4U, 11U, 10U, 9U, 8U, 15U, 14U, 13U, 12U},
+            {7U, 6U, 5U, 4U, 3U, 2U, 1U, 0U, 15U, 14U, 13U, 12U, 11U, 10U, 9U, 8U},
+        };
+
+        // width is 2, 4 or 8
+        inline __m128i SwapMask(std::size_t width) noexcept
+        {
+            std::size_t const index = (width == 2U) ? 0U : ((width == 4U) ? 1U : 2U);
+            return _mm_load_si128(reinterpret_cast<__m128i const *>(kSwapMasks[index]));
+        }
+
+        __attribute__((target("sse4.2"))) std::uint32_t Crc32CSse42(std::uint32_t crc, std::uint8_t const *p,
+                                                                     std::size_t size) noexcept
+        {
+            std::uint64_t crc64 = crc;
+            for (; size >= 8U; size -= 8U, p += 8U)
+            {
+                std::uint64_t word;
+                std::memcpy(&word, p, 8U);
+                crc64 = _mm_crc32_u64(crc64, word);
+            }
+            crc = static_cast<std::uint32_t>(crc64);
+            for (; size > 0U; --size, ++p)
+            {
+                crc = _mm_crc32_u8(crc, *p);
+            }
+            return crc;
+        }
+
+        __attribute__((target("sse4.2"))) void SwapByteOrderSse42(std::uint8_t *p, std::size_t size,
+                                                                   std::size_t width) noexcept
+        {
+            if ((width != 2U) && (width != 4U) && (width != 8U))
+            {
+                return;
+            }
+            __m128i const mask = SwapMask(width);
+            for (; size >= 16U; size -= 16U, p += 16U)
+            {
+                __m128i const v = _mm_loadu_si128(reinterpret_cast<__m128i const *>(p));
+                _mm_storeu_si128(reinterpret_cast<__m128i *>(p), _mm_shuffle_epi8(v, mask));
+            }
+            SwapByteOrderScalar(p, size, width);
+        }
+
+        __attribute__((target("sse4.2"))) void XorBytesSse42(std::uint8_t *target, std::uint8_t const *source,
+                                                              std::size_t size) noexcept
+        {
+            for (; size >= 16U; size -= 16U, target += 16U, source += 16U)
+            {
+                __m128i const a = _mm_loadu_si128(reinterpret_cast<__m128i const *>(target));
+                __m128i const b = _mm_loadu_si128(reinterpret_cast<__m128i const *>(source));
+                _mm_storeu_si128(reinterpret_cast<__m128i *>(target), _mm_xor_si128(a, b));
+            }
+            XorBytesScalar(target, source, size);
+        }
+
+        __attribute__((target("avx2"))) void SwapByteOrderAvx2(std::uint8_t *p, std::size_t size,
+                                                                std::size_t width) noexcept
+        {
+            if ((width != 2U) && (width != 4U) && (width != 8U))
+            {
+                return;
+            }
+            __m128i const mask = SwapMask(width);
+            __m256i const wideMask = _mm256_broadcastsi128_si256(mask);
+            for (; size >= 32U; size -= 32U, p += 32U)
+            {
+                __m256i const v = _mm256_loadu_si256(reinterpret_cast<__m256i const *>(p));
+                _mm256_storeu_si256(reinterpret_cast<__m256i *>(p), _mm256_shuffle_epi8(v, wideMask));
+            }
+            if (size >= 16U)
+            {
+                __m128i const v = _mm_loadu_si128(reinterpret_cast<__m128i const *>(p));
+                _mm_storeu_si128(reinterpret_cast<__m128i *>(p), _mm_shuffle_epi8(v, mask));
+                size -= 16U;
+                p += 16U;
+            }
+            // GCC does not clear the upper halves before a tail call, and legacy SSE code running with dirty
+            // upper halves pays a state transition on every instruction on many cores.
+            _mm256_zeroupper();
+            SwapByteOrderScalar(p, size, width);
+        }
+
+        __attribute__((target("avx2"))) void XorBytesAvx2(std::uint8_t *target, std::uint8_t const *source,
+                                                           std::size_t size) noexcept
+        {
+            for (; size >= 32U; size -= 32U, target += 32U, source += 32U)
+            {
+                __m256i const a = _mm256_loadu_si256(reinterpret_cast<__m256i const *>(target));
+                __m256i const b = _mm256_loadu_si256(reinterpret_cast<__m256i const *>(source));
+                _mm256_storeu_si256(reinterpret_cast<__m256i *>(target), _mm256_xor_si256(a, b));
+            }
+            XorBytesSse42(target, source, size);
+        }
+#endif
+
+        // The kernels used by this process.
+        struct Kernels
+        {
+            void (*swapByteOrder)(std::uint8_t *, std::size_t, std::size_t) noexcept;
+            void (*xorBytes)(std::uint8_t *, std::uint8_t const *, std::size_t) noexcept;
+            std::uint32_t (*crc32c)(std::uint32_t, std::uint8_t const *, std::size_t) noexcept;
+        };
+
+        Kernels SelectKernels() noexcept
+        {
+            Kernels kernels{&SwapByteOrderScalar, &XorBytesScalar, &Crc32CScalar};
+#if defined(ARA_CORE_SPAN_X86)
+            __builtin_cpu_init();
+            if (__builtin_cpu_supports("sse4.2"))
+            {
+                kernels = Kernels{&SwapByteOrderSse42, &XorBytesSse42, &Crc32CSse42};
+                if (__builtin_cpu_supports("avx2"))
+                {
+                    kernels.swapByteOrder = &SwapByteOrderAvx2;
+                    kernels.xorBytes = &XorBytesAvx2;
+                }
+            }
+#endif
+            return kernels;
+        }
+
+        Kernels const& GetKernels() noexcept
+        {
+            static Kernels const kernels = SelectKernels();
+            return kernels;
+        }
+    } // namespace
+
+    // memchr() and memcmp() of the C library already pick SSE2/AVX2/AVX-512 code at load time, so the
+    // search and comparison kernels defer to them.
+    std::size_t FindByte(Span<std::uint8_t const> data, std::uint8_t value) noexcept
+    {
+        if (data.empty())
+        {
+            return 0U;
+        }
+        void const *const found = std::memchr(data.data(), value, data.size());
+        return (found == nullptr) ? data.size()
+                                  : static_cast<std::size_t>(static_cast<std::uint8_t const *>(found) - data.data());
+    }
+
+    bool EqualBytes(Span<std::uint8_t const> lhs, Span<std::uint8_t const> rhs) noexcept
+    {
+        return (lhs.size() == rhs.size()) &&
+               (lhs.empty() || (lhs.data() == rhs.data()) || (std::memcmp(lhs.data(), rhs.data(), lhs.size()) == 0));
+    }
+
+    int CompareBytes(Span<std::uint8_t const> lhs, Span<std::uint8_t const> rhs) noexcept
+    {
+        std::size_t const common = std::min(lhs.size(), rhs.size());
+        int const result = (common == 0U) ? 0 : std::memcmp(lhs.data(), rhs.data(), common);
+        if (result != 0)
+        {
+            return result;
+        }
+        return (lhs.size() < rhs.size()) ? -1 : ((lhs.size() > rhs.size()) ? 1 : 0);
+    }
+
+    void SwapByteOrder(Span<std::uint8_t> data, std::size_t width) noexcept
+    {
+        GetKernels().swapByteOrder(data.data(), data.size(), width);
+    }
+
+    void XorBytes(Span<std::uint8_t> target, Span<std::uint8_t const> source) noexcept
+    {
+        GetKernels().xorBytes(target.data(), source.data(), std::min(target.size(), source.size()));
+    }
+
+    std::uint32_t Crc32(Span<std::uint8_t const> data, std::uint32_t crc) noexcept
+    {
+        return ~CrcSlicing(kCrc32Tables, ~crc, data.data(), data.size());
+    }
+
+    std::uint32_t Crc32C(Span<std::uint8_t const> data, std::uint32_t crc) noexcept
+    {
+        return ~GetKernels().crc32c(~crc, data.data(), data.size());
+    }
+} // namespace core
+} // namespace ara
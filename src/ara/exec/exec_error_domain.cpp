@@ -0,0 +1,51 @@
+/**
+ * \file exec_error_domain.cpp
+ * \author Vincent WANG (vin@misday.com)
+ * \brief
+ * \version 0.1
+ * \date 2021-11-12
+ *
+ * \copyright Copyright (c) 2021
+ *
+ */
+#include "ara/exec/exec_error_domain.h"
+
+namespace ara
+{
+namespace exec
+{
+    ExecException::ExecException(ara::core::ErrorCode errorCode) noexcept : ara::core::Exception(errorCode)
+    {
+    }
+
+    ExecErrorDomain::ExecErrorDomain() noexcept : ara::core::ErrorDomain(internal::ExecErrorMessages<>::kTable)
+    {
+    }
+
+    char const* ExecErrorDomain::Name() const noexcept
+    {
+        return internal::ExecErrorMessages<>::kTable.name;
+    }
+
+    char const* ExecErrorDomain::Message(CodeType errorCode) const noexcept
+    {
+        return internal::ExecErrorMessages<>::kTable.Message(errorCode);
+    }
+
+    void ExecErrorDomain::ThrowAsException(ara::core::ErrorCode const &errorCode) const noexcept(false)
+    {
+        ara::core::internal::ThrowOrAbort<ExecException>(errorCode);
+    }
+
+    ara::core::ErrorDomain const& GetExecErrorDomain() noexcept
+    {
+        static ExecErrorDomain const domain;
+        return domain;
+    }
+
+    ara::core::ErrorCode MakeErrorCode(ara::exec::ExecErrc code, ara::core::ErrorDomain::SupportDataType data) noexcept
+    {
+        return ara::core::ErrorCode(static_cast<ara::core::ErrorDomain::CodeType>(code), GetExecErrorDomain(), data);
+    }
+} // namespace exec
+} // namespace ara
@@ -0,0 +1,49 @@
+/**
+ * \file console_sink.cpp
+ * \author Vincent WANG (you@domain.com)
+ * \brief
+ * \version 0.1
+ * \date 2020-12-08
+ *
+ * \copyright Copyright (c) 2020
+ *
+ */
+#include "console_sink.h"
+
+#include <cstring>
+#include "log_formatter.h"
+
+namespace ara
+{
+    namespace log
+    {
+        namespace internal
+        {
+            ConsoleSink::ConsoleSink(char const *appId, std::FILE *stream) noexcept
+                : stream_(stream), size_(0U)
+            {
+                std::memcpy(appId_, appId, sizeof(appId_));
+            }
+
+            void ConsoleSink::Write(RecordHeader const &header, std::uint8_t const *payload) noexcept
+            {
+                if ((kBatchSize - size_) < kMaxLineSize)
+                {
+                    Flush();
+                }
+                size_ += FormatRecord(appId_, header, payload, batch_ + size_, kMaxLineSize);
+            }
+
+            void ConsoleSink::Flush() noexcept
+            {
+                if (size_ != 0U)
+                {
+                    (void)std::fwrite(batch_, 1U, size_, stream_);
+                    (void)std::fflush(stream_);
+                    size_ = 0U;
+                }
+            }
+        } // namespace internal
+    } // namespace log
+
+} // namespace ara
@@ -0,0 +1,60 @@
+/**
+ * \file console_sink.h
+ * \author Vincent WANG (you@domain.com)
+ * \brief Sink for LogMode::kConsole.
+ * \version 0.1
+ * \date 2020-12-08
+ *
+ * \copyright Copyright (c) 2020
+ *
+ */
+#ifndef ARA_LOG_CONSOLE_SINK_H_
+#define ARA_LOG_CONSOLE_SINK_H_
+
+#include <cstddef>
+#include <cstdio>
+#include "log_sink.h"
+
+namespace ara
+{
+    namespace log
+    {
+        namespace internal
+        {
+            /**
+             * \brief Renders records as text and writes them to a stdio stream.
+             *
+             * Lines are collected in a batch buffer and handed to the stream once per drained batch, so a
+             * burst of records costs one write instead of one per line.
+             */
+            class ConsoleSink final : public LogSink
+            {
+            public:
+                /**
+                 * \brief Construct a new ConsoleSink.
+                 *
+                 * \param[in] appId     the 4 character application ID, padded with '\0'
+                 * \param[in] stream    the destination stream
+                 */
+                ConsoleSink(char const *appId, std::FILE *stream) noexcept;
+
+                void Write(RecordHeader const &header, std::uint8_t const *payload) noexcept override;
+
+                void Flush() noexcept override;
+
+            private:
+                static constexpr std::size_t kBatchSize = 16384U;
+                static constexpr std::size_t kMaxLineSize = 1024U;
+
+                char appId_[4];
+                std::FILE *stream_;
+                std::size_t size_;
+                char batch_[kBatchSize];
+            };
+        } // namespace internal
+    } // namespace log
+
+} // namespace ara
+
+
+#endif // ARA_LOG_CONSOLE_SINK_H_
@@ -0,0 +1,269 @@
+/**
+ * \file dlt_encoder.cpp
+ * \author Vincent WANG (you@domain.com)
+ * \brief
+ * \version 0.1
+ * \date 2020-12-08
+ *
+ * \copyright Copyright (c) 2020
+ *
+ */
+#include "dlt_encoder.h"
+
+#include <cstring>
+#include "ara/core/error_domain.h"
+#include "log_formatter.h"
+
+namespace ara
+{
+    namespace log
+    {
+        namespace internal
+        {
+            namespace
+            {
+                void StoreBigEndian16(std::uint8_t *dst, std::uint16_t value) noexcept
+                {
+                    dst[0] = static_cast<std::uint8_t>(value >> 8U);
+                    dst[1] = static_cast<std::uint8_t>(value);
+                }
+
+                void StoreBigEndian32(std::uint8_t *dst, std::uint32_t value) noexcept
+                {
+                    dst[0] = static_cast<std::uint8_t>(value >> 24U);
+                    dst[1] = static_cast<std::uint8_t>(value >> 16U);
+                    dst[2] = static_cast<std::uint8_t>(value >> 8U);
+                    dst[3] = static_cast<std::uint8_t>(value);
+                }
+
+                /**
+                 * \brief Bounded writer for the verbose mode payload, type info and data in host byte order as
+                 * announced by the MSBF flag.
+                 */
+                class ArgumentWriter
+                {
+                public:
+                    ArgumentWriter(std::uint8_t *out, std::size_t capacity) noexcept
+                        : out_(out), capacity_(capacity), size_(0U), count_(0U)
+                    {
+                    }
+
+                    bool PutFixed(std::uint32_t typeInfo, void const *value, std::size_t size) noexcept
+                    {
+                        if ((capacity_ - size_) < (sizeof(typeInfo) + size))
+                        {
+                            return false;
+                        }
+                        std::memcpy(out_ + size_, &typeInfo, sizeof(typeInfo));
+                        std::memcpy(out_ + size_ + sizeof(typeInfo), value, size);
+                        size_ += sizeof(typeInfo) + size;
+                        ++count_;
+                        return true;
+                    }
+
+                    bool PutVariable(std::uint32_t typeInfo, void const *data, std::uint16_t length, bool terminate) noexcept
+                    {
+                        std::uint16_t const total = static_cast<std::uint16_t>(length + (terminate ? 1U : 0U));
+                        if ((capacity_ - size_) < (sizeof(typeInfo) + sizeof(total) + total))
+                        {
+                            return false;
+                        }
+                        std::uint8_t *dst = out_ + size_;
+                        std::memcpy(dst, &typeInfo, sizeof(typeInfo));
+                        std::memcpy(dst + sizeof(typeInfo), &total, sizeof(total));
+                        std::memcpy(dst + sizeof(typeInfo) + sizeof(total), data, length);
+                        if (terminate)
+                        {
+                            dst[sizeof(typeInfo) + sizeof(total) + length] = 0U;
+                        }
+                        size_ += sizeof(typeInfo) + sizeof(total) + total;
+                        ++count_;
+                        return true;
+                    }
+
+                    bool PutString(char const *text, std::size_t maxLength) noexcept
+                    {
+                        std::size_t const length = std::strlen(text);
+                        return PutVariable(dlt::kTypeString | dlt::kCodingUtf8, text,
+                                           static_cast<std::uint16_t>((length < maxLength) ? length : maxLength), true);
+                    }
+
+                    std::size_t Size() const noexcept
+                    {
+                        return size_;
+                    }
+
+                    std::uint8_t Count() const noexcept
+                    {
+                        return count_;
+                    }
+
+                private:
+                    std::uint8_t *out_;
+                    std::size_t capacity_;
+                    std::size_t size_;
+                    std::uint8_t count_;
+                };
+
+                std::uint32_t LengthBits(std::size_t size) noexcept
+                {
+                    return (size == 1U) ? dlt::kTypeLength8
+                         : (size == 2U) ? dlt::kTypeLength16
+                         : (size == 4U) ? dlt::kTypeLength32
+                         : dlt::kTypeLength64;
+                }
+
+                std::uint32_t TypeInfo(ArgType type) noexcept
+                {
+                    switch (type)
+                    {
+                    case ArgType::kBool:
+                        return dlt::kTypeBool;
+                    case ArgType::kUint8:
+                    case ArgType::kUint16:
+                    case ArgType::kUint32:
+                    case ArgType::kUint64:
+                        return dlt::kTypeUnsigned;
+                    case ArgType::kInt8:
+                    case ArgType::kInt16:
+                    case ArgType::kInt32:
+                    case ArgType::kInt64:
+                        return dlt::kTypeSigned;
+                    case ArgType::kFloat32:
+                    case ArgType::kFloat64:
+                        return dlt::kTypeFloat;
+                    case ArgType::kHex8:
+                    case ArgType::kHex16:
+                    case ArgType::kHex32:
+                    case ArgType::kHex64:
+                        return dlt::kTypeUnsigned | dlt::kCodingHex;
+                    case ArgType::kBin8:
+                    case ArgType::kBin16:
+                    case ArgType::kBin32:
+                    case ArgType::kBin64:
+                        return dlt::kTypeUnsigned | dlt::kCodingBin;
+                    default:
+                        return 0U;
+                    }
+                }
+
+                /**
+                 * \brief Encode one record argument, return the number of consumed payload bytes, or 0 if the
+                 * payload is malformed or the argument does not fit.
+                 */
+                std::size_t EncodeArgument(ArgumentWriter &writer, std::uint8_t const *arg, std::size_t available) noexcept
+                {
+                    ArgType const type = static_cast<ArgType>(arg[0]);
+                    std::uint8_t const *value = arg + 1;
+                    std::size_t const room = available - 1U;
+                    std::size_t const fixed = FixedArgSize(type);
+
+                    if (fixed != 0U)
+                    {
+                        if (room < fixed)
+                        {
+                            return 0U;
+                        }
+
+                        if (type == ArgType::kSchema)
+                        {
+                            // field names are not part of the DLT message, only the values are sent
+                            return 1U + fixed;
+                        }
+
+                        bool written;
+                        if (type == ArgType::kLogLevel)
+                        {
+                            written = writer.PutString(LogLevelName(static_cast<LogLevel>(value[0])), dlt::kMaxLevelNameSize);
+                        }
+                        else if (type == ArgType::kErrorCode)
+                        {
+                            ErrorCodeArg code;
+                            std::memcpy(&code, value, sizeof(code));
+                            auto const *domain = reinterpret_cast<ara::core::ErrorDomain const *>(static_cast<std::uintptr_t>(code.domain));
+                            ara::core::internal::ErrorMessageTable const *const messages = domain->MessageTable();
+                            written = writer.PutString((messages != nullptr) ? messages->name : domain->Name(), dlt::kMaxDomainNameSize)
+                                   && writer.PutFixed(dlt::kTypeSigned | dlt::kTypeLength32, &code.value, sizeof(code.value));
+                        }
+                        else
+                        {
+                            written = writer.PutFixed(TypeInfo(type) | LengthBits(fixed), value, fixed);
+                        }
+                        return written ? (1U + fixed) : 0U;
+                    }
+
+                    if (((type != ArgType::kString) && (type != ArgType::kRawBuffer)) || (room < sizeof(std::uint16_t)))
+                    {
+                        return 0U;
+                    }
+
+                    std::uint16_t length;
+                    std::memcpy(&length, value, sizeof(length));
+                    if ((room - sizeof(length)) < length)
+                    {
+                        return 0U;
+                    }
+
+                    bool const written = (type == ArgType::kString)
+                        ? writer.PutVariable(dlt::kTypeString | dlt::kCodingUtf8, value + sizeof(length), length, true)
+                        : writer.PutVariable(dlt::kTypeRaw, value + sizeof(length), length, false);
+                    return written ? (1U + sizeof(length) + length) : 0U;
+                }
+            } // namespace
+
+            DltEncoder::DltEncoder(char const *ecuId, char const *appId, std::uint32_t sessionId) noexcept
+                : sessionId_(sessionId), counter_(0U), truncated_(0U)
+            {
+                std::memcpy(ecuId_, ecuId, sizeof(ecuId_));
+                std::memcpy(appId_, appId, sizeof(appId_));
+            }
+
+            std::size_t DltEncoder::Encode(RecordHeader const &header, std::uint8_t const *payload, std::uint8_t *out, std::size_t capacity) noexcept
+            {
+                if (capacity < dlt::kHeaderSize)
+                {
+                    return 0U;
+                }
+
+                std::size_t const limit = (capacity < UINT16_MAX) ? capacity : UINT16_MAX;
+                ArgumentWriter writer(out + dlt::kHeaderSize, limit - dlt::kHeaderSize);
+                std::size_t offset = 0U;
+                while (offset < header.payloadSize)
+                {
+                    std::size_t const consumed = EncodeArgument(writer, payload + offset, header.payloadSize - offset);
+                    if (consumed == 0U)
+                    {
+                        break;
+                    }
+                    offset += consumed;
+                }
+                if (offset < header.payloadSize)
+                {
+                    ++truncated_;
+                }
+
+                std::size_t const size = dlt::kHeaderSize + writer.Size();
+                // timestamp in 0.1 ms
+                std::uint32_t const timestamp = static_cast<std::uint32_t>(header.timestamp / 100000U);
+
+                // standard header
+                out[0] = dlt::kHtypUseExtendedHeader | dlt::kHtypHostByteOrder | dlt::kHtypWithEcuId | dlt::kHtypWithSessionId
+                       | dlt::kHtypWithTimestamp | dlt::kHtypVersion1;
+                out[1] = counter_++;
+                StoreBigEndian16(out + 2, static_cast<std::uint16_t>(size));
+                std::memcpy(out + 4, ecuId_, sizeof(ecuId_));
+                StoreBigEndian32(out + 8, sessionId_);
+                StoreBigEndian32(out + 12, timestamp);
+
+                // extended header
+                out[16] = static_cast<std::uint8_t>(dlt::kMsinVerbose | (dlt::kMsinTypeLog << 1U)
+                                                    | (static_cast<std::uint8_t>(header.level) << 4U));
+                out[17] = writer.Count();
+                std::memcpy(out + 18, appId_, sizeof(appId_));
+                std::memcpy(out + 22, header.ctxId, sizeof(header.ctxId));
+                return size;
+            }
+        } // namespace internal
+    } // namespace log
+
+} // namespace ara
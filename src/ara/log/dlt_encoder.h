@@ -0,0 +1,182 @@
+/**
+ * \file dlt_encoder.h
+ * \author Vincent WANG (you@domain.com)
+ * \brief Encoder from binary log records to DLT verbose mode messages.
+ * \version 0.1
+ * \date 2020-12-08
+ *
+ * \copyright Copyright (c) 2020
+ *
+ */
+#ifndef ARA_LOG_DLT_ENCODER_H_
+#define ARA_LOG_DLT_ENCODER_H_
+
+#include <cstddef>
+#include <cstdint>
+#include "ara/log/log_record.h"
+
+namespace ara
+{
+    namespace log
+    {
+        namespace internal
+        {
+            namespace dlt
+            {
+                // PRS_Dlt standard header type (HTYP) flags
+                constexpr std::uint8_t kHtypUseExtendedHeader = 0x01U;
+                constexpr std::uint8_t kHtypMostSignificantByteFirst = 0x02U;
+                constexpr std::uint8_t kHtypWithEcuId = 0x04U;
+                constexpr std::uint8_t kHtypWithSessionId = 0x08U;
+                constexpr std::uint8_t kHtypWithTimestamp = 0x10U;
+                constexpr std::uint8_t kHtypVersion1 = 0x20U;
+
+                /**
+                 * \brief MSBF flag for the payload, which is written in host byte order.
+                 */
+#if defined(__BYTE_ORDER__) && (__BYTE_ORDER__ == __ORDER_BIG_ENDIAN__)
+                constexpr std::uint8_t kHtypHostByteOrder = kHtypMostSignificantByteFirst;
+#else
+                constexpr std::uint8_t kHtypHostByteOrder = 0x00U;
+#endif
+
+                // PRS_Dlt extended header message info (MSIN)
+                constexpr std::uint8_t kMsinVerbose = 0x01U;
+                constexpr std::uint8_t kMsinTypeLog = 0x00U;
+
+                // PRS_Dlt verbose mode type info
+                constexpr std::uint32_t kTypeLength8 = 0x00000001U;
+                constexpr std::uint32_t kTypeLength16 = 0x00000002U;
+                constexpr std::uint32_t kTypeLength32 = 0x00000003U;
+                constexpr std::uint32_t kTypeLength64 = 0x00000004U;
+                constexpr std::uint32_t kTypeBool = 0x00000010U;
+                constexpr std::uint32_t kTypeSigned = 0x00000020U;
+                constexpr std::uint32_t kTypeUnsigned = 0x00000040U;
+                constexpr std::uint32_t kTypeFloat = 0x00000080U;
+                constexpr std::uint32_t kTypeString = 0x00000200U;
+                constexpr std::uint32_t kTypeRaw = 0x00000400U;
+                constexpr std::uint32_t kCodingUtf8 = 0x00008000U;
+                constexpr std::uint32_t kCodingHex = 0x00010000U;
+                constexpr std::uint32_t kCodingBin = 0x00018000U;
+
+                /**
+                 * \brief Size of standard header with ECU ID, session ID and timestamp plus extended header.
+                 */
+                constexpr std::size_t kHeaderSize = 4U + 4U + 4U + 4U + 10U;
+
+                /**
+                 * \brief Longest LogLevel name sent for a LogLevel argument ("verbose", "unknown").
+                 */
+                constexpr std::size_t kMaxLevelNameSize = 7U;
+
+                /**
+                 * \brief Longest ErrorDomain name sent for an ErrorCode argument, longer names are cut.
+                 */
+                constexpr std::size_t kMaxDomainNameSize = 32U;
+
+                /**
+                 * \brief Record payload bytes of one argument and the size of its verbose mode encoding.
+                 */
+                struct ArgGrowth
+                {
+                    std::size_t recorded;
+                    std::size_t encoded;
+                };
+
+                /**
+                 * \brief The growth of every argument type in its worst case. Strings and raw buffers grow by a
+                 * constant, so the empty ones grow most.
+                 */
+                constexpr ArgGrowth kArgGrowth[] = {
+                    {1U + 1U, 4U + 1U},                                             // bool and 8 bit
+                    {1U + 2U, 4U + 2U},                                             // 16 bit
+                    {1U + 4U, 4U + 4U},                                             // 32 bit
+                    {1U + 8U, 4U + 8U},                                             // 64 bit
+                    {1U + 1U, 4U + 2U + kMaxLevelNameSize + 1U},                    // LogLevel, as string
+                    {1U + sizeof(ErrorCodeArg), 4U + 2U + kMaxDomainNameSize + 1U + 4U + 4U}, // domain, value
+                    {1U + 2U, 4U + 2U + 1U},                                        // empty string
+                    {1U + 2U, 4U + 2U},                                             // empty raw buffer
+                };
+
+                /**
+                 * \brief Upper bound of the encoded arguments of a payload: payloadSize times the largest growth
+                 * of an argument type, rounded up.
+                 *
+                 * \param[in] payloadSize   the record payload size
+                 * \return std::size_t      the maximum size of the encoded arguments
+                 */
+                constexpr std::size_t MaxEncodedPayloadSize(std::size_t payloadSize) noexcept
+                {
+                    std::size_t result = 0U;
+                    for (ArgGrowth const &growth : kArgGrowth)
+                    {
+                        std::size_t const size = ((payloadSize * growth.encoded) + growth.recorded - 1U) / growth.recorded;
+                        result = (size > result) ? size : result;
+                    }
+                    return result;
+                }
+
+                /**
+                 * \brief Upper bound of an encoded record, used to pre-size message buffers. Every record fits.
+                 */
+                constexpr std::size_t kMaxMessageSize = kHeaderSize + MaxEncodedPayloadSize(kMaxPayloadSize);
+
+                static_assert(kMaxMessageSize <= UINT16_MAX, "the DLT length field is 16 bits");
+            } // namespace dlt
+
+            /**
+             * \brief Turns records into DLT (Diagnostic Log and Trace) verbose mode log messages.
+             *
+             * The encoder writes header, type info and argument data directly into a caller provided buffer;
+             * there are no intermediate copies and no allocations.
+             */
+            class DltEncoder final
+            {
+            public:
+                /**
+                 * \brief Construct a new DltEncoder.
+                 *
+                 * \param[in] ecuId     the 4 character ECU ID, padded with '\0'
+                 * \param[in] appId     the 4 character application ID, padded with '\0'
+                 * \param[in] sessionId the session ID, usually the process ID
+                 */
+                DltEncoder(char const *ecuId, char const *appId, std::uint32_t sessionId) noexcept;
+
+                /**
+                 * \brief Encode one record.
+                 *
+                 * Arguments that do not fit into the buffer anymore are left out and the message is counted by
+                 * Truncated(). A buffer of dlt::kMaxMessageSize bytes fits every record.
+                 *
+                 * \param[in] header    the record header
+                 * \param[in] payload   the encoded record arguments
+                 * \param[out] out      the message buffer
+                 * \param[in] capacity  the size of the message buffer
+                 * \return std::size_t  the size of the DLT message, 0 if not even the headers fit
+                 */
+                std::size_t Encode(RecordHeader const &header, std::uint8_t const *payload, std::uint8_t *out, std::size_t capacity) noexcept;
+
+                /**
+                 * \brief Return the number of messages encoded without some of their arguments.
+                 *
+                 * \return std::uint64_t    the number of truncated messages
+                 */
+                std::uint64_t Truncated() const noexcept
+                {
+                    return truncated_;
+                }
+
+            private:
+                char ecuId_[4];
+                char appId_[4];
+                std::uint32_t sessionId_;
+                std::uint8_t counter_;
+                std::uint64_t truncated_;
+            };
+        } // namespace internal
+    } // namespace log
+
+} // namespace ara
+
+
+#endif // ARA_LOG_DLT_ENCODER_H_
@@ -0,0 +1,232 @@
+/**
+ * \file dlt_remote_sink.cpp
+ * \author Vincent WANG (you@domain.com)
+ * \brief
+ * \version 0.1
+ * \date 2020-12-08
+ *
+ * \copyright Copyright (c) 2020
+ *
+ */
+#include "dlt_remote_sink.h"
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/time.h>
+#include <unistd.h>
+#include <cerrno>
+#include <cstring>
+
+namespace ara
+{
+    namespace log
+    {
+        namespace internal
+        {
+            namespace
+            {
+                std::atomic<ClientState> remoteState{ClientState::kNotConnected};
+            } // namespace
+
+            constexpr std::chrono::seconds DltRemoteSink::kReconnectPeriod;
+
+            ClientState RemoteClientState() noexcept
+            {
+                return remoteState.load(std::memory_order_relaxed);
+            }
+
+            DltRemoteSink::DltRemoteSink(char const *ecuId, char const *appId, RemoteTransport transport, std::string host, std::uint16_t port)
+                : encoder_(ecuId, appId, static_cast<std::uint32_t>(::getpid())),
+                  transport_(transport),
+                  host_(std::move(host)),
+                  port_(port),
+                  socket_(-1),
+                  nextConnect_(),
+                  count_(0U),
+                  buffers_(new std::uint8_t[kBatchSize * dlt::kMaxMessageSize]),
+                  sent_(0U),
+                  syscalls_(0U),
+                  dropped_(0U),
+                  truncated_(0U)
+            {
+                std::memset(messages_, 0, sizeof(messages_));
+                std::memset(iov_, 0, sizeof(iov_));
+                for (std::size_t i = 0U; i < kBatchSize; ++i)
+                {
+                    messages_[i].msg_hdr.msg_iov = &iov_[i];
+                    messages_[i].msg_hdr.msg_iovlen = 1U;
+                }
+            }
+
+            DltRemoteSink::~DltRemoteSink()
+            {
+                Flush();
+                Disconnect();
+            }
+
+            void DltRemoteSink::Write(RecordHeader const &header, std::uint8_t const *payload) noexcept
+            {
+                // SendStream() moves the base of partially written messages, so it is reset for every message
+                std::uint8_t *buffer = buffers_.get() + (count_ * dlt::kMaxMessageSize);
+                std::size_t const size = encoder_.Encode(header, payload, buffer, dlt::kMaxMessageSize);
+                truncated_.store(encoder_.Truncated(), std::memory_order_relaxed);
+                if (size == 0U)
+                {
+                    return;
+                }
+
+                iov_[count_].iov_base = buffer;
+                iov_[count_].iov_len = size;
+                if (++count_ == kBatchSize)
+                {
+                    Flush();
+                }
+            }
+
+            void DltRemoteSink::Flush() noexcept
+            {
+                if (count_ == 0U)
+                {
+                    return;
+                }
+
+                bool const sent = Connect()
+                    && ((transport_ == RemoteTransport::kUdp) ? SendDatagrams() : SendStream());
+                if (sent)
+                {
+                    sent_.fetch_add(count_, std::memory_order_relaxed);
+                }
+                else
+                {
+                    dropped_.fetch_add(count_, std::memory_order_relaxed);
+                }
+                count_ = 0U;
+            }
+
+            RemoteSinkStatistics DltRemoteSink::Statistics() const noexcept
+            {
+                return RemoteSinkStatistics{sent_.load(std::memory_order_relaxed),
+                                            syscalls_.load(std::memory_order_relaxed),
+                                            dropped_.load(std::memory_order_relaxed),
+                                            truncated_.load(std::memory_order_relaxed)};
+            }
+
+            bool DltRemoteSink::Connect() noexcept
+            {
+                if (socket_ >= 0)
+                {
+                    return true;
+                }
+
+                auto const now = std::chrono::steady_clock::now();
+                if (now < nextConnect_)
+                {
+                    return false;
+                }
+                nextConnect_ = now + kReconnectPeriod;
+
+                struct sockaddr_in address;
+                std::memset(&address, 0, sizeof(address));
+                address.sin_family = AF_INET;
+                address.sin_port = htons(port_);
+                if (::inet_pton(AF_INET, host_.c_str(), &address.sin_addr) != 1)
+                {
+                    return false;
+                }
+
+                bool const tcp = (transport_ == RemoteTransport::kTcp);
+                int const fd = ::socket(AF_INET, (tcp ? SOCK_STREAM : SOCK_DGRAM) | SOCK_CLOEXEC, 0);
+                if (fd < 0)
+                {
+                    return false;
+                }
+
+                if (tcp)
+                {
+                    // never let a stalled receiver block the logging thread for long
+                    struct timeval timeout{0, 100000};
+                    int const noDelay = 1;
+                    (void)::setsockopt(fd, SOL_SOCKET, SO_SNDTIMEO, &timeout, sizeof(timeout));
+                    (void)::setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &noDelay, sizeof(noDelay));
+                }
+
+                if (::connect(fd, reinterpret_cast<struct sockaddr *>(&address), sizeof(address)) != 0)
+                {
+                    (void)::close(fd);
+                    return false;
+                }
+
+                socket_ = fd;
+                remoteState.store(tcp ? ClientState::kConnected : ClientState::kUnknown, std::memory_order_relaxed);
+                return true;
+            }
+
+            void DltRemoteSink::Disconnect() noexcept
+            {
+                if (socket_ >= 0)
+                {
+                    (void)::close(socket_);
+                    socket_ = -1;
+                    remoteState.store(ClientState::kNotConnected, std::memory_order_relaxed);
+                }
+            }
+
+            bool DltRemoteSink::SendDatagrams() noexcept
+            {
+                std::size_t done = 0U;
+                while (done < count_)
+                {
+                    syscalls_.fetch_add(1U, std::memory_order_relaxed);
+                    int const n = ::sendmmsg(socket_, messages_ + done, static_cast<unsigned int>(count_ - done), MSG_NOSIGNAL);
+                    if (n < 0)
+                    {
+                        if (errno == EINTR)
+                        {
+                            continue;
+                        }
+                        // a datagram socket stays usable, e.g. after ECONNREFUSED from a missing receiver
+                        return false;
+                    }
+                    done += static_cast<std::size_t>(n);
+                }
+                return true;
+            }
+
+            bool DltRemoteSink::SendStream() noexcept
+            {
+                struct iovec *iov = iov_;
+                std::size_t remaining = count_;
+                while (remaining != 0U)
+                {
+                    syscalls_.fetch_add(1U, std::memory_order_relaxed);
+                    ssize_t n = ::writev(socket_, iov, static_cast<int>(remaining));
+                    if (n < 0)
+                    {
+                        if (errno == EINTR)
+                        {
+                            continue;
+                        }
+                        Disconnect();
+                        return false;
+                    }
+
+                    // skip what was written, a partially written message is continued in the next call
+                    while ((remaining != 0U) && (static_cast<std::size_t>(n) >= iov->iov_len))
+                    {
+                        n -= static_cast<ssize_t>(iov->iov_len);
+                        ++iov;
+                        --remaining;
+                    }
+                    if (remaining != 0U)
+                    {
+                        iov->iov_base = static_cast<std::uint8_t *>(iov->iov_base) + n;
+                        iov->iov_len -= static_cast<std::size_t>(n);
+                    }
+                }
+                return true;
+            }
+        } // namespace internal
+    } // namespace log
+
+} // namespace ara
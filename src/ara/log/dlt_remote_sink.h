@@ -0,0 +1,134 @@
+/**
+ * \file dlt_remote_sink.h
+ * \author Vincent WANG (you@domain.com)
+ * \brief Sink for LogMode::kRemote, sends DLT messages to a remote receiver.
+ * \version 0.1
+ * \date 2020-12-08
+ *
+ * \copyright Copyright (c) 2020
+ *
+ */
+#ifndef ARA_LOG_DLT_REMOTE_SINK_H_
+#define ARA_LOG_DLT_REMOTE_SINK_H_
+
+#include <sys/socket.h>
+#include <sys/uio.h>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include "ara/log/common.h"
+#include "dlt_encoder.h"
+#include "log_sink.h"
+
+namespace ara
+{
+    namespace log
+    {
+        namespace internal
+        {
+            /**
+             * \brief Transport used by the DltRemoteSink.
+             *
+             */
+            enum class RemoteTransport : uint8_t
+            {
+                kUdp,   /*< one datagram per DLT message, batched with sendmmsg() */
+                kTcp,   /*< DLT message stream, batched with writev() */
+            };
+
+            /**
+             * \brief Counters of a DltRemoteSink, readable from any thread.
+             *
+             */
+            struct RemoteSinkStatistics
+            {
+                std::uint64_t messages;     /*< DLT messages handed to the kernel */
+                std::uint64_t syscalls;     /*< sendmmsg()/writev() calls */
+                std::uint64_t dropped;      /*< messages lost because of missing connection or send errors */
+                std::uint64_t truncated;    /*< messages sent without some of their arguments */
+            };
+
+            /**
+             * \brief Encodes records to DLT and sends them to a remote receiver in batches.
+             *
+             * Every record is encoded straight into one of kBatchSize pre-allocated message buffers. When all
+             * buffers are used, or the logging thread has drained a batch, the whole batch goes out with a
+             * single sendmmsg() (UDP) or writev() (TCP) call.
+             *
+             * Only numeric IPv4 addresses are supported, so the logging thread never waits for name
+             * resolution.
+             */
+            class DltRemoteSink final : public LogSink
+            {
+            public:
+                /**
+                 * \brief Construct a new DltRemoteSink, the connection is established lazily.
+                 *
+                 * \param[in] ecuId     the 4 character ECU ID, padded with '\0'
+                 * \param[in] appId     the 4 character application ID, padded with '\0'
+                 * \param[in] transport the transport protocol
+                 * \param[in] host      numeric IPv4 address of the receiver
+                 * \param[in] port      port of the receiver
+                 */
+                DltRemoteSink(char const *ecuId, char const *appId, RemoteTransport transport, std::string host, std::uint16_t port);
+
+                ~DltRemoteSink() override;
+
+                DltRemoteSink(DltRemoteSink const &) = delete;
+                DltRemoteSink& operator=(DltRemoteSink const &) = delete;
+
+                void Write(RecordHeader const &header, std::uint8_t const *payload) noexcept override;
+
+                void Flush() noexcept override;
+
+                /**
+                 * \brief Return a snapshot of the counters.
+                 *
+                 * \return RemoteSinkStatistics  the counters
+                 */
+                RemoteSinkStatistics Statistics() const noexcept;
+
+            private:
+                static constexpr std::size_t kBatchSize = 64U;
+                static constexpr std::chrono::seconds kReconnectPeriod{1};
+
+                bool Connect() noexcept;
+                void Disconnect() noexcept;
+                bool SendDatagrams() noexcept;
+                bool SendStream() noexcept;
+
+                DltEncoder encoder_;
+                RemoteTransport const transport_;
+                std::string const host_;
+                std::uint16_t const port_;
+                int socket_;
+                std::chrono::steady_clock::time_point nextConnect_;
+
+                std::size_t count_;
+                std::unique_ptr<std::uint8_t[]> const buffers_;
+                struct iovec iov_[kBatchSize];
+                struct mmsghdr messages_[kBatchSize];
+
+                std::atomic<std::uint64_t> sent_;
+                std::atomic<std::uint64_t> syscalls_;
+                std::atomic<std::uint64_t> dropped_;
+                std::atomic<std::uint64_t> truncated_;
+            };
+
+            /**
+             * \brief Return the connection state of the remote receiver, as reported by remoteClientState().
+             *
+             * \return ClientState  kConnected while a TCP connection is up, kUnknown for UDP (there is no
+             *                      feedback from the receiver) and kNotConnected otherwise
+             */
+            ClientState RemoteClientState() noexcept;
+        } // namespace internal
+    } // namespace log
+
+} // namespace ara
+
+
+#endif // ARA_LOG_DLT_REMOTE_SINK_H_
@@ -0,0 +1,284 @@
+/**
+ * \file file_sink.cpp
+ * \author Vincent WANG (you@domain.com)
+ * \brief
+ * \version 0.1
+ * \date 2020-12-08
+ *
+ * \copyright Copyright (c) 2020
+ *
+ */
+#include "file_sink.h"
+
+#include <dirent.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#include <algorithm>
+#include <cinttypes>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+#include "ara/core/abort.h"
+
+namespace ara
+{
+    namespace log
+    {
+        namespace internal
+        {
+            namespace
+            {
+                constexpr char kSuffix[] = ".alog";
+
+                std::size_t PageSize() noexcept
+                {
+                    static std::size_t const size = static_cast<std::size_t>(::sysconf(_SC_PAGESIZE));
+                    return size;
+                }
+
+                void SyncRange(std::uint8_t *base, std::size_t from, std::size_t to, int flags) noexcept
+                {
+                    std::size_t const start = from & ~(PageSize() - 1U);
+                    if (to > start)
+                    {
+                        (void)::msync(base + start, to - start, flags);
+                    }
+                }
+            } // namespace
+
+            constexpr std::chrono::seconds FileSink::kReopenPeriod;
+
+            FileSink::FileSink(std::string directory, char const *appId, std::size_t segmentSize, std::size_t retention,
+                               FileSyncPolicy policy, std::chrono::milliseconds syncPeriod)
+                : directory_(std::move(directory)),
+                  prefix_(appId, ::strnlen(appId, 4U)),
+                  segmentSize_(segmentSize),
+                  retention_((retention != 0U) ? retention : 1U),
+                  policy_(policy),
+                  syncPeriod_(syncPeriod),
+                  sequence_(0U),
+                  segment_(nullptr),
+                  used_(0U),
+                  synced_(0U),
+                  nextSync_(std::chrono::steady_clock::now() + syncPeriod),
+                  nextOpen_()
+            {
+                if (prefix_.empty())
+                {
+                    prefix_ = "ara";
+                }
+                leftovers_ = FindSegments();
+                sequence_ = leftovers_.empty() ? 0U : *std::max_element(leftovers_.begin(), leftovers_.end());
+                (void)OpenSegment();
+            }
+
+            FileSink::~FileSink()
+            {
+                CloseSegment();
+            }
+
+            void FileSink::Write(RecordHeader const &header, std::uint8_t const *payload) noexcept
+            {
+                std::uint32_t schemaId = 0U;
+                if ((header.payloadSize > sizeof(schemaId)) && (static_cast<ArgType>(payload[0]) == ArgType::kSchema))
+                {
+                    std::memcpy(&schemaId, payload + 1, sizeof(schemaId));
+                }
+
+                // every segment defines the schemas it uses, so it can be decoded on its own
+                std::uint8_t definition[SchemaRegistry::kMaxDefinitionSize];
+                std::size_t definitionSize = 0U;
+                std::size_t const size = sizeof(header) + header.payloadSize;
+                for (bool rotated = false;; rotated = true)
+                {
+                    Schema const *schema = ((schemaId != 0U) && (schemaId < announced_.size()) && !announced_.test(schemaId))
+                        ? SchemaRegistry::Instance().Find(schemaId) : nullptr;
+                    definitionSize = (schema != nullptr) ? SchemaRegistry::EncodeDefinition(*schema, definition, sizeof(definition)) : 0U;
+                    std::size_t const total = size + ((definitionSize != 0U) ? (sizeof(header) + definitionSize) : 0U);
+
+                    if (total > segmentSize_)
+                    {
+                        // would not even fit into an empty segment, keep the current one
+                        return;
+                    }
+                    if ((segment_ != nullptr) && ((segmentSize_ - used_) >= total))
+                    {
+                        break;
+                    }
+                    if (rotated)
+                    {
+                        return;
+                    }
+                    if ((segment_ == nullptr) && (std::chrono::steady_clock::now() < nextOpen_))
+                    {
+                        // the last OpenSegment() failed, records are dropped until the retry period is over
+                        return;
+                    }
+                    CloseSegment();
+                    if (!OpenSegment())
+                    {
+                        nextOpen_ = std::chrono::steady_clock::now() + kReopenPeriod;
+                        return;
+                    }
+                }
+
+                if (definitionSize != 0U)
+                {
+                    RecordHeader definitionHeader = header;
+                    definitionHeader.payloadSize = static_cast<std::uint16_t>(definitionSize);
+                    definitionHeader.argCount = 1U;
+                    Append(definitionHeader, definition);
+                    announced_.set(schemaId);
+                }
+                Append(header, payload);
+            }
+
+            void FileSink::Append(RecordHeader const &header, std::uint8_t const *payload) noexcept
+            {
+                std::memcpy(segment_ + used_, &header, sizeof(header));
+                std::memcpy(segment_ + used_ + sizeof(header), payload, header.payloadSize);
+                used_ += sizeof(header) + header.payloadSize;
+            }
+
+            void FileSink::Flush() noexcept
+            {
+                if (segment_ == nullptr)
+                {
+                    return;
+                }
+
+                if (policy_ == FileSyncPolicy::kEveryBatch)
+                {
+                    SyncRange(segment_, synced_, used_, MS_SYNC);
+                    synced_ = used_;
+                }
+                else if (policy_ == FileSyncPolicy::kPeriodic)
+                {
+                    auto const now = std::chrono::steady_clock::now();
+                    if (now >= nextSync_)
+                    {
+                        SyncRange(segment_, synced_, used_, MS_ASYNC);
+                        synced_ = used_;
+                        nextSync_ = now + syncPeriod_;
+                    }
+                }
+                else
+                {
+                    // kNever and kOnRotate leave the write-back to the kernel until the segment is closed
+                }
+            }
+
+            std::string FileSink::SegmentPath(std::uint64_t sequence) const
+            {
+                char name[32];
+                (void)std::snprintf(name, sizeof(name), ".%06" PRIu64, sequence);
+                return directory_ + "/" + prefix_ + name + kSuffix;
+            }
+
+            std::vector<std::uint64_t> FileSink::FindSegments() const
+            {
+                std::vector<std::uint64_t> sequences;
+                DIR *dir = ::opendir(directory_.c_str());
+                if (dir == nullptr)
+                {
+                    return sequences;
+                }
+
+                std::string const head = prefix_ + ".";
+                std::size_t const suffixLength = sizeof(kSuffix) - 1U;
+                for (struct dirent *entry = ::readdir(dir); entry != nullptr; entry = ::readdir(dir))
+                {
+                    std::size_t const length = std::strlen(entry->d_name);
+                    if ((length > (head.size() + suffixLength))
+                        && (std::strncmp(entry->d_name, head.c_str(), head.size()) == 0)
+                        && (std::strcmp(entry->d_name + length - suffixLength, kSuffix) == 0))
+                    {
+                        sequences.push_back(std::strtoull(entry->d_name + head.size(), nullptr, 10));
+                    }
+                }
+                (void)::closedir(dir);
+                return sequences;
+            }
+
+            bool FileSink::OpenSegment() noexcept
+            {
+                ARA_CORE_TRY
+                {
+                    std::uint64_t const sequence = sequence_ + 1U;
+                    std::string const path = SegmentPath(sequence);
+                    int const fd = ::open(path.c_str(), O_RDWR | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+                    if (fd < 0)
+                    {
+                        return false;
+                    }
+
+                    // allocate all blocks up front, so appending never fails with ENOSPC in form of a SIGBUS
+                    void *mapping = MAP_FAILED;
+                    if (::posix_fallocate(fd, 0, static_cast<off_t>(segmentSize_)) == 0)
+                    {
+                        mapping = ::mmap(nullptr, segmentSize_, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+                    }
+                    (void)::close(fd);
+
+                    if (mapping == MAP_FAILED)
+                    {
+                        (void)::unlink(path.c_str());
+                        return false;
+                    }
+
+                    segment_ = static_cast<std::uint8_t *>(mapping);
+                    sequence_ = sequence;
+                    used_ = 0U;
+                    synced_ = 0U;
+                    announced_.reset();
+
+                    // only give up old data once the new segment is there
+                    if (sequence_ > retention_)
+                    {
+                        (void)::unlink(SegmentPath(sequence_ - retention_).c_str());
+                    }
+                    for (std::uint64_t const leftover : leftovers_)
+                    {
+                        if ((leftover + retention_) <= sequence_)
+                        {
+                            (void)::unlink(SegmentPath(leftover).c_str());
+                        }
+                    }
+                    leftovers_.clear();
+                    return true;
+                }
+                ARA_CORE_CATCH(...)
+                {
+                    return false;
+                }
+            }
+
+            void FileSink::CloseSegment() noexcept
+            {
+                if (segment_ == nullptr)
+                {
+                    return;
+                }
+
+                if (policy_ != FileSyncPolicy::kNever)
+                {
+                    SyncRange(segment_, synced_, used_, MS_SYNC);
+                }
+                (void)::munmap(segment_, segmentSize_);
+                segment_ = nullptr;
+
+                ARA_CORE_TRY
+                {
+                    (void)::truncate(SegmentPath(sequence_).c_str(), static_cast<off_t>(used_));
+                }
+                ARA_CORE_CATCH(...)
+                {
+                    // the zero tail is tolerated by readers
+                }
+            }
+        } // namespace internal
+    } // namespace log
+
+} // namespace ara
@@ -0,0 +1,114 @@
+/**
+ * \file file_sink.h
+ * \author Vincent WANG (you@domain.com)
+ * \brief Sink for LogMode::kFile, appends binary records to memory-mapped rotating segments.
+ * \version 0.1
+ * \date 2020-12-08
+ *
+ * \copyright Copyright (c) 2020
+ *
+ */
+#ifndef ARA_LOG_FILE_SINK_H_
+#define ARA_LOG_FILE_SINK_H_
+
+#include <bitset>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "log_sink.h"
+#include "schema_registry.h"
+
+namespace ara
+{
+    namespace log
+    {
+        namespace internal
+        {
+            /**
+             * \brief When the FileSink forces mapped segment pages to storage with msync().
+             *
+             * Records are in the page cache as soon as they are copied into the mapping, so a crash of the
+             * process never loses them. The policy only matters for power loss or a kernel crash.
+             */
+            enum class FileSyncPolicy : uint8_t
+            {
+                kNever,         /*< leave write-back to the kernel */
+                kOnRotate,      /*< synchronous msync() of a segment when it is closed */
+                kPeriodic,      /*< asynchronous msync() at most once per sync period, plus kOnRotate */
+                kEveryBatch,    /*< synchronous msync() after every drained batch */
+            };
+
+            /**
+             * \brief Writes records in the binary log format into fixed-size, pre-allocated segment files.
+             *
+             * Segments are named "<directory>/<appId>.<sequence>.alog". Each segment is allocated at its full
+             * size and mapped; appending a record is a plain memcpy(). When a record does not fit anymore, the
+             * segment is truncated to its used size and the next one is opened. Only the newest "retention"
+             * segments are kept, including those left by earlier runs. The oldest segment is only removed once
+             * the next one was opened; after a failed open records are dropped for kReopenPeriod before the next
+             * attempt. A record larger than a segment is dropped.
+             *
+             * The unused tail of the current segment is zero, a RecordHeader of all zeros marks the end of
+             * the data for readers of a segment that was not closed properly.
+             */
+            class FileSink final : public LogSink
+            {
+            public:
+                /**
+                 * \brief Construct a new FileSink and open the first segment.
+                 *
+                 * Numbering continues after the highest segment already present in the directory.
+                 *
+                 * \param[in] directory     the directory the segments are created in
+                 * \param[in] appId         the 4 character application ID, padded with '\0'
+                 * \param[in] segmentSize   the size of one segment in bytes
+                 * \param[in] retention     the number of segments to keep, at least 1
+                 * \param[in] policy        the msync() policy
+                 * \param[in] syncPeriod    the period for FileSyncPolicy::kPeriodic
+                 */
+                FileSink(std::string directory, char const *appId, std::size_t segmentSize, std::size_t retention,
+                         FileSyncPolicy policy, std::chrono::milliseconds syncPeriod);
+
+                ~FileSink() override;
+
+                FileSink(FileSink const &) = delete;
+                FileSink& operator=(FileSink const &) = delete;
+
+                void Write(RecordHeader const &header, std::uint8_t const *payload) noexcept override;
+
+                void Flush() noexcept override;
+
+            private:
+                static constexpr std::chrono::seconds kReopenPeriod{1};
+
+                std::string SegmentPath(std::uint64_t sequence) const;
+                std::vector<std::uint64_t> FindSegments() const;
+                bool OpenSegment() noexcept;
+                void CloseSegment() noexcept;
+                void Append(RecordHeader const &header, std::uint8_t const *payload) noexcept;
+
+                std::string const directory_;
+                std::string prefix_;
+                std::size_t const segmentSize_;
+                std::size_t const retention_;
+                FileSyncPolicy const policy_;
+                std::chrono::milliseconds const syncPeriod_;
+
+                std::uint64_t sequence_;
+                std::uint8_t *segment_;
+                std::size_t used_;
+                std::size_t synced_;
+                std::chrono::steady_clock::time_point nextSync_;
+                std::chrono::steady_clock::time_point nextOpen_;   /*< earliest retry after a failed OpenSegment() */
+                std::vector<std::uint64_t> leftovers_;  /*< segments of earlier runs, removed by the first OpenSegment() */
+                std::bitset<SchemaRegistry::kMaxSchemas> announced_;    /*< schemas defined in the current segment */
+            };
+        } // namespace internal
+    } // namespace log
+
+} // namespace ara
+
+
+#endif // ARA_LOG_FILE_SINK_H_
@@ -0,0 +1,360 @@
+/**
+ * \file log_formatter.cpp
+ * \author Vincent WANG (you@domain.com)
+ * \brief
+ * \version 0.1
+ * \date 2020-12-08
+ *
+ * \copyright Copyright (c) 2020
+ *
+ */
+#include "log_formatter.h"
+
+#include <cinttypes>
+#include <cstdio>
+#include <cstring>
+#include "ara/com/com_error_domain.h"
+#include "ara/com/e2e/e2e_error_domain.h"
+#include "ara/com/raw/raw_error_domain.h"
+#include "ara/core/core_error_domain.h"
+#include "ara/core/error_domain.h"
+#include "ara/core/future_error_domain.h"
+#include "ara/exec/exec_error_domain.h"
+
+namespace ara
+{
+    namespace log
+    {
+        namespace internal
+        {
+            namespace
+            {
+                constexpr ara::core::internal::ErrorMessageTable const *kKnownDomains[] = {
+                    &ara::core::internal::CoreErrorMessages<>::kTable,
+                    &ara::core::internal::FutureErrorMessages<>::kTable,
+                    &ara::exec::internal::ExecErrorMessages<>::kTable,
+                    &ara::com::internal::ComErrorMessages<>::kTable,
+                    &ara::com::e2e::internal::E2EErrorMessages<>::kTable,
+                    &ara::com::raw::internal::RawErrorMessages<>::kTable,
+                };
+
+                class TextWriter
+                {
+                public:
+                    TextWriter(char *out, std::size_t capacity) noexcept
+                        : out_(out), capacity_(capacity), size_(0U)
+                    {
+                    }
+
+                    void Append(char const *text, std::size_t length) noexcept
+                    {
+                        std::size_t const room = capacity_ - size_;
+                        std::size_t const n = (length < room) ? length : room;
+                        std::memcpy(out_ + size_, text, n);
+                        size_ += n;
+                    }
+
+                    void Append(char c) noexcept
+                    {
+                        if (size_ < capacity_)
+                        {
+                            out_[size_++] = c;
+                        }
+                    }
+
+                    template <typename... Args>
+                    void Print(char const *format, Args... args) noexcept
+                    {
+                        char scratch[64];
+                        int const n = std::snprintf(scratch, sizeof(scratch), format, args...);
+                        if (n > 0)
+                        {
+                            Append(scratch, (static_cast<std::size_t>(n) < sizeof(scratch)) ? static_cast<std::size_t>(n) : sizeof(scratch) - 1U);
+                        }
+                    }
+
+                    std::size_t Size() const noexcept
+                    {
+                        return size_;
+                    }
+
+                private:
+                    char *out_;
+                    std::size_t capacity_;
+                    std::size_t size_;
+                };
+
+                template <typename T>
+                T Load(std::uint8_t const *src) noexcept
+                {
+                    T value;
+                    std::memcpy(&value, src, sizeof(T));
+                    return value;
+                }
+
+                void AppendHexDump(TextWriter &writer, std::uint8_t const *data, std::size_t size) noexcept
+                {
+                    static char const kDigits[] = "0123456789abcdef";
+                    for (std::size_t i = 0U; i < size; ++i)
+                    {
+                        writer.Append(kDigits[data[i] >> 4U]);
+                        writer.Append(kDigits[data[i] & 0x0FU]);
+                    }
+                }
+
+                template <typename T>
+                void AppendBinary(TextWriter &writer, T value) noexcept
+                {
+                    constexpr std::size_t kBits = sizeof(T) * 8U;
+                    writer.Append("0b", 2U);
+                    for (std::size_t i = kBits; i > 0U; --i)
+                    {
+                        writer.Append((((value >> (i - 1U)) & 1U) != 0U) ? '1' : '0');
+                    }
+                }
+
+                void AppendErrorCode(TextWriter &writer, ErrorCodeArg const &arg, DomainResolution resolution) noexcept
+                {
+                    ara::core::internal::ErrorMessageTable const *messages = KnownDomainMessages(arg.domainId);
+                    if ((messages == nullptr) && (resolution == DomainResolution::kInProcess) && (arg.domain != 0U))
+                    {
+                        auto const *domain = reinterpret_cast<ara::core::ErrorDomain const *>(static_cast<std::uintptr_t>(arg.domain));
+                        messages = domain->MessageTable();
+                        if (messages == nullptr)
+                        {
+                            writer.Print("%s:%" PRId32 " (%s)", domain->Name(), arg.value, domain->Message(arg.value));
+                            return;
+                        }
+                    }
+
+                    if (messages != nullptr)
+                    {
+                        writer.Print("%s:%" PRId32 " (%s)", messages->name, arg.value, messages->Message(arg.value));
+                    }
+                    else
+                    {
+                        writer.Print("0x%016" PRIx64 ":%" PRId32, arg.domainId, arg.value);
+                    }
+                }
+
+                /**
+                 * \brief Render one argument, return the number of consumed payload bytes or 0 on a malformed
+                 * payload.
+                 */
+                std::size_t FormatArgument(TextWriter &writer, std::uint8_t const *arg, std::size_t available, DomainResolution resolution) noexcept
+                {
+                    ArgType const type = static_cast<ArgType>(arg[0]);
+                    std::uint8_t const *value = arg + 1;
+                    std::size_t const room = available - 1U;
+
+                    switch (type)
+                    {
+                    case ArgType::kBool:
+                        if (room < 1U) { return 0U; }
+                        writer.Print("%s", (value[0] != 0U) ? "true" : "false");
+                        return 2U;
+                    case ArgType::kUint8:
+                        if (room < 1U) { return 0U; }
+                        writer.Print("%" PRIu8, Load<std::uint8_t>(value));
+                        return 2U;
+                    case ArgType::kUint16:
+                        if (room < 2U) { return 0U; }
+                        writer.Print("%" PRIu16, Load<std::uint16_t>(value));
+                        return 3U;
+                    case ArgType::kUint32:
+                        if (room < 4U) { return 0U; }
+                        writer.Print("%" PRIu32, Load<std::uint32_t>(value));
+                        return 5U;
+                    case ArgType::kUint64:
+                        if (room < 8U) { return 0U; }
+                        writer.Print("%" PRIu64, Load<std::uint64_t>(value));
+                        return 9U;
+                    case ArgType::kInt8:
+                        if (room < 1U) { return 0U; }
+                        writer.Print("%" PRId8, Load<std::int8_t>(value));
+                        return 2U;
+                    case ArgType::kInt16:
+                        if (room < 2U) { return 0U; }
+                        writer.Print("%" PRId16, Load<std::int16_t>(value));
+                        return 3U;
+                    case ArgType::kInt32:
+                        if (room < 4U) { return 0U; }
+                        writer.Print("%" PRId32, Load<std::int32_t>(value));
+                        return 5U;
+                    case ArgType::kInt64:
+                        if (room < 8U) { return 0U; }
+                        writer.Print("%" PRId64, Load<std::int64_t>(value));
+                        return 9U;
+                    case ArgType::kFloat32:
+                        if (room < 4U) { return 0U; }
+                        writer.Print("%g", static_cast<double>(Load<float>(value)));
+                        return 5U;
+                    case ArgType::kFloat64:
+                        if (room < 8U) { return 0U; }
+                        writer.Print("%g", Load<double>(value));
+                        return 9U;
+                    case ArgType::kLogLevel:
+                        if (room < 1U) { return 0U; }
+                        writer.Print("%s", LogLevelName(static_cast<LogLevel>(value[0])));
+                        return 2U;
+                    case ArgType::kHex8:
+                        if (room < 1U) { return 0U; }
+                        writer.Print("0x%02" PRIx8, Load<std::uint8_t>(value));
+                        return 2U;
+                    case ArgType::kHex16:
+                        if (room < 2U) { return 0U; }
+                        writer.Print("0x%04" PRIx16, Load<std::uint16_t>(value));
+                        return 3U;
+                    case ArgType::kHex32:
+                        if (room < 4U) { return 0U; }
+                        writer.Print("0x%08" PRIx32, Load<std::uint32_t>(value));
+                        return 5U;
+                    case ArgType::kHex64:
+                        if (room < 8U) { return 0U; }
+                        writer.Print("0x%016" PRIx64, Load<std::uint64_t>(value));
+                        return 9U;
+                    case ArgType::kBin8:
+                        if (room < 1U) { return 0U; }
+                        AppendBinary(writer, Load<std::uint8_t>(value));
+                        return 2U;
+                    case ArgType::kBin16:
+                        if (room < 2U) { return 0U; }
+                        AppendBinary(writer, Load<std::uint16_t>(value));
+                        return 3U;
+                    case ArgType::kBin32:
+                        if (room < 4U) { return 0U; }
+                        AppendBinary(writer, Load<std::uint32_t>(value));
+                        return 5U;
+                    case ArgType::kBin64:
+                        if (room < 8U) { return 0U; }
+                        AppendBinary(writer, Load<std::uint64_t>(value));
+                        return 9U;
+                    case ArgType::kErrorCode:
+                        if (room < sizeof(ErrorCodeArg)) { return 0U; }
+                        AppendErrorCode(writer, Load<ErrorCodeArg>(value), resolution);
+                        return 1U + sizeof(ErrorCodeArg);
+                    case ArgType::kString:
+                    case ArgType::kRawBuffer:
+                    {
+                        if (room < 2U) { return 0U; }
+                        std::size_t const length = Load<std::uint16_t>(value);
+                        if ((room - 2U) < length) { return 0U; }
+                        if (type == ArgType::kString)
+                        {
+                            writer.Append(reinterpret_cast<char const *>(value + 2), length);
+                        }
+                        else
+                        {
+                            AppendHexDump(writer, value + 2, length);
+                        }
+                        return 3U + length;
+                    }
+                    default:
+                        return 0U;
+                    }
+                }
+            } // namespace
+
+            ara::core::internal::ErrorMessageTable const* KnownDomainMessages(std::uint64_t domainId) noexcept
+            {
+                return ara::core::internal::FindErrorMessageTable(
+                    kKnownDomains, sizeof(kKnownDomains) / sizeof(kKnownDomains[0]), domainId);
+            }
+
+            char const* KnownDomainName(std::uint64_t domainId) noexcept
+            {
+                ara::core::internal::ErrorMessageTable const *const messages = KnownDomainMessages(domainId);
+                return (messages != nullptr) ? messages->name : nullptr;
+            }
+
+            char const* LogLevelName(LogLevel level) noexcept
+            {
+                switch (level)
+                {
+                case LogLevel::kOff:
+                    return "off";
+                case LogLevel::kFatal:
+                    return "fatal";
+                case LogLevel::kError:
+                    return "error";
+                case LogLevel::kWarn:
+                    return "warn";
+                case LogLevel::kInfo:
+                    return "info";
+                case LogLevel::kDebug:
+                    return "debug";
+                case LogLevel::kVerbose:
+                    return "verbose";
+                default:
+                    return "unknown";
+                }
+            }
+
+            std::size_t FormatPayload(std::uint8_t const *payload, std::size_t size, char *out, std::size_t capacity,
+                                      DomainResolution resolution, SchemaRegistry const *schemas) noexcept
+            {
+                TextWriter writer(out, capacity);
+                std::size_t offset = 0U;
+                Schema const *schema = nullptr;
+
+                if ((size > sizeof(std::uint32_t)) && (static_cast<ArgType>(payload[0]) == ArgType::kSchema))
+                {
+                    std::uint32_t const id = Load<std::uint32_t>(payload + 1);
+                    schema = ((schemas != nullptr) ? *schemas : SchemaRegistry::Instance()).Find(id);
+                    offset = 1U + sizeof(id);
+                }
+
+                for (std::uint8_t index = 0U; offset < size; ++index)
+                {
+                    if (index != 0U)
+                    {
+                        writer.Append(' ');
+                    }
+
+                    SchemaField const *field = (schema != nullptr) ? schema->Field(index) : nullptr;
+                    if (field != nullptr)
+                    {
+                        writer.Append(field->name.data(), field->name.size());
+                        writer.Append('=');
+                    }
+
+                    std::size_t const consumed = FormatArgument(writer, payload + offset, size - offset, resolution);
+                    if (consumed == 0U)
+                    {
+                        writer.Append("<malformed>", 11U);
+                        break;
+                    }
+                    offset += consumed;
+                }
+                return writer.Size();
+            }
+
+            std::size_t FormatRecord(char const *appId, RecordHeader const &header, std::uint8_t const *payload, char *out, std::size_t capacity,
+                                     DomainResolution resolution, SchemaRegistry const *schemas) noexcept
+            {
+                if ((header.payloadSize != 0U) && (static_cast<ArgType>(payload[0]) == ArgType::kSchemaDefinition))
+                {
+                    return 0U;
+                }
+
+                TextWriter writer(out, capacity);
+                std::uint64_t const micros = header.timestamp / 1000U;
+
+                writer.Print("%" PRIu64 ".%06" PRIu64 " %.4s %.4s [%s] ",
+                             micros / 1000000U, micros % 1000000U, appId, header.ctxId, LogLevelName(header.level));
+
+                // keep one character for the newline
+                std::size_t const used = writer.Size();
+                if (used >= capacity)
+                {
+                    return used;
+                }
+
+                std::size_t const total = used + FormatPayload(payload, header.payloadSize, out + used, capacity - used - 1U, resolution, schemas);
+                out[total] = '\n';
+                return total + 1U;
+            }
+        } // namespace internal
+    } // namespace log
+
+} // namespace ara
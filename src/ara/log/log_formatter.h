@@ -0,0 +1,102 @@
+/**
+ * \file log_formatter.h
+ * \author Vincent WANG (you@domain.com)
+ * \brief Text rendering of binary log records, executed on the logging thread only.
+ * \version 0.1
+ * \date 2020-12-08
+ *
+ * \copyright Copyright (c) 2020
+ *
+ */
+#ifndef ARA_LOG_LOG_FORMATTER_H_
+#define ARA_LOG_LOG_FORMATTER_H_
+
+#include <cstddef>
+#include <cstdint>
+#include "ara/core/error_domain.h"
+#include "ara/log/common.h"
+#include "ara/log/log_record.h"
+#include "schema_registry.h"
+
+namespace ara
+{
+    namespace log
+    {
+        namespace internal
+        {
+            /**
+             * \brief How ErrorCode arguments are turned into text.
+             *
+             */
+            enum class DomainResolution : uint8_t
+            {
+                kInProcess, /*< the record was produced by this process, use the recorded ErrorDomain */
+                kOffline,   /*< the record was read from a binary log, only the domain ID is usable */
+            };
+
+            /**
+             * \brief Return the static name and messages of a well-known error domain.
+             *
+             * The registry is a constant table of the domains of the tree (Core, Future, Exec, Com, E2E, Raw), so that
+             * ErrorCode arguments are rendered with name and message both in-process and from a binary log.
+             *
+             * \param[in] domainId  the ErrorDomain::Id()
+             * \return ara::core::internal::ErrorMessageTable const*  the table, or nullptr if the domain is unknown
+             */
+            ara::core::internal::ErrorMessageTable const* KnownDomainMessages(std::uint64_t domainId) noexcept;
+
+            /**
+             * \brief Return the shortname of a well-known error domain.
+             *
+             * \param[in] domainId  the ErrorDomain::Id()
+             * \return char const*  the shortname, or nullptr if the domain is unknown
+             */
+            char const* KnownDomainName(std::uint64_t domainId) noexcept;
+
+            /**
+             * \brief Return the textual name of a log level.
+             *
+             * \param[in] level     the log level
+             * \return char const*  the name, never nullptr
+             */
+            char const* LogLevelName(LogLevel level) noexcept;
+
+            /**
+             * \brief Render the encoded arguments of a record, separated by a single space.
+             *
+             * \param[in] payload   the encoded arguments
+             * \param[in] size      the number of payload bytes
+             * \param[out] out      the destination buffer
+             * \param[in] capacity  the size of the destination buffer
+             * \param[in] resolution    how ErrorCode arguments are resolved
+             * \param[in] schemas   the field names of structured arguments, nullptr for the registry of this process
+             * \return std::size_t  the number of characters written, the output is not null terminated
+             */
+            std::size_t FormatPayload(std::uint8_t const *payload, std::size_t size, char *out, std::size_t capacity,
+                                      DomainResolution resolution = DomainResolution::kInProcess,
+                                      SchemaRegistry const *schemas = nullptr) noexcept;
+
+            /**
+             * \brief Render a complete record as one line of text including the trailing newline.
+             *
+             * kSchemaDefinition records are not rendered.
+             *
+             * \param[in] appId     the 4 character application ID, padded with '\0'
+             * \param[in] header    the record header
+             * \param[in] payload   the encoded arguments
+             * \param[out] out      the destination buffer
+             * \param[in] capacity  the size of the destination buffer
+             * \param[in] resolution    how ErrorCode arguments are resolved
+             * \param[in] schemas   the field names of structured arguments, nullptr for the registry of this process
+             * \return std::size_t  the number of characters written, the output is not null terminated
+             */
+            std::size_t FormatRecord(char const *appId, RecordHeader const &header, std::uint8_t const *payload, char *out, std::size_t capacity,
+                                     DomainResolution resolution = DomainResolution::kInProcess,
+                                     SchemaRegistry const *schemas = nullptr) noexcept;
+        } // namespace internal
+    } // namespace log
+
+} // namespace ara
+
+
+#endif // ARA_LOG_LOG_FORMATTER_H_
@@ -0,0 +1,418 @@
+/**
+ * \file log_manager.cpp
+ * \author Vincent WANG (you@domain.com)
+ * \brief
+ * \version 0.1
+ * \date 2020-12-08
+ *
+ * \copyright Copyright (c) 2020
+ *
+ */
+#include "log_manager.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <new>
+#include "ara/core/abort.h"
+#include "ara/log/rate_limit.h"
+#include "console_sink.h"
+#include "dlt_remote_sink.h"
+#include "file_sink.h"
+#include "logger_registry.h"
+
+namespace ara
+{
+    namespace log
+    {
+        namespace internal
+        {
+            namespace
+            {
+                /**
+                 * \brief Thread-local owner of the calling thread's buffer, closes it when the thread exits.
+                 */
+                struct ProducerHandle
+                {
+                    ~ProducerHandle()
+                    {
+                        if (slot)
+                        {
+                            slot->closed.store(true, std::memory_order_release);
+                        }
+                    }
+
+                    std::shared_ptr<ProducerSlot> slot;
+                };
+
+                thread_local ProducerHandle tlsProducer;
+
+                void CopyId(char (&dst)[4], std::string const &id) noexcept
+                {
+                    std::memset(dst, 0, sizeof(dst));
+                    std::memcpy(dst, id.data(), std::min(id.size(), sizeof(dst)));
+                }
+
+                template <typename T>
+                std::uint8_t* PutArgument(std::uint8_t *dst, ArgType type, T const &value) noexcept
+                {
+                    dst[0] = static_cast<std::uint8_t>(type);
+                    std::memcpy(dst + 1, &value, sizeof(T));
+                    return dst + 1 + sizeof(T);
+                }
+
+                Logger* FindLogger(RecordHeader const &header) noexcept
+                {
+                    std::uint32_t key;
+                    std::memcpy(&key, header.ctxId, sizeof(key));
+                    return LoggerRegistry::Instance().Find(key);
+                }
+
+                // kFatal and kError records are never dropped under BackpressurePolicy::kBySeverity
+                bool IsSevere(void const *record) noexcept
+                {
+                    RecordHeader header;
+                    std::memcpy(&header, record, sizeof(header));
+                    return header.level <= LogLevel::kError;
+                }
+
+                std::uint8_t* PutString(std::uint8_t *dst, char const *text) noexcept
+                {
+                    std::uint16_t const length = static_cast<std::uint16_t>(std::strlen(text));
+                    dst = PutArgument(dst, ArgType::kString, length);
+                    std::memcpy(dst, text, length);
+                    return dst + length;
+                }
+            } // namespace
+
+            LogManager& LogManager::Instance()
+            {
+                static LogManager instance;
+                return instance;
+            }
+
+            LogManager::LogManager()
+                : running_(true), producersChanged_(false), dropped_(0U),
+                  backpressure_(BackpressurePolicy::kDropNewest), blockTimeout_(0), bufferSize_(0U)
+            {
+                Configure(LogConfig{});
+                worker_ = std::thread(&LogManager::Run, this);
+            }
+
+            LogManager::~LogManager()
+            {
+                Shutdown();
+            }
+
+            void LogManager::Configure(LogConfig const &config)
+            {
+                char appId[4];
+                char ecuId[4];
+                CopyId(appId, config.appId);
+                CopyId(ecuId, config.ecuId);
+
+                std::vector<std::unique_ptr<LogSink>> sinks;
+                if (HasLogMode(config.mode, LogMode::kConsole))
+                {
+                    sinks.emplace_back(new ConsoleSink(appId, stdout));
+                }
+                if (HasLogMode(config.mode, LogMode::kRemote))
+                {
+                    sinks.emplace_back(new DltRemoteSink(ecuId, appId, config.remoteTransport, config.remoteHost, config.remotePort));
+                }
+                if (HasLogMode(config.mode, LogMode::kFile))
+                {
+                    sinks.emplace_back(new FileSink(config.filePath, appId, config.fileSegmentSize, config.fileRetention,
+                                                    config.fileSyncPolicy, config.fileSyncPeriod));
+                }
+
+                std::lock_guard<std::mutex> lock(sinksMutex_);
+                for (auto &sink : sinks_)
+                {
+                    sink->Flush();
+                }
+                sinks_ = std::move(sinks);
+                config_ = config;
+                backpressure_.store(config.backpressure, std::memory_order_relaxed);
+                blockTimeout_.store(config.blockTimeout.count(), std::memory_order_relaxed);
+                bufferSize_.store(config.bufferSize, std::memory_order_relaxed);
+            }
+
+            bool LogManager::Submit(Logger const &logger, void const *record, std::size_t size) noexcept
+            {
+                ProducerSlot *slot = tlsProducer.slot.get();
+                if (slot == nullptr)
+                {
+                    slot = RegisterProducer();
+                }
+
+                ContextCounters &counters = logger.Counters();
+                if ((slot != nullptr) && Enqueue(slot->buffer, record, size))
+                {
+                    counters.enqueued.fetch_add(1U, std::memory_order_relaxed);
+                    return true;
+                }
+
+                counters.dropped.fetch_add(1U, std::memory_order_relaxed);
+                dropped_.fetch_add(1U, std::memory_order_relaxed);
+                return false;
+            }
+
+            bool LogManager::Enqueue(SpscRingBuffer &buffer, void const *record, std::size_t size) noexcept
+            {
+                BackpressurePolicy const policy = backpressure_.load(std::memory_order_relaxed);
+                if ((policy == BackpressurePolicy::kBySeverity) && !running_.load(std::memory_order_acquire)
+                    && IsSevere(record))
+                {
+                    // nobody drains the buffer any more
+                    return WriteThrough(record);
+                }
+                if (buffer.TryWrite(record, size))
+                {
+                    return true;
+                }
+
+                switch (policy)
+                {
+                case BackpressurePolicy::kDropOldest:
+                    return Overwrite(buffer, record, size, [](RecordHeader const &) { return true; });
+                case BackpressurePolicy::kBlock:
+                    return Await(buffer, record, size, std::chrono::steady_clock::now()
+                                 + std::chrono::microseconds(blockTimeout_.load(std::memory_order_relaxed)));
+                case BackpressurePolicy::kBySeverity:
+                {
+                    RecordHeader header;
+                    std::memcpy(&header, record, sizeof(header));
+                    LogLevel const level = header.level;
+                    if (Overwrite(buffer, record, size, [level](RecordHeader const &oldest) {
+                            return (oldest.level > LogLevel::kError) && (oldest.level > level);
+                        }))
+                    {
+                        return true;
+                    }
+                    if (level > LogLevel::kError)
+                    {
+                        return false;
+                    }
+                    // the buffer holds only kFatal/kError records or the logging thread is reading the oldest one
+                    return Await(buffer, record, size, std::chrono::steady_clock::time_point::max())
+                        || WriteThrough(record);
+                }
+                case BackpressurePolicy::kDropNewest:
+                default:
+                    return false;
+                }
+            }
+
+            template <typename Predicate>
+            bool LogManager::Overwrite(SpscRingBuffer &buffer, void const *record, std::size_t size, Predicate &&mayDiscard) noexcept
+            {
+                auto const predicate = [&mayDiscard](std::uint8_t const *oldest, std::size_t) {
+                    RecordHeader header;
+                    std::memcpy(&header, oldest, sizeof(header));
+                    return mayDiscard(header);
+                };
+                auto const account = [this](std::uint8_t const *discarded, std::size_t) {
+                    RecordHeader header;
+                    std::memcpy(&header, discarded, sizeof(header));
+                    Logger *logger = FindLogger(header);
+                    if (logger != nullptr)
+                    {
+                        logger->Counters().dropped.fetch_add(1U, std::memory_order_relaxed);
+                    }
+                    dropped_.fetch_add(1U, std::memory_order_relaxed);
+                };
+
+                while (buffer.DiscardOldest(predicate, account))
+                {
+                    if (buffer.TryWrite(record, size))
+                    {
+                        return true;
+                    }
+                }
+                return false;
+            }
+
+            bool LogManager::WriteThrough(void const *record) noexcept
+            {
+                RecordHeader header;
+                std::memcpy(&header, record, sizeof(header));
+                std::uint8_t const *payload = static_cast<std::uint8_t const *>(record) + sizeof(header);
+
+                std::lock_guard<std::mutex> lock(sinksMutex_);
+                for (auto &sink : sinks_)
+                {
+                    sink->Write(header, payload);
+                    sink->Flush();
+                }
+
+                Logger *logger = FindLogger(header);
+                if (logger != nullptr)
+                {
+                    logger->Counters().flushed.fetch_add(1U, std::memory_order_relaxed);
+                }
+                return true;
+            }
+
+            bool LogManager::Await(SpscRingBuffer &buffer, void const *record, std::size_t size,
+                                   std::chrono::steady_clock::time_point deadline) noexcept
+            {
+                // the logging thread never waits for producers, so the buffer drains unless it is stopped
+                while (running_.load(std::memory_order_acquire))
+                {
+                    std::this_thread::yield();
+                    if (buffer.TryWrite(record, size))
+                    {
+                        return true;
+                    }
+                    if (std::chrono::steady_clock::now() >= deadline)
+                    {
+                        break;
+                    }
+                }
+                return false;
+            }
+
+            std::uint64_t LogManager::DroppedRecords() const noexcept
+            {
+                return dropped_.load(std::memory_order_relaxed);
+            }
+
+            void LogManager::Shutdown()
+            {
+                if (running_.exchange(false, std::memory_order_acq_rel) && worker_.joinable())
+                {
+                    worker_.join();
+                }
+            }
+
+            ProducerSlot* LogManager::RegisterProducer() noexcept
+            {
+                ARA_CORE_TRY
+                {
+                    auto slot = std::make_shared<ProducerSlot>(bufferSize_.load(std::memory_order_relaxed));
+                    {
+                        std::lock_guard<std::mutex> lock(producersMutex_);
+                        newProducers_.push_back(slot);
+                    }
+                    producersChanged_.store(true, std::memory_order_release);
+                    tlsProducer.slot = std::move(slot);
+                    return tlsProducer.slot.get();
+                }
+                ARA_CORE_CATCH(std::bad_alloc const &)
+                {
+                    return nullptr;
+                }
+            }
+
+            void LogManager::Run()
+            {
+                while (running_.load(std::memory_order_acquire))
+                {
+                    if (DrainOnce() == 0U)
+                    {
+                        std::chrono::microseconds idlePeriod;
+                        {
+                            std::lock_guard<std::mutex> lock(sinksMutex_);
+                            idlePeriod = config_.idlePeriod;
+                        }
+                        std::this_thread::sleep_for(idlePeriod);
+                    }
+                }
+
+                // pick up everything that was submitted before Shutdown()
+                while (DrainOnce() != 0U)
+                {
+                }
+            }
+
+            void LogManager::AdoptNewProducers()
+            {
+                std::lock_guard<std::mutex> lock(producersMutex_);
+                producersChanged_.store(false, std::memory_order_relaxed);
+                producers_.insert(producers_.end(), newProducers_.begin(), newProducers_.end());
+                newProducers_.clear();
+            }
+
+            std::size_t LogManager::DrainOnce()
+            {
+                if (producersChanged_.load(std::memory_order_acquire))
+                {
+                    AdoptNewProducers();
+                }
+
+                std::lock_guard<std::mutex> lock(sinksMutex_);
+                auto const dispatch = [this](std::uint8_t const *record, std::size_t) {
+                    RecordHeader header;
+                    std::memcpy(&header, record, sizeof(header));
+                    for (auto &sink : sinks_)
+                    {
+                        sink->Write(header, record + sizeof(header));
+                    }
+
+                    Logger *logger = FindLogger(header);
+                    if (logger != nullptr)
+                    {
+                        logger->Counters().flushed.fetch_add(1U, std::memory_order_relaxed);
+                    }
+                };
+
+                std::size_t count = ReportCallSites();
+                for (auto it = producers_.begin(); it != producers_.end();)
+                {
+                    ProducerSlot &slot = **it;
+                    bool const closed = slot.closed.load(std::memory_order_acquire);
+                    count += slot.buffer.Read(dispatch);
+                    it = closed ? producers_.erase(it) : (it + 1);
+                }
+
+                if (count != 0U)
+                {
+                    for (auto &sink : sinks_)
+                    {
+                        sink->Flush();
+                    }
+                }
+                return count;
+            }
+
+            std::size_t LogManager::ReportCallSites() noexcept
+            {
+                std::uint64_t const now = static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                    std::chrono::steady_clock::now().time_since_epoch()).count());
+
+                std::size_t count = 0U;
+                for (CallSite *site = CallSite::First(); site != nullptr; site = site->Next())
+                {
+                    std::uint64_t const suppressed = site->Refill(now);
+                    Logger const *logger = site->LastLogger();
+                    if ((suppressed == 0U) || (logger == nullptr))
+                    {
+                        continue;
+                    }
+
+                    // "<site> last message repeated <N> times", in the record format of a LogStream
+                    std::uint8_t payload[kMaxPayloadSize];
+                    std::uint8_t *end = PutArgument(payload, ArgType::kHex32, site->Key());
+                    end = PutString(end, "last message repeated");
+                    end = PutArgument(end, ArgType::kUint64, suppressed);
+                    end = PutString(end, "times");
+
+                    RecordHeader header;
+                    header.timestamp = now;
+                    std::memcpy(header.ctxId, logger->ContextId(), sizeof(header.ctxId));
+                    header.payloadSize = static_cast<std::uint16_t>(end - payload);
+                    header.level = site->LastLevel();
+                    header.argCount = 4U;
+                    for (auto &sink : sinks_)
+                    {
+                        sink->Write(header, payload);
+                    }
+                    ++count;
+                }
+                return count;
+            }
+        } // namespace internal
+    } // namespace log
+
+} // namespace ara
@@ -0,0 +1,184 @@
+/**
+ * \file log_manager.h
+ * \author Vincent WANG (you@domain.com)
+ * \brief Logging back-end: per-thread record buffers and the single logging thread draining them.
+ * \version 0.1
+ * \date 2020-12-08
+ *
+ * \copyright Copyright (c) 2020
+ *
+ */
+#ifndef ARA_LOG_LOG_MANAGER_H_
+#define ARA_LOG_LOG_MANAGER_H_
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include "ara/log/common.h"
+#include "ara/log/log_record.h"
+#include "ara/log/logger.h"
+#include "dlt_remote_sink.h"
+#include "file_sink.h"
+#include "log_sink.h"
+#include "spsc_ring_buffer.h"
+
+namespace ara
+{
+    namespace log
+    {
+        namespace internal
+        {
+            /**
+             * \brief What LogManager::Submit() does when the buffer of the calling thread is full.
+             *
+             */
+            enum class BackpressurePolicy : std::uint8_t
+            {
+                kDropNewest,    /*< drop the new record, Submit() never waits */
+                kDropOldest,    /*< discard the oldest buffered records until the new one fits */
+                kBlock,         /*< wait up to LogConfig::blockTimeout for the logging thread, then drop */
+                kBySeverity,    /*< discard older records of lower severity, but never kFatal or kError ones;
+                                    if there are none, drop the new record. kFatal and kError records are never
+                                    dropped: they wait without time limit until the logging thread makes room,
+                                    and after Shutdown() they are written to the sinks by the caller */
+            };
+
+            /**
+             * \brief Configuration of the logging back-end, usually taken from the execution manifest.
+             *
+             */
+            struct LogConfig
+            {
+                std::string appId{"ARA"};                       /*< DLT application ID, up to 4 characters */
+                std::string appDescription;                     /*< description of the application */
+                std::string ecuId{"ECU1"};                      /*< DLT ECU ID, up to 4 characters */
+                LogMode mode{LogMode::kConsole};                /*< sinks the records are forwarded to */
+                RemoteTransport remoteTransport{RemoteTransport::kUdp}; /*< transport of the kRemote sink */
+                std::string remoteHost{"127.0.0.1"};            /*< numeric IPv4 address of the DLT receiver */
+                std::uint16_t remotePort{3490U};                /*< port of the DLT receiver */
+                std::string filePath{"/var/log"};               /*< directory of the kFile segments */
+                std::size_t fileSegmentSize{4U * 1024U * 1024U}; /*< size of one kFile segment in bytes */
+                std::size_t fileRetention{8U};                  /*< number of kFile segments kept */
+                FileSyncPolicy fileSyncPolicy{FileSyncPolicy::kOnRotate}; /*< msync() policy of kFile */
+                std::chrono::milliseconds fileSyncPeriod{1000}; /*< period for FileSyncPolicy::kPeriodic */
+                std::size_t bufferSize{65536U};                 /*< per-thread ring buffer size in bytes */
+                BackpressurePolicy backpressure{BackpressurePolicy::kDropNewest}; /*< behaviour on a full buffer */
+                std::chrono::microseconds blockTimeout{1000};   /*< maximum wait of BackpressurePolicy::kBlock */
+                std::chrono::microseconds idlePeriod{1000};     /*< sleep of the logging thread when all
+                                                                    buffers are empty */
+            };
+
+            /**
+             * \brief Record buffer of one producer thread.
+             *
+             */
+            struct ProducerSlot
+            {
+                explicit ProducerSlot(std::size_t bufferSize) : buffer(bufferSize, kMaxRecordSize)
+                {
+                }
+
+                SpscRingBuffer buffer;
+                std::atomic<bool> closed{false};    /*< set when the producer thread has exited */
+            };
+
+            /**
+             * \brief Owner of the producer buffers, the sinks and the logging thread.
+             *
+             * Every thread that flushes a LogStream gets its own SpscRingBuffer on first use. Submitting a record
+             * is a copy into that buffer and never takes a lock; formatting and output happen on the logging
+             * thread.
+             */
+            class LogManager final
+            {
+            public:
+                /**
+                 * \brief Return the process-wide instance, starting the logging thread on first use.
+                 *
+                 * \return LogManager&  the instance
+                 */
+                static LogManager& Instance();
+
+                LogManager(LogManager const &) = delete;
+                LogManager& operator=(LogManager const &) = delete;
+
+                /**
+                 * \brief Replace the configuration and rebuild the sinks for the configured LogMode.
+                 *
+                 * \param[in] config    the new configuration
+                 */
+                void Configure(LogConfig const &config);
+
+                /**
+                 * \brief Hand a record to the logging thread. Never allocates after the first call on a thread, only
+                 * waits if the configured BackpressurePolicy says so.
+                 *
+                 * \param[in] logger    the context of the record, its counters are updated
+                 * \param[in] record    RecordHeader followed by the payload
+                 * \param[in] size      the total record size
+                 * \return true         if the record was queued
+                 * \return false        if it was dropped because the buffer of this thread is full
+                 */
+                bool Submit(Logger const &logger, void const *record, std::size_t size) noexcept;
+
+                /**
+                 * \brief Return the number of records dropped so far by all producer threads.
+                 *
+                 * \return std::uint64_t    the number of dropped records
+                 */
+                std::uint64_t DroppedRecords() const noexcept;
+
+                /**
+                 * \brief Drain all buffers, flush the sinks and stop the logging thread.
+                 *
+                 */
+                void Shutdown();
+
+            private:
+                LogManager();
+                ~LogManager();
+
+                ProducerSlot* RegisterProducer() noexcept;
+                bool Enqueue(SpscRingBuffer &buffer, void const *record, std::size_t size) noexcept;
+                template <typename Predicate>
+                bool Overwrite(SpscRingBuffer &buffer, void const *record, std::size_t size, Predicate &&mayDiscard) noexcept;
+                bool WriteThrough(void const *record) noexcept;
+                bool Await(SpscRingBuffer &buffer, void const *record, std::size_t size,
+                           std::chrono::steady_clock::time_point deadline) noexcept;
+                void Run();
+                std::size_t DrainOnce();
+                void AdoptNewProducers();
+                std::size_t ReportCallSites() noexcept;
+
+                std::atomic<bool> running_;
+                std::atomic<bool> producersChanged_;
+                std::atomic<std::uint64_t> dropped_;
+                std::atomic<BackpressurePolicy> backpressure_;
+                std::atomic<std::chrono::microseconds::rep> blockTimeout_;
+                std::atomic<std::size_t> bufferSize_;   /*< read by new producers without taking sinksMutex_, which
+                                                            the logging thread holds while it drains */
+
+                std::mutex producersMutex_;
+                std::vector<std::shared_ptr<ProducerSlot>> newProducers_;
+
+                std::mutex sinksMutex_;
+                std::vector<std::unique_ptr<LogSink>> sinks_;
+                LogConfig config_;
+
+                // owned by the logging thread
+                std::vector<std::shared_ptr<ProducerSlot>> producers_;
+                std::thread worker_;
+            };
+        } // namespace internal
+    } // namespace log
+
+} // namespace ara
+
+
+#endif // ARA_LOG_LOG_MANAGER_H_
@@ -0,0 +1,55 @@
+/**
+ * \file log_sink.h
+ * \author Vincent WANG (you@domain.com)
+ * \brief Interface of the back-end sinks drained by the logging thread.
+ * \version 0.1
+ * \date 2020-12-08
+ *
+ * \copyright Copyright (c) 2020
+ *
+ */
+#ifndef ARA_LOG_LOG_SINK_H_
+#define ARA_LOG_LOG_SINK_H_
+
+#include <cstdint>
+#include "ara/log/log_record.h"
+
+namespace ara
+{
+    namespace log
+    {
+        namespace internal
+        {
+            /**
+             * \brief A destination for log records, one per configured LogMode flag.
+             *
+             * Sinks are only ever called from the logging thread, so implementations need no locking.
+             */
+            class LogSink
+            {
+            public:
+                virtual ~LogSink() = default;
+
+                /**
+                 * \brief Output one record.
+                 *
+                 * \param[in] header    the record header
+                 * \param[in] payload   header.payloadSize bytes of encoded arguments
+                 */
+                virtual void Write(RecordHeader const &header, std::uint8_t const *payload) noexcept = 0;
+
+                /**
+                 * \brief Called after every batch of records drained from the producer buffers.
+                 *
+                 */
+                virtual void Flush() noexcept
+                {
+                }
+            };
+        } // namespace internal
+    } // namespace log
+
+} // namespace ara
+
+
+#endif // ARA_LOG_LOG_SINK_H_
@@ -0,0 +1,46 @@
+/**
+ * \file logger.cpp
+ * \author Vincent WANG (you@domain.com)
+ * \brief
+ * \version 0.1
+ * \date 2020-12-08
+ *
+ * \copyright Copyright (c) 2020
+ *
+ */
+#include "ara/log/logger.h"
+
+#include <algorithm>
+#include <cstring>
+
+namespace ara
+{
+    namespace log
+    {
+        Logger::Logger(ara::core::StringView ctxId, ara::core::StringView ctxDescription, LogLevel ctxDefLogLevel)
+            : ctxDescription_(ctxDescription.data(), ctxDescription.size()),
+              level_(static_cast<std::uint8_t>(ctxDefLogLevel))
+        {
+            std::memset(ctxId_, 0, sizeof(ctxId_));
+            std::memcpy(ctxId_, ctxId.data(), std::min(ctxId.size(), sizeof(ctxId_)));
+        }
+
+        void Logger::SetLogLevel(LogLevel logLevel) noexcept
+        {
+            level_.store(static_cast<std::uint8_t>(logLevel), std::memory_order_relaxed);
+        }
+
+        ara::core::StringView Logger::ContextDescription() const noexcept
+        {
+            return ara::core::StringView(ctxDescription_.data(), ctxDescription_.size());
+        }
+
+        LogStatistics Logger::Statistics() const noexcept
+        {
+            return LogStatistics{counters_.enqueued.load(std::memory_order_relaxed),
+                                 counters_.dropped.load(std::memory_order_relaxed),
+                                 counters_.flushed.load(std::memory_order_relaxed)};
+        }
+    } // namespace log
+
+} // namespace ara
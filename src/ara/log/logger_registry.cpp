@@ -0,0 +1,149 @@
+/**
+ * \file logger_registry.cpp
+ * \author Vincent WANG (you@domain.com)
+ * \brief
+ * \version 0.1
+ * \date 2020-12-08
+ *
+ * \copyright Copyright (c) 2020
+ *
+ */
+#include "logger_registry.h"
+
+#include <cstring>
+#include <new>
+
+namespace ara
+{
+    namespace log
+    {
+        namespace internal
+        {
+            std::uint32_t ContextKey(ara::core::StringView ctxId) noexcept
+            {
+                char id[4] = {};
+                std::memcpy(id, ctxId.data(), (ctxId.size() < sizeof(id)) ? ctxId.size() : sizeof(id));
+                std::uint32_t key;
+                std::memcpy(&key, id, sizeof(key));
+                return key;
+            }
+
+            LoggerRegistry& LoggerRegistry::Instance()
+            {
+                // never destroyed, the logging thread still resolves records while static objects are destroyed
+                static LoggerRegistry *const instance = new LoggerRegistry();
+                return *instance;
+            }
+
+            LoggerRegistry::LoggerRegistry()
+                : slots_(new Slot[kSlots]), used_(0U), count_(0U)
+            {
+            }
+
+            std::size_t LoggerRegistry::Hash(std::uint32_t key) noexcept
+            {
+                // Fibonacci hashing, the top bits of the product are the best mixed ones
+                return static_cast<std::size_t>((key * 0x9E3779B97F4A7C15ULL) >> 52U) & (kSlots - 1U);
+            }
+
+            Logger* LoggerRegistry::Find(std::uint32_t key) const noexcept
+            {
+                std::uint64_t const tagged = kOccupied | key;
+                for (std::size_t i = Hash(key), probes = 0U; probes < kSlots; i = (i + 1U) & (kSlots - 1U), ++probes)
+                {
+                    std::uint64_t const slotKey = slots_[i].key.load(std::memory_order_acquire);
+                    if (slotKey == tagged)
+                    {
+                        return slots_[i].logger.load(std::memory_order_relaxed);
+                    }
+                    if (slotKey == 0U)
+                    {
+                        break;
+                    }
+                }
+
+                // once the index is at capacity, further contexts are only in the arena
+                if (used_.load(std::memory_order_acquire) < kIndexCapacity)
+                {
+                    return nullptr;
+                }
+                std::lock_guard<std::mutex> lock(mutex_);
+                return FindLocked(key);
+            }
+
+            Logger* LoggerRegistry::FindLocked(std::uint32_t key) const noexcept
+            {
+                for (std::size_t i = 0U; i < count_; ++i)
+                {
+                    auto *logger = reinterpret_cast<Logger *>(&chunks_[i / kChunkSize]->storage[i % kChunkSize]);
+                    std::uint32_t loggerKey;
+                    std::memcpy(&loggerKey, logger->ContextId(), sizeof(loggerKey));
+                    if (loggerKey == key)
+                    {
+                        return logger;
+                    }
+                }
+                return nullptr;
+            }
+
+            Logger& LoggerRegistry::GetOrCreate(ara::core::StringView ctxId, ara::core::StringView ctxDescription, LogLevel ctxDefLogLevel)
+            {
+                std::uint32_t const key = ContextKey(ctxId);
+                Logger *logger = Find(key);
+                if (logger != nullptr)
+                {
+                    return *logger;
+                }
+
+                std::lock_guard<std::mutex> lock(mutex_);
+                logger = FindLocked(key);
+                if (logger != nullptr)
+                {
+                    return *logger;
+                }
+
+                if ((count_ % kChunkSize) == 0U)
+                {
+                    chunks_.emplace_back(new Chunk);
+                }
+                void *storage = &chunks_[count_ / kChunkSize]->storage[count_ % kChunkSize];
+                logger = new (storage) Logger(ctxId, ctxDescription, ctxDefLogLevel);
+                ++count_;
+
+                if (used_.load(std::memory_order_relaxed) < kIndexCapacity)
+                {
+                    std::size_t i = Hash(key);
+                    while (slots_[i].key.load(std::memory_order_relaxed) != 0U)
+                    {
+                        i = (i + 1U) & (kSlots - 1U);
+                    }
+                    slots_[i].logger.store(logger, std::memory_order_relaxed);
+                    slots_[i].key.store(kOccupied | key, std::memory_order_release);
+                    used_.fetch_add(1U, std::memory_order_release);
+                }
+                return *logger;
+            }
+
+            bool LoggerRegistry::SetLogLevel(std::uint32_t key, LogLevel level) noexcept
+            {
+                Logger *logger = Find(key);
+                if (logger == nullptr)
+                {
+                    return false;
+                }
+                logger->SetLogLevel(level);
+                return true;
+            }
+
+            void LoggerRegistry::SetLogLevel(LogLevel level) noexcept
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                for (std::size_t i = 0U; i < count_; ++i)
+                {
+                    reinterpret_cast<Logger *>(&chunks_[i / kChunkSize]->storage[i % kChunkSize])->SetLogLevel(level);
+                }
+            }
+        } // namespace internal
+    } // namespace log
+
+} // namespace ara
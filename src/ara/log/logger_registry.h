@@ -0,0 +1,135 @@
+/**
+ * \file logger_registry.h
+ * \author Vincent WANG (you@domain.com)
+ * \brief Process-wide registry of the Logger contexts handed out by CreateLogger().
+ * \version 0.1
+ * \date 2020-12-08
+ *
+ * \copyright Copyright (c) 2020
+ *
+ */
+#ifndef ARA_LOG_LOGGER_REGISTRY_H_
+#define ARA_LOG_LOGGER_REGISTRY_H_
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <type_traits>
+#include <vector>
+#include "ara/core/string_view.h"
+#include "ara/log/common.h"
+#include "ara/log/logger.h"
+
+namespace ara
+{
+    namespace log
+    {
+        namespace internal
+        {
+            /**
+             * \brief Return the fixed-size key of a DLT context ID: its first 4 characters, padded with '\0'.
+             *
+             * \param[in] ctxId     the context ID
+             * \return std::uint32_t    the key
+             */
+            std::uint32_t ContextKey(ara::core::StringView ctxId) noexcept;
+
+            /**
+             * \brief Owner of all Logger instances.
+             *
+             * Loggers live in an arena of fixed-size chunks that is never moved or shrunk, and the registry is
+             * never destroyed, so references returned by CreateLogger() stay valid for the lifetime of the
+             * process, including the final drain of the logging thread at exit.
+             *
+             * The index is an open-addressing hash table from context key to Logger with a fixed number of
+             * slots. Lookups are lock-free: a slot is published by storing the Logger pointer first and the key
+             * with release semantics second, so a reader that sees the key also sees the Logger. Only the
+             * insertion of a new context takes the mutex. Contexts beyond kIndexCapacity are not indexed; once
+             * the index is at capacity, lookups that miss it search the arena under the mutex.
+             */
+            class LoggerRegistry final
+            {
+            public:
+                /**
+                 * \brief Return the process-wide instance.
+                 *
+                 * \return LoggerRegistry&  the instance
+                 */
+                static LoggerRegistry& Instance();
+
+                LoggerRegistry(LoggerRegistry const &) = delete;
+                LoggerRegistry& operator=(LoggerRegistry const &) = delete;
+
+                /**
+                 * \brief Return the Logger of a context, creating it on first use.
+                 *
+                 * \param[in] ctxId             the context ID
+                 * \param[in] ctxDescription    the description, only used when the context is created
+                 * \param[in] ctxDefLogLevel    the initial level, only used when the context is created
+                 * \return Logger&              the Logger of the context
+                 */
+                Logger& GetOrCreate(ara::core::StringView ctxId, ara::core::StringView ctxDescription, LogLevel ctxDefLogLevel);
+
+                /**
+                 * \brief Return the Logger of a context if it exists.
+                 *
+                 * \param[in] key       the context key, see ContextKey()
+                 * \return Logger*      the Logger, or nullptr if no such context was created
+                 */
+                Logger* Find(std::uint32_t key) const noexcept;
+
+                /**
+                 * \brief Change the level of one context, e.g. on a DLT set-log-level request.
+                 *
+                 * \param[in] key       the context key, see ContextKey()
+                 * \param[in] level     the new level
+                 * \return true         if the context exists
+                 * \return false        otherwise
+                 */
+                bool SetLogLevel(std::uint32_t key, LogLevel level) noexcept;
+
+                /**
+                 * \brief Change the level of all existing contexts.
+                 *
+                 * \param[in] level     the new level
+                 */
+                void SetLogLevel(LogLevel level) noexcept;
+
+            private:
+                static constexpr std::size_t kSlots = 4096U;            // power of two
+                static constexpr std::size_t kIndexCapacity = (kSlots * 3U) / 4U;  // keeps probe sequences short
+                static constexpr std::size_t kChunkSize = 64U;
+                static constexpr std::uint64_t kOccupied = 1ULL << 32U; // distinguishes the key "\0\0\0\0" from an empty slot
+
+                struct Slot
+                {
+                    std::atomic<std::uint64_t> key{0U};
+                    std::atomic<Logger *> logger{nullptr};
+                };
+
+                struct Chunk
+                {
+                    typename std::aligned_storage<sizeof(Logger), alignof(Logger)>::type storage[kChunkSize];
+                };
+
+                LoggerRegistry();
+
+                static std::size_t Hash(std::uint32_t key) noexcept;
+                Logger* FindLocked(std::uint32_t key) const noexcept;
+
+                std::unique_ptr<Slot[]> const slots_;
+                std::atomic<std::size_t> used_;
+
+                mutable std::mutex mutex_;
+                std::vector<std::unique_ptr<Chunk>> chunks_;
+                std::size_t count_;
+            };
+        } // namespace internal
+    } // namespace log
+
+} // namespace ara
+
+
+#endif // ARA_LOG_LOGGER_REGISTRY_H_
@@ -0,0 +1,31 @@
+/**
+ * \file logging.cpp
+ * \author Vincent WANG (you@domain.com)
+ * \brief
+ * \version 0.1
+ * \date 2020-12-08
+ *
+ * \copyright Copyright (c) 2020
+ *
+ */
+#include "ara/log/logging.h"
+
+#include "dlt_remote_sink.h"
+#include "logger_registry.h"
+
+namespace ara
+{
+    namespace log
+    {
+        Logger& CreateLogger(ara::core::StringView ctxId, ara::core::StringView ctxDescription, LogLevel ctxDefLogLevel) noexcept
+        {
+            return internal::LoggerRegistry::Instance().GetOrCreate(ctxId, ctxDescription, ctxDefLogLevel);
+        }
+
+        ClientState remoteClientState() noexcept
+        {
+            return internal::RemoteClientState();
+        }
+    } // namespace log
+
+} // namespace ara
@@ -0,0 +1,119 @@
+/**
+ * \file logstream.cpp
+ * \author Vincent WANG (you@domain.com)
+ * \brief
+ * \version 0.1
+ * \date 2020-12-08
+ *
+ * \copyright Copyright (c) 2020
+ *
+ */
+#include "ara/log/logstream.h"
+
+#include <algorithm>
+#include <chrono>
+#include "ara/log/logger.h"
+#include "ara/log/rate_limit.h"
+#include "log_manager.h"
+#include "schema_registry.h"
+
+namespace ara
+{
+    namespace log
+    {
+        LogStream::LogStream(LogStream &&other) noexcept
+            : logger_(other.logger_), site_(other.site_), level_(other.level_), argCount_(other.argCount_), size_(other.size_),
+              fieldCount_(other.fieldCount_), hasSchema_(other.hasSchema_)
+        {
+            std::memcpy(Payload(), other.Payload(), size_);
+            std::copy(other.fields_, other.fields_ + fieldCount_, fields_);
+            other.logger_ = nullptr;
+            other.size_ = 0U;
+            other.argCount_ = 0U;
+            other.fieldCount_ = 0U;
+            other.hasSchema_ = false;
+        }
+
+        void LogStream::Flush() noexcept
+        {
+            if (logger_ == nullptr)
+            {
+                return;
+            }
+
+            if (hasSchema_)
+            {
+                std::uint32_t const id = internal::SchemaRegistry::Instance().Intern(fields_, fieldCount_);
+                std::memcpy(Payload() + 1, &id, sizeof(id));
+            }
+
+            if ((site_ != nullptr) && site_->IsRepeat(internal::PayloadHash(Payload(), size_)))
+            {
+                Reset();
+                return;
+            }
+
+            internal::RecordHeader header;
+            header.timestamp = static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                std::chrono::steady_clock::now().time_since_epoch()).count());
+            std::memcpy(header.ctxId, logger_->ContextId(), sizeof(header.ctxId));
+            header.payloadSize = size_;
+            header.level = level_;
+            header.argCount = argCount_;
+            std::memcpy(record_, &header, sizeof(header));
+
+            (void)internal::LogManager::Instance().Submit(*logger_, record_, sizeof(header) + size_);
+            Reset();
+        }
+
+        void LogStream::Reset() noexcept
+        {
+            size_ = 0U;
+            argCount_ = 0U;
+            fieldCount_ = 0U;
+            hasSchema_ = false;
+        }
+
+        bool LogStream::ReserveSchema() noexcept
+        {
+            // the schema ID goes in front of all arguments, it is filled in by Flush()
+            std::size_t const size = 1U + sizeof(std::uint32_t);
+            if ((size_ + size) > internal::kMaxPayloadSize)
+            {
+                return false;
+            }
+
+            std::uint32_t const unknown = 0U;
+            std::memmove(Payload() + size, Payload(), size_);
+            Payload()[0] = static_cast<std::uint8_t>(internal::ArgType::kSchema);
+            std::memcpy(Payload() + 1, &unknown, sizeof(unknown));
+            size_ = static_cast<std::uint16_t>(size_ + size);
+            hasSchema_ = true;
+            return true;
+        }
+
+        void LogStream::AppendBytes(internal::ArgType type, const void *data, std::size_t size) noexcept
+        {
+            std::size_t const overhead = 1U + sizeof(std::uint16_t);
+            if ((size_ + overhead) > internal::kMaxPayloadSize)
+            {
+                return;
+            }
+
+            std::size_t const room = internal::kMaxPayloadSize - size_ - overhead;
+            std::uint16_t const length = static_cast<std::uint16_t>((size < room) ? size : room);
+            std::uint8_t *dst = Payload() + size_;
+            dst[0] = static_cast<std::uint8_t>(type);
+            std::memcpy(dst + 1, &length, sizeof(length));
+            std::memcpy(dst + overhead, data, length);
+            size_ = static_cast<std::uint16_t>(size_ + overhead + length);
+            ++argCount_;
+        }
+
+        LogStream& operator<<(LogStream &out, LogLevel value) noexcept
+        {
+            return out.PutScalar(internal::ArgType::kLogLevel, static_cast<std::uint8_t>(value));
+        }
+    } // namespace log
+
+} // namespace ara
@@ -0,0 +1,83 @@
+/**
+ * \file rate_limit.cpp
+ * \author Vincent WANG (you@domain.com)
+ * \brief
+ * \version 0.1
+ * \date 2020-12-08
+ *
+ * \copyright Copyright (c) 2020
+ *
+ */
+#include "ara/log/rate_limit.h"
+
+#include <algorithm>
+
+namespace ara
+{
+    namespace log
+    {
+        namespace internal
+        {
+            namespace
+            {
+                constexpr std::uint64_t kNanosecondsPerSecond = 1000000000U;
+                constexpr std::uint64_t kReportPeriod = kNanosecondsPerSecond;
+
+                std::atomic<CallSite *> callSites{nullptr};
+            } // namespace
+
+            CallSite::CallSite(std::uint32_t key, std::uint32_t rate, std::uint32_t burst) noexcept
+                : key_(key), rate_(rate), burst_(burst), tokens_(burst), lastHash_(0U), repeated_(0U),
+                  logger_(nullptr), level_(LogLevel::kOff), lastRefill_(0U), lastReport_(0U), credit_(0U),
+                  pending_(0U), next_(callSites.load(std::memory_order_relaxed))
+            {
+                while (!callSites.compare_exchange_weak(next_, this, std::memory_order_release, std::memory_order_relaxed))
+                {
+                }
+            }
+
+            CallSite* CallSite::First() noexcept
+            {
+                return callSites.load(std::memory_order_acquire);
+            }
+
+            std::uint64_t CallSite::Refill(std::uint64_t now) noexcept
+            {
+                std::uint64_t const maxCredit = static_cast<std::uint64_t>(burst_) * kNanosecondsPerSecond;
+                if (lastRefill_ == 0U)
+                {
+                    lastReport_ = now;
+                }
+                else
+                {
+                    credit_ = std::min(credit_ + ((now - lastRefill_) * rate_), maxCredit);
+                }
+                lastRefill_ = now;
+
+                // tokens below zero are messages throttled since the last refill
+                std::int64_t const tokens = tokens_.load(std::memory_order_relaxed);
+                std::int64_t const throttled = (tokens < 0) ? -tokens : 0;
+                std::int64_t const available = (tokens < 0) ? 0 : tokens;
+                std::int64_t const grant = std::min(static_cast<std::int64_t>(credit_ / kNanosecondsPerSecond),
+                                                    std::max<std::int64_t>(burst_ - available, 0));
+                credit_ = ((available + grant) >= burst_) ? 0U : (credit_ - (static_cast<std::uint64_t>(grant) * kNanosecondsPerSecond));
+                if ((throttled + grant) != 0)
+                {
+                    tokens_.fetch_add(throttled + grant, std::memory_order_relaxed);
+                }
+
+                pending_ += static_cast<std::uint64_t>(throttled) + repeated_.exchange(0U, std::memory_order_relaxed);
+                if ((pending_ == 0U) || ((now - lastReport_) < kReportPeriod))
+                {
+                    return 0U;
+                }
+
+                std::uint64_t const suppressed = pending_;
+                pending_ = 0U;
+                lastReport_ = now;
+                return suppressed;
+            }
+        } // namespace internal
+    } // namespace log
+
+} // namespace ara
@@ -0,0 +1,248 @@
+/**
+ * \file schema_registry.cpp
+ * \author Vincent WANG (you@domain.com)
+ * \brief
+ * \version 0.1
+ * \date 2020-12-08
+ *
+ * \copyright Copyright (c) 2020
+ *
+ */
+#include "schema_registry.h"
+
+#include <cstring>
+#include <new>
+#include "ara/core/abort.h"
+
+namespace ara
+{
+    namespace log
+    {
+        namespace internal
+        {
+            namespace
+            {
+                constexpr std::size_t kMaxNameLength = 255U;
+
+                std::uint64_t FieldsHash(FieldRef const *fields, std::size_t count) noexcept
+                {
+                    std::uint64_t hash = 14695981039346656037ULL;
+                    for (std::size_t i = 0U; i < count; ++i)
+                    {
+                        std::uint64_t const words[] = {static_cast<std::uint64_t>(reinterpret_cast<std::uintptr_t>(fields[i].name)),
+                                                       (static_cast<std::uint64_t>(fields[i].argIndex) << 8U)
+                                                           | static_cast<std::uint64_t>(fields[i].type)};
+                        for (std::uint64_t word : words)
+                        {
+                            hash = (hash ^ word) * 1099511628211ULL;
+                        }
+                    }
+                    // 0 marks an empty slot
+                    return (hash == 0U) ? 1U : hash;
+                }
+
+                bool SameFields(Schema const &schema, std::vector<SchemaField> const &fields) noexcept
+                {
+                    if (schema.fields.size() != fields.size())
+                    {
+                        return false;
+                    }
+                    for (std::size_t i = 0U; i < fields.size(); ++i)
+                    {
+                        if ((schema.fields[i].argIndex != fields[i].argIndex) || (schema.fields[i].type != fields[i].type)
+                            || (schema.fields[i].name != fields[i].name))
+                        {
+                            return false;
+                        }
+                    }
+                    return true;
+                }
+            } // namespace
+
+            SchemaField const* Schema::Field(std::uint8_t argIndex) const noexcept
+            {
+                for (SchemaField const &field : fields)
+                {
+                    if (field.argIndex == argIndex)
+                    {
+                        return &field;
+                    }
+                }
+                return nullptr;
+            }
+
+            SchemaRegistry& SchemaRegistry::Instance()
+            {
+                // never destroyed, the logging thread still resolves records while static objects are destroyed
+                static SchemaRegistry *const instance = new SchemaRegistry();
+                return *instance;
+            }
+
+            SchemaRegistry::SchemaRegistry()
+                : slots_(new Slot[kSlots]), schemas_(new std::atomic<Schema const *>[kMaxSchemas]), nextId_(1U), indexed_(0U)
+            {
+                for (std::size_t i = 0U; i < kMaxSchemas; ++i)
+                {
+                    schemas_[i].store(nullptr, std::memory_order_relaxed);
+                }
+            }
+
+            SchemaRegistry::~SchemaRegistry() = default;
+
+            std::uint32_t SchemaRegistry::Intern(FieldRef const *fields, std::size_t count) noexcept
+            {
+                std::uint64_t const hash = FieldsHash(fields, count);
+                for (std::size_t i = hash & (kSlots - 1U), probes = 0U; probes < kSlots; i = (i + 1U) & (kSlots - 1U), ++probes)
+                {
+                    std::uint64_t const slotHash = slots_[i].hash.load(std::memory_order_acquire);
+                    if (slotHash == hash)
+                    {
+                        return slots_[i].id.load(std::memory_order_relaxed);
+                    }
+                    if (slotHash == 0U)
+                    {
+                        break;
+                    }
+                }
+
+                ARA_CORE_TRY
+                {
+                    return Register(hash, fields, count);
+                }
+                ARA_CORE_CATCH(std::bad_alloc const &)
+                {
+                    return 0U;
+                }
+            }
+
+            std::uint32_t SchemaRegistry::Register(std::uint64_t hash, FieldRef const *fields, std::size_t count)
+            {
+                std::vector<SchemaField> candidate;
+                candidate.reserve(count);
+                for (std::size_t i = 0U; i < count; ++i)
+                {
+                    std::size_t const length = ::strnlen(fields[i].name, kMaxNameLength);
+                    candidate.push_back(SchemaField{fields[i].argIndex, fields[i].type, std::string(fields[i].name, length)});
+                }
+
+                std::lock_guard<std::mutex> lock(mutex_);
+
+                // the same names at another address, e.g. a string literal of another translation unit
+                std::uint32_t id = 0U;
+                for (auto const &schema : owned_)
+                {
+                    if (SameFields(*schema, candidate))
+                    {
+                        id = schema->id;
+                        break;
+                    }
+                }
+
+                if (id == 0U)
+                {
+                    if (nextId_ >= kMaxSchemas)
+                    {
+                        return 0U;
+                    }
+                    id = nextId_++;
+                    std::unique_ptr<Schema> schema(new Schema{id, std::move(candidate)});
+                    Publish(std::move(schema));
+                }
+
+                // keep a quarter of the slots free so that probe sequences stay short and end on an empty slot
+                if (indexed_ < ((kSlots * 3U) / 4U))
+                {
+                    std::size_t i = hash & (kSlots - 1U);
+                    for (; slots_[i].hash.load(std::memory_order_relaxed) != 0U; i = (i + 1U) & (kSlots - 1U))
+                    {
+                        if (slots_[i].hash.load(std::memory_order_relaxed) == hash)
+                        {
+                            return id;
+                        }
+                    }
+                    slots_[i].id.store(id, std::memory_order_relaxed);
+                    slots_[i].hash.store(hash, std::memory_order_release);
+                    ++indexed_;
+                }
+                return id;
+            }
+
+            void SchemaRegistry::Publish(std::unique_ptr<Schema> schema)
+            {
+                Schema const *published = schema.get();
+                owned_.push_back(std::move(schema));
+                schemas_[published->id].store(published, std::memory_order_release);
+            }
+
+            Schema const* SchemaRegistry::Find(std::uint32_t id) const noexcept
+            {
+                return (id < kMaxSchemas) ? schemas_[id].load(std::memory_order_acquire) : nullptr;
+            }
+
+            bool SchemaRegistry::Define(std::uint8_t const *payload, std::size_t size)
+            {
+                std::size_t const header = 1U + sizeof(std::uint32_t) + 1U;
+                if ((size < header) || (static_cast<ArgType>(payload[0]) != ArgType::kSchemaDefinition))
+                {
+                    return false;
+                }
+
+                std::unique_ptr<Schema> schema(new Schema);
+                std::memcpy(&schema->id, payload + 1, sizeof(schema->id));
+                std::size_t const count = payload[1U + sizeof(std::uint32_t)];
+                if ((schema->id == 0U) || (schema->id >= kMaxSchemas))
+                {
+                    return false;
+                }
+
+                std::size_t offset = header;
+                for (std::size_t i = 0U; i < count; ++i)
+                {
+                    if ((size - offset) < 3U)
+                    {
+                        return false;
+                    }
+                    std::size_t const length = payload[offset + 2U];
+                    if ((size - offset - 3U) < length)
+                    {
+                        return false;
+                    }
+                    schema->fields.push_back(SchemaField{payload[offset], static_cast<ArgType>(payload[offset + 1U]),
+                                                         std::string(reinterpret_cast<char const *>(payload + offset + 3U), length)});
+                    offset += 3U + length;
+                }
+
+                Publish(std::move(schema));
+                return true;
+            }
+
+            std::size_t SchemaRegistry::EncodeDefinition(Schema const &schema, std::uint8_t *out, std::size_t capacity) noexcept
+            {
+                std::size_t size = 1U + sizeof(schema.id) + 1U;
+                for (SchemaField const &field : schema.fields)
+                {
+                    size += 3U + field.name.size();
+                }
+                if (size > capacity)
+                {
+                    return 0U;
+                }
+
+                out[0] = static_cast<std::uint8_t>(ArgType::kSchemaDefinition);
+                std::memcpy(out + 1, &schema.id, sizeof(schema.id));
+                out[1U + sizeof(schema.id)] = static_cast<std::uint8_t>(schema.fields.size());
+                std::size_t offset = 1U + sizeof(schema.id) + 1U;
+                for (SchemaField const &field : schema.fields)
+                {
+                    out[offset] = field.argIndex;
+                    out[offset + 1U] = static_cast<std::uint8_t>(field.type);
+                    out[offset + 2U] = static_cast<std::uint8_t>(field.name.size());
+                    std::memcpy(out + offset + 3U, field.name.data(), field.name.size());
+                    offset += 3U + field.name.size();
+                }
+                return size;
+            }
+        } // namespace internal
+    } // namespace log
+
+} // namespace ara
@@ -0,0 +1,149 @@
+/**
+ * \file schema_registry.h
+ * \author Vincent WANG (you@domain.com)
+ * \brief Field name schemas of structured log records.
+ * \version 0.1
+ * \date 2020-12-08
+ *
+ * \copyright Copyright (c) 2020
+ *
+ */
+#ifndef ARA_LOG_SCHEMA_REGISTRY_H_
+#define ARA_LOG_SCHEMA_REGISTRY_H_
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+#include "ara/log/log_record.h"
+
+namespace ara
+{
+    namespace log
+    {
+        namespace internal
+        {
+            /**
+             * \brief Name and type of one named argument.
+             *
+             */
+            struct SchemaField
+            {
+                std::uint8_t argIndex;
+                ArgType type;
+                std::string name;
+            };
+
+            /**
+             * \brief The named arguments of the records of one logging statement.
+             *
+             */
+            struct Schema
+            {
+                std::uint32_t id;
+                std::vector<SchemaField> fields;
+
+                /**
+                 * \brief Return the field of an argument.
+                 *
+                 * \param[in] argIndex  the index of the argument in the record
+                 * \return SchemaField const*   the field, or nullptr if the argument has no name
+                 */
+                SchemaField const* Field(std::uint8_t argIndex) const noexcept;
+            };
+
+            /**
+             * \brief Assigns IDs to schemas and resolves them.
+             *
+             * Inside the process, records reference their schema by Intern(). The lookup of an already known
+             * schema is lock-free: it is keyed by a hash of the name pointers and types, which is why field names
+             * must have static storage duration. Schemas are immutable and never freed once published.
+             *
+             * The offline decoder fills its own instance from the kSchemaDefinition records of a binary log.
+             */
+            class SchemaRegistry final
+            {
+            public:
+                static constexpr std::size_t kMaxSchemas = 1024U;   /*< schema IDs are below this limit */
+                static constexpr std::size_t kMaxDefinitionSize = 1U + sizeof(std::uint32_t) + 1U + (kMaxFields * (3U + 255U));
+
+                /**
+                 * \brief Return the registry of this process.
+                 *
+                 * \return SchemaRegistry&  the instance
+                 */
+                static SchemaRegistry& Instance();
+
+                SchemaRegistry();
+                ~SchemaRegistry();
+
+                SchemaRegistry(SchemaRegistry const &) = delete;
+                SchemaRegistry& operator=(SchemaRegistry const &) = delete;
+
+                /**
+                 * \brief Return the ID of the schema made of the given fields, registering it on first use.
+                 *
+                 * \param[in] fields    the named arguments of a record
+                 * \param[in] count     the number of fields
+                 * \return std::uint32_t    the schema ID, or 0 if the registry is full
+                 */
+                std::uint32_t Intern(FieldRef const *fields, std::size_t count) noexcept;
+
+                /**
+                 * \brief Return a schema by its ID.
+                 *
+                 * \param[in] id        the schema ID
+                 * \return Schema const*    the schema, or nullptr if the ID is unknown
+                 */
+                Schema const* Find(std::uint32_t id) const noexcept;
+
+                /**
+                 * \brief Register a schema read from a binary log. Not thread-safe, for the offline decoder.
+                 *
+                 * \param[in] payload   the payload of a kSchemaDefinition record
+                 * \param[in] size      the payload size
+                 * \return true         if the definition was valid
+                 * \return false        otherwise
+                 */
+                bool Define(std::uint8_t const *payload, std::size_t size);
+
+                /**
+                 * \brief Encode the kSchemaDefinition payload of a schema.
+                 *
+                 * \param[in] schema    the schema
+                 * \param[out] out      the destination buffer
+                 * \param[in] capacity  the size of the destination buffer
+                 * \return std::size_t  the payload size, or 0 if it does not fit
+                 */
+                static std::size_t EncodeDefinition(Schema const &schema, std::uint8_t *out, std::size_t capacity) noexcept;
+
+            private:
+                static constexpr std::size_t kSlots = 2048U;    // power of two
+
+                struct Slot
+                {
+                    std::atomic<std::uint64_t> hash{0U};
+                    std::atomic<std::uint32_t> id{0U};
+                };
+
+                std::uint32_t Register(std::uint64_t hash, FieldRef const *fields, std::size_t count);
+                void Publish(std::unique_ptr<Schema> schema);
+
+                std::unique_ptr<Slot[]> const slots_;
+                std::unique_ptr<std::atomic<Schema const *>[]> const schemas_;
+
+                std::mutex mutex_;
+                std::vector<std::unique_ptr<Schema>> owned_;
+                std::uint32_t nextId_;
+                std::size_t indexed_;
+            };
+        } // namespace internal
+    } // namespace log
+
+} // namespace ara
+
+
+#endif // ARA_LOG_SCHEMA_REGISTRY_H_
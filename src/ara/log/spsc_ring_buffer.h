@@ -0,0 +1,318 @@
+/**
+ * \file spsc_ring_buffer.h
+ * \author Vincent WANG (you@domain.com)
+ * \brief Lock-free single producer / single consumer ring buffer for variable sized records.
+ * \version 0.1
+ * \date 2020-12-08
+ *
+ * \copyright Copyright (c) 2020
+ *
+ */
+#ifndef ARA_LOG_SPSC_RING_BUFFER_H_
+#define ARA_LOG_SPSC_RING_BUFFER_H_
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+
+namespace ara
+{
+    namespace log
+    {
+        namespace internal
+        {
+            /**
+             * \brief Byte ring buffer carrying length-prefixed records from exactly one producer thread to
+             * exactly one consumer thread.
+             *
+             * Every record occupies a slot of an 8 byte length prefix followed by the record bytes, rounded up
+             * to 8 bytes. A record never wraps around the end of the storage; if it does not fit into the
+             * remaining tail, a padding slot is written and the record starts at offset 0.
+             *
+             * Head and tail are free running counters on separate cache lines. Each side keeps a cached copy of
+             * the other side's counter and only reloads it when the cached value says the buffer is full/empty.
+             *
+             * Besides the consumer, the producer may advance the head to discard the oldest records when the
+             * buffer is full. Both sides therefore claim records by advancing the head with a compare-and-swap.
+             * Before the consumer touches the slot at the head, it publishes the slot's position in reading_
+             * and checks that the head has not moved meanwhile; the producer never writes at or beyond a
+             * published position, so the consumer can copy the record out, claim it and release the position
+             * again. If the claim fails, the producer discarded the record and the copy is thrown away. While
+             * a position is published, DiscardOldest() refuses, as discarding would not free any space.
+             */
+            class SpscRingBuffer final
+            {
+            public:
+                /**
+                 * \brief Construct a new ring buffer.
+                 *
+                 * \param[in] capacity  storage size in bytes, rounded up to the next power of two
+                 * \param[in] maxRecordSize     size of the largest record accepted by TryWrite()
+                 */
+                SpscRingBuffer(std::size_t capacity, std::size_t maxRecordSize)
+                    : capacity_(RoundUpPowerOfTwo(capacity)),
+                      mask_(capacity_ - 1U),
+                      maxRecordSize_(maxRecordSize),
+                      storage_(new std::uint8_t[capacity_]),
+                      scratch_(new std::uint8_t[maxRecordSize_])
+                {
+                }
+
+                SpscRingBuffer(SpscRingBuffer const &) = delete;
+                SpscRingBuffer& operator=(SpscRingBuffer const &) = delete;
+
+                /**
+                 * \brief Append one record. Producer side only.
+                 *
+                 * \param[in] data  the record bytes
+                 * \param[in] size  the number of record bytes
+                 * \return true     if the record was stored
+                 * \return false    if there is not enough free space or the record is larger than maxRecordSize
+                 */
+                bool TryWrite(void const *data, std::size_t size) noexcept
+                {
+                    if (size > maxRecordSize_)
+                    {
+                        return false;
+                    }
+
+                    std::size_t const slot = SlotSize(size);
+                    std::size_t tail = tail_.load(std::memory_order_relaxed);
+                    std::size_t const offset = tail & mask_;
+                    std::size_t const contiguous = capacity_ - offset;
+                    std::size_t const padding = (slot > contiguous) ? contiguous : 0U;
+
+                    if ((slot + padding) > capacity_)
+                    {
+                        return false;
+                    }
+
+                    if ((tail + padding + slot - cachedHead_) > capacity_)
+                    {
+                        cachedHead_ = ReuseLimit();
+                        if ((tail + padding + slot - cachedHead_) > capacity_)
+                        {
+                            return false;
+                        }
+                    }
+
+                    if (padding != 0U)
+                    {
+                        StorePrefix(offset, kPaddingFlag);
+                        tail += padding;
+                    }
+
+                    std::size_t const start = tail & mask_;
+                    StorePrefix(start, static_cast<std::uint32_t>(size));
+                    std::memcpy(storage_.get() + start + kPrefixSize, data, size);
+                    tail_.store(tail + slot, std::memory_order_release);
+                    return true;
+                }
+
+                /**
+                 * \brief Hand all currently available records to a consumer. Consumer side only.
+                 *
+                 * The record memory is only valid during the call of the consumer.
+                 *
+                 * \tparam Consumer     callable with the signature void(std::uint8_t const*, std::size_t)
+                 * \param[in] consumer  the callable receiving each record
+                 * \return std::size_t  the number of consumed records
+                 */
+                template <typename Consumer>
+                std::size_t Read(Consumer &&consumer)
+                {
+                    std::size_t head = head_.load(std::memory_order_acquire);
+                    std::size_t count = 0U;
+
+                    for (;;)
+                    {
+                        if (static_cast<std::ptrdiff_t>(cachedTail_ - head) <= 0)
+                        {
+                            cachedTail_ = tail_.load(std::memory_order_acquire);
+                            if (static_cast<std::ptrdiff_t>(cachedTail_ - head) <= 0)
+                            {
+                                break;
+                            }
+                        }
+
+                        // keep the producer off the slot, unless it already discarded the slot before it saw that
+                        reading_.store(head, std::memory_order_seq_cst);
+                        std::size_t const current = head_.load(std::memory_order_seq_cst);
+                        if (current != head)
+                        {
+                            reading_.store(kIdle, std::memory_order_release);
+                            head = current;
+                            continue;
+                        }
+
+                        std::size_t const offset = head & mask_;
+                        std::uint32_t const prefix = LoadPrefix(offset);
+                        std::size_t next;
+                        bool isRecord = false;
+                        if ((prefix & kPaddingFlag) != 0U)
+                        {
+                            next = head + (capacity_ - offset);
+                        }
+                        else
+                        {
+                            std::memcpy(scratch_.get(), storage_.get() + offset + kPrefixSize, prefix);
+                            next = head + SlotSize(prefix);
+                            isRecord = true;
+                        }
+
+                        // on failure head is updated to the position after the discarded records
+                        bool const claimed = head_.compare_exchange_strong(head, next, std::memory_order_seq_cst);
+                        reading_.store(kIdle, std::memory_order_release);
+                        if (claimed)
+                        {
+                            if (isRecord)
+                            {
+                                consumer(scratch_.get(), static_cast<std::size_t>(prefix));
+                                ++count;
+                            }
+                            head = next;
+                        }
+                    }
+                    return count;
+                }
+
+                /**
+                 * \brief Discard the oldest record to make room for a new one. Producer side only.
+                 *
+                 * \tparam Predicate    callable with the signature bool(std::uint8_t const*, std::size_t), deciding
+                 *                      whether the oldest record may be discarded
+                 * \tparam Visitor      callable with the signature void(std::uint8_t const*, std::size_t), called
+                 *                      with the discarded record
+                 * \param[in] mayDiscard    the predicate
+                 * \param[in] onDiscard     the visitor
+                 * \return true         if a record was discarded
+                 * \return false        if the buffer is empty, the consumer is copying out the oldest record or
+                 *                      the predicate refused the oldest record
+                 */
+                template <typename Predicate, typename Visitor>
+                bool DiscardOldest(Predicate &&mayDiscard, Visitor &&onDiscard) noexcept
+                {
+                    if (reading_.load(std::memory_order_seq_cst) != kIdle)
+                    {
+                        return false;
+                    }
+
+                    std::size_t const tail = tail_.load(std::memory_order_relaxed);
+                    std::size_t head = head_.load(std::memory_order_acquire);
+
+                    while (head != tail)
+                    {
+                        // only the producer writes the storage, so the slot at head is stable here
+                        std::size_t const offset = head & mask_;
+                        std::uint32_t const prefix = LoadPrefix(offset);
+                        if ((prefix & kPaddingFlag) != 0U)
+                        {
+                            std::size_t const next = head + (capacity_ - offset);
+                            if (head_.compare_exchange_strong(head, next, std::memory_order_seq_cst))
+                            {
+                                head = next;
+                            }
+                            continue;
+                        }
+
+                        std::uint8_t const *record = storage_.get() + offset + kPrefixSize;
+                        if (!mayDiscard(record, static_cast<std::size_t>(prefix)))
+                        {
+                            return false;
+                        }
+
+                        std::size_t const next = head + SlotSize(prefix);
+                        // the space is only reused once TryWrite() has checked reading_ again
+                        if (head_.compare_exchange_strong(head, next, std::memory_order_seq_cst))
+                        {
+                            onDiscard(record, static_cast<std::size_t>(prefix));
+                            return true;
+                        }
+                    }
+                    return false;
+                }
+
+                /**
+                 * \brief Check whether the buffer holds no record. Safe to call from both sides.
+                 *
+                 * \return true     if no record is pending
+                 * \return false    otherwise
+                 */
+                bool Empty() const noexcept
+                {
+                    return head_.load(std::memory_order_acquire) == tail_.load(std::memory_order_acquire);
+                }
+
+                /**
+                 * \brief Return the storage size in bytes.
+                 *
+                 * \return std::size_t  the capacity
+                 */
+                std::size_t Capacity() const noexcept
+                {
+                    return capacity_;
+                }
+
+            private:
+                static constexpr std::size_t kPrefixSize = 8U;
+                static constexpr std::uint32_t kPaddingFlag = 0x80000000U;
+                static constexpr std::size_t kCacheLine = 64U;
+                static constexpr std::size_t kIdle = ~static_cast<std::size_t>(0U);   // no slot published in reading_
+
+                static std::size_t RoundUpPowerOfTwo(std::size_t value) noexcept
+                {
+                    std::size_t result = kCacheLine;
+                    while (result < value)
+                    {
+                        result <<= 1U;
+                    }
+                    return result;
+                }
+
+                static std::size_t SlotSize(std::size_t size) noexcept
+                {
+                    return (kPrefixSize + size + (kPrefixSize - 1U)) & ~(kPrefixSize - 1U);
+                }
+
+                void StorePrefix(std::size_t offset, std::uint32_t prefix) noexcept
+                {
+                    std::memcpy(storage_.get() + offset, &prefix, sizeof(prefix));
+                }
+
+                // oldest position the producer must not overwrite: the head, or the slot the consumer copies out
+                std::size_t ReuseLimit() const noexcept
+                {
+                    std::size_t const head = head_.load(std::memory_order_seq_cst);
+                    std::size_t const reading = reading_.load(std::memory_order_seq_cst);
+                    return ((reading != kIdle) && (static_cast<std::ptrdiff_t>(reading - head) < 0)) ? reading : head;
+                }
+
+                std::uint32_t LoadPrefix(std::size_t offset) const noexcept
+                {
+                    std::uint32_t prefix;
+                    std::memcpy(&prefix, storage_.get() + offset, sizeof(prefix));
+                    return prefix;
+                }
+
+                std::size_t const capacity_;
+                std::size_t const mask_;
+                std::size_t const maxRecordSize_;
+                std::unique_ptr<std::uint8_t[]> const storage_;
+                std::unique_ptr<std::uint8_t[]> const scratch_;   /*< consumer copy of the record being claimed */
+
+                alignas(kCacheLine) std::atomic<std::size_t> head_{0U};
+                std::atomic<std::size_t> reading_{kIdle};    /*< slot the consumer is copying out, or kIdle */
+                std::size_t cachedTail_{0U};
+
+                alignas(kCacheLine) std::atomic<std::size_t> tail_{0U};
+                std::size_t cachedHead_{0U};
+            };
+        } // namespace internal
+    } // namespace log
+
+} // namespace ara
+
+
+#endif // ARA_LOG_SPSC_RING_BUFFER_H_
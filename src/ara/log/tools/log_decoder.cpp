@@ -0,0 +1,106 @@
+/**
+ * \file log_decoder.cpp
+ * \author Vincent WANG (you@domain.com)
+ * \brief Offline decoder turning a binary log into text.
+ * \version 0.1
+ * \date 2020-12-08
+ *
+ * \copyright Copyright (c) 2020
+ *
+ * Usage: log_decoder [-a APID] [FILE]...
+ *
+ * Reads binary logs (a concatenation of RecordHeader + payload) from the given files, or from stdin if no file
+ * is given, and writes one text line per record to stdout. A zeroed record header, as found in the unused tail of
+ * a file sink segment, ends the data of a file. ErrorCode arguments are resolved through their
+ * domain ID since the recorded ErrorDomain addresses are meaningless outside of the producing process. Field names
+ * of structured arguments are taken from the schema definition records preceding their first use in each file.
+ */
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include "ara/log/log_record.h"
+#include "../log_formatter.h"
+#include "../schema_registry.h"
+
+namespace
+{
+    using ara::log::internal::RecordHeader;
+
+    bool DecodeStream(std::FILE *in, char const *appId, char const *name, ara::log::internal::SchemaRegistry &schemas)
+    {
+        // schema definitions may exceed kMaxPayloadSize
+        static std::uint8_t payload[UINT16_MAX];
+        char line[4096];
+        RecordHeader header;
+
+        static RecordHeader const kEnd{};
+
+        while (std::fread(&header, sizeof(header), 1U, in) == 1U)
+        {
+            if (std::memcmp(&header, &kEnd, sizeof(header)) == 0)
+            {
+                break;
+            }
+
+            if (std::fread(payload, 1U, header.payloadSize, in) != header.payloadSize)
+            {
+                std::fprintf(stderr, "%s: truncated or corrupt record\n", name);
+                return false;
+            }
+
+            if ((header.payloadSize != 0U)
+                && (static_cast<ara::log::internal::ArgType>(payload[0]) == ara::log::internal::ArgType::kSchemaDefinition))
+            {
+                if (!schemas.Define(payload, header.payloadSize))
+                {
+                    std::fprintf(stderr, "%s: invalid schema definition\n", name);
+                }
+                continue;
+            }
+
+            std::size_t const n = ara::log::internal::FormatRecord(appId, header, payload, line, sizeof(line),
+                                                                   ara::log::internal::DomainResolution::kOffline, &schemas);
+            (void)std::fwrite(line, 1U, n, stdout);
+        }
+        return true;
+    }
+} // namespace
+
+int main(int argc, char *argv[])
+{
+    char appId[4] = {'-', '-', '-', '-'};
+    int first = 1;
+    ara::log::internal::SchemaRegistry schemas;
+
+    if ((argc > 2) && (std::strcmp(argv[1], "-a") == 0))
+    {
+        std::memset(appId, 0, sizeof(appId));
+        // a DLT ID is 4 characters without terminator
+        std::memcpy(appId, argv[2], std::min(std::strlen(argv[2]), sizeof(appId)));
+        first = 3;
+    }
+
+    if (first == argc)
+    {
+        return DecodeStream(stdin, appId, "<stdin>", schemas) ? 0 : 1;
+    }
+
+    int status = 0;
+    for (int i = first; i < argc; ++i)
+    {
+        std::FILE *in = std::fopen(argv[i], "rb");
+        if (in == nullptr)
+        {
+            std::perror(argv[i]);
+            status = 1;
+            continue;
+        }
+        if (!DecodeStream(in, appId, argv[i], schemas))
+        {
+            status = 1;
+        }
+        (void)std::fclose(in);
+    }
+    return status;
+}
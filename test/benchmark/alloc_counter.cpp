@@ -0,0 +1,70 @@
+/**
+ * \file alloc_counter.cpp
+ * \author Vincent WANG (vin@misday.com)
+ * \brief Replacement of the global operator new that counts the heap allocations of a benchmark.
+ * \version 0.1
+ * \date 2021-11-12
+ *
+ * \copyright Copyright (c) 2021
+ *
+ */
+#include <atomic>
+#include <cstdlib>
+#include <new>
+#include "bench_util.h"
+
+namespace
+{
+    std::atomic<std::uint64_t> allocations{0U};
+} // namespace
+
+void* operator new(std::size_t size)
+{
+    allocations.fetch_add(1U, std::memory_order_relaxed);
+    void *const p = std::malloc((size != 0U) ? size : 1U);
+    if (p == nullptr)
+    {
+#if ARA_CORE_EXCEPTIONS
+        throw std::bad_alloc();
+#else
+        std::abort();
+#endif
+    }
+    return p;
+}
+
+void* operator new[](std::size_t size)
+{
+    return operator new(size);
+}
+
+void operator delete(void *p) noexcept
+{
+    std::free(p);
+}
+
+void operator delete[](void *p) noexcept
+{
+    std::free(p);
+}
+
+void operator delete(void *p, std::size_t) noexcept
+{
+    std::free(p);
+}
+
+void operator delete[](void *p, std::size_t) noexcept
+{
+    std::free(p);
+}
+
+namespace ara
+{
+namespace bench
+{
+    std::uint64_t HeapAllocations() noexcept
+    {
+        return allocations.load(std::memory_order_relaxed);
+    }
+} // namespace bench
+} // namespace ara
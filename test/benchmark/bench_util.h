@@ -0,0 +1,212 @@
+/**
+ * \file bench_util.h
+ * \author Vincent WANG (vin@misday.com)
+ * \brief Helpers shared by the benchmark drivers: clocks, latency samples and command line options.
+ * \version 0.1
+ * \date 2021-11-12
+ *
+ * \copyright Copyright (c) 2021
+ *
+ */
+#ifndef ARA_BENCH_BENCH_UTIL_H_
+#define ARA_BENCH_BENCH_UTIL_H_
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+#include <dirent.h>
+#include <unistd.h>
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#include <x86intrin.h>
+#endif
+
+namespace ara
+{
+namespace bench
+{
+    /**
+     * \brief Return a monotonic time stamp in nanoseconds.
+     *
+     * \return std::uint64_t    the time stamp
+     */
+    inline std::uint64_t NowNs() noexcept
+    {
+        return static_cast<std::uint64_t>(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch())
+                .count());
+    }
+
+    /**
+     * \brief Return a cheap time stamp for short intervals: the TSC on x86-64, nanoseconds elsewhere.
+     *
+     * \return std::uint64_t    the time stamp, in the unit named by TicksUnit()
+     */
+    inline std::uint64_t Ticks() noexcept
+    {
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+        return __rdtsc();
+#else
+        return NowNs();
+#endif
+    }
+
+    /**
+     * \brief Return the unit of Ticks() for reports.
+     *
+     * \return char const*  "cycles" or "ns"
+     */
+    inline char const* TicksUnit() noexcept
+    {
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+        return "cycles";
+#else
+        return "ns";
+#endif
+    }
+
+    /**
+     * \brief Return the number of operator new calls so far. Only available to benchmarks linked with
+     * alloc_counter.cpp.
+     *
+     * \return std::uint64_t    the number of heap allocations
+     */
+    std::uint64_t HeapAllocations() noexcept;
+
+    /**
+     * \brief Keep the compiler from optimizing away the computation of value.
+     *
+     * \tparam T            the value type
+     * \param[in] value     the value
+     */
+    template <typename T>
+    inline void DoNotOptimize(T const &value) noexcept
+    {
+        asm volatile("" : : "r,m"(value) : "memory");
+    }
+
+    /**
+     * \brief Latency samples of one measurement, reported as percentiles.
+     *
+     */
+    class Samples final
+    {
+    public:
+        explicit Samples(std::size_t expected = 0U)
+        {
+            values_.reserve(expected);
+        }
+
+        void Add(std::uint64_t value)
+        {
+            values_.push_back(value);
+        }
+
+        void Append(Samples const &other)
+        {
+            values_.insert(values_.end(), other.values_.begin(), other.values_.end());
+        }
+
+        std::size_t Size() const noexcept
+        {
+            return values_.size();
+        }
+
+        /**
+         * \brief Return the value below which a fraction of the samples lies.
+         *
+         * \param[in] fraction  between 0 and 1, e.g. 0.999 for p99.9
+         * \return std::uint64_t    the percentile, 0 without samples
+         */
+        std::uint64_t Percentile(double fraction)
+        {
+            if (values_.empty())
+            {
+                return 0U;
+            }
+            auto const index = static_cast<std::size_t>(fraction * static_cast<double>(values_.size() - 1U));
+            std::nth_element(values_.begin(), values_.begin() + static_cast<std::ptrdiff_t>(index), values_.end());
+            return values_[index];
+        }
+
+    private:
+        std::vector<std::uint64_t> values_;
+    };
+
+    /**
+     * \brief Scratch directory under /tmp for the output of a benchmark, removed with its files on destruction.
+     *
+     */
+    class TempDirectory final
+    {
+    public:
+        explicit TempDirectory(char const *prefix) : path_(std::string("/tmp/") + prefix + "XXXXXX")
+        {
+            if (mkdtemp(&path_[0]) == nullptr)
+            {
+                std::perror("mkdtemp");
+                std::exit(1);
+            }
+        }
+
+        TempDirectory(TempDirectory const &) = delete;
+        TempDirectory& operator=(TempDirectory const &) = delete;
+
+        ~TempDirectory()
+        {
+            if (DIR *const dir = opendir(path_.c_str()))
+            {
+                while (dirent const *const entry = readdir(dir))
+                {
+                    if (entry->d_name[0] != '.')
+                    {
+                        unlink((path_ + "/" + entry->d_name).c_str());
+                    }
+                }
+                closedir(dir);
+            }
+            rmdir(path_.c_str());
+        }
+
+        std::string const& Path() const noexcept
+        {
+            return path_;
+        }
+
+    private:
+        std::string path_;
+    };
+
+    /**
+     * \brief Return the value of an option given as --name=value, or a default.
+     *
+     * \param[in] argc          the argument count of main()
+     * \param[in] argv          the arguments of main()
+     * \param[in] name          the option name without the leading dashes
+     * \param[in] fallback      the value if the option is absent
+     * \return std::size_t      the value
+     */
+    inline std::size_t Option(int argc, char **argv, char const *name, std::size_t fallback) noexcept
+    {
+        std::size_t const length = std::strlen(name);
+        for (int i = 1; i < argc; ++i)
+        {
+            char const *const arg = argv[i];
+            if ((std::strncmp(arg, "--", 2U) == 0) && (std::strncmp(arg + 2, name, length) == 0) &&
+                (arg[2U + length] == '='))
+            {
+                return static_cast<std::size_t>(std::strtoull(arg + 3U + length, nullptr, 10));
+            }
+        }
+        return fallback;
+    }
+} // namespace bench
+} // namespace ara
+
+#endif // ARA_BENCH_BENCH_UTIL_H_
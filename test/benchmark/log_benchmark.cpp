@@ -0,0 +1,200 @@
+/**
+ * \file log_benchmark.cpp
+ * \author Vincent WANG (you@domain.com)
+ * \brief Caller latency and throughput of Logger::LogInfo() chains, per sink and number of producer threads.
+ *
+ * For every sink (console, file, remote UDP) and 1, 2, 4 ... --threads producer threads:
+ *  - latency: every producer times each of its --iterations log lines under BackpressurePolicy::kDropNewest,
+ *    so the percentiles are the pure caller cost; lines dropped on a full buffer are counted.
+ *  - throughput: the same lines under BackpressurePolicy::kBlock, so the producers run at the pace of the
+ *    logging thread and its sink once their buffers are full.
+ *
+ * Console output goes to /dev/null while the console sink is measured. Usage:
+ *     log_benchmark [--iterations=100000] [--threads=4]
+ *
+ * \version 0.1
+ * \date 2020-12-08
+ *
+ * \copyright Copyright (c) 2020
+ *
+ */
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <thread>
+#include <vector>
+#include <arpa/inet.h>
+#include <fcntl.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#include "ara/core/core_error_domain.h"
+#include "ara/log/logging.h"
+#include "bench_util.h"
+#include "log_manager.h"
+
+using namespace ara::log;
+using ara::bench::NowNs;
+using ara::bench::Samples;
+using ara::log::internal::BackpressurePolicy;
+using ara::log::internal::LogConfig;
+using ara::log::internal::LogManager;
+
+namespace
+{
+    struct SinkCase
+    {
+        char const *name;
+        LogMode mode;
+    };
+
+    struct Run
+    {
+        Samples latency;
+        std::uint64_t lines{0U};
+        std::uint64_t elapsedNs{0U};
+        std::uint64_t dropped{0U};
+    };
+
+    // time to let the logging thread drain the buffers before the next run
+    constexpr std::chrono::milliseconds kSettle{200};
+
+    // One log line with every kind of argument the callers use.
+    inline void LogLine(Logger &logger, std::uint32_t i, std::array<std::uint8_t, 16U> const &payload,
+                        ara::core::ErrorCode const &error)
+    {
+        logger.LogInfo() << "request" << i << static_cast<std::int64_t>(-42) << 3.25F << 0.5
+                         << ara::core::StringView("vehicle.speed") << RawBuffer(payload) << error;
+    }
+
+    Run Measure(Logger &logger, std::size_t threads, std::size_t iterations, bool timeEachLine)
+    {
+        std::uint64_t const droppedBefore = LogManager::Instance().DroppedRecords();
+        std::vector<Samples> samples(threads);
+        std::vector<std::thread> producers;
+        std::uint64_t const start = NowNs();
+        for (std::size_t t = 0U; t < threads; ++t)
+        {
+            producers.emplace_back([&logger, &samples, t, iterations, timeEachLine] {
+                std::array<std::uint8_t, 16U> payload{};
+                payload.fill(static_cast<std::uint8_t>(t));
+                ara::core::ErrorCode const error(ara::core::CoreErrc::kInvalidArgument);
+                Samples &own = samples[t];
+                own = Samples(timeEachLine ? iterations : 0U);
+                for (std::size_t i = 0U; i < iterations; ++i)
+                {
+                    if (timeEachLine)
+                    {
+                        std::uint64_t const before = NowNs();
+                        LogLine(logger, static_cast<std::uint32_t>(i), payload, error);
+                        own.Add(NowNs() - before);
+                    }
+                    else
+                    {
+                        LogLine(logger, static_cast<std::uint32_t>(i), payload, error);
+                    }
+                }
+            });
+        }
+        for (auto &producer : producers)
+        {
+            producer.join();
+        }
+
+        Run run;
+        run.elapsedNs = NowNs() - start;
+        run.lines = static_cast<std::uint64_t>(threads) * iterations;
+        run.dropped = LogManager::Instance().DroppedRecords() - droppedBefore;
+        for (auto const &own : samples)
+        {
+            run.latency.Append(own);
+        }
+        std::this_thread::sleep_for(kSettle);
+        return run;
+    }
+
+    // UDP socket on a free loopback port that takes the remote sink's datagrams and never reads them.
+    int OpenReceiver(std::uint16_t &port)
+    {
+        int const fd = socket(AF_INET, SOCK_DGRAM, 0);
+        sockaddr_in address{};
+        address.sin_family = AF_INET;
+        address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+        socklen_t length = sizeof(address);
+        if ((fd < 0) || (bind(fd, reinterpret_cast<sockaddr *>(&address), sizeof(address)) != 0) ||
+            (getsockname(fd, reinterpret_cast<sockaddr *>(&address), &length) != 0))
+        {
+            std::perror("receiver socket");
+            std::exit(1);
+        }
+        port = ntohs(address.sin_port);
+        return fd;
+    }
+} // namespace
+
+int main(int argc, char **argv)
+{
+    std::size_t const iterations = ara::bench::Option(argc, argv, "iterations", 100000U);
+    std::size_t const maxThreads = ara::bench::Option(argc, argv, "threads", 4U);
+
+    ara::bench::TempDirectory const directory("ara_log_bench");
+    std::uint16_t port = 0U;
+    int const receiver = OpenReceiver(port);
+
+    LogConfig config;
+    config.appId = "BNCH";
+    config.remoteHost = "127.0.0.1";
+    config.remotePort = port;
+    config.filePath = directory.Path();
+    config.fileSegmentSize = 1024U * 1024U;
+    config.fileRetention = 4U;
+    config.blockTimeout = std::chrono::microseconds(100000);
+
+    Logger &logger = CreateLogger("BNCH", "log benchmark", LogLevel::kVerbose);
+    SinkCase const sinks[] = {{"console", LogMode::kConsole}, {"file", LogMode::kFile}, {"remote", LogMode::kRemote}};
+
+    std::printf("%zu lines per producer; latency in ns under kDropNewest, throughput under kBlock\n", iterations);
+    std::printf("%-8s %7s %8s %8s %9s %9s %12s %9s\n", "sink", "threads", "p50", "p99", "p99.9", "lat.drop",
+                "lines/s", "thr.drop");
+    std::fflush(stdout);
+
+    int const console = dup(STDOUT_FILENO);
+    int const null = open("/dev/null", O_WRONLY);
+    for (SinkCase const &sink : sinks)
+    {
+        config.mode = sink.mode;
+        for (std::size_t threads = 1U; threads <= maxThreads; threads *= 2U)
+        {
+            if (sink.mode == LogMode::kConsole)
+            {
+                dup2(null, STDOUT_FILENO);
+            }
+            config.backpressure = BackpressurePolicy::kDropNewest;
+            LogManager::Instance().Configure(config);
+            Run latency = Measure(logger, threads, iterations, true);
+            config.backpressure = BackpressurePolicy::kBlock;
+            LogManager::Instance().Configure(config);
+            Run const throughput = Measure(logger, threads, iterations, false);
+            std::fflush(stdout);
+            dup2(console, STDOUT_FILENO);
+
+            double const linesPerSecond =
+                static_cast<double>(throughput.lines - throughput.dropped) * 1e9 / static_cast<double>(throughput.elapsedNs);
+            std::printf("%-8s %7zu %8llu %8llu %9llu %9llu %12.0f %9llu\n", sink.name, threads,
+                        static_cast<unsigned long long>(latency.latency.Percentile(0.5)),
+                        static_cast<unsigned long long>(latency.latency.Percentile(0.99)),
+                        static_cast<unsigned long long>(latency.latency.Percentile(0.999)),
+                        static_cast<unsigned long long>(latency.dropped), linesPerSecond,
+                        static_cast<unsigned long long>(throughput.dropped));
+            std::fflush(stdout);
+        }
+    }
+
+    LogManager::Instance().Shutdown();
+    close(null);
+    close(console);
+    close(receiver);
+    return 0;
+}
@@ -0,0 +1,104 @@
+/**
+ * \file log_format_benchmark.cpp
+ * \author Vincent WANG (you@domain.com)
+ * \brief Caller cost of a log line with hex, binary and ErrorCode arguments: deferred versus eager formatting.
+ *
+ * deferred: the arguments go to the LogStream as HexFormat(), BinFormat() and ErrorCode, which store the raw
+ *           values and leave the text to the logging thread or to log_decoder.
+ * eager:    the caller renders the same arguments to text first, as the stream did before, and logs the
+ *           text as one StringView.
+ *
+ * Both log to a file sink that drops on a full buffer, so only the caller side is measured. Usage:
+ *     log_format_benchmark [--iterations=200000]
+ *
+ * \version 0.1
+ * \date 2020-12-08
+ *
+ * \copyright Copyright (c) 2020
+ *
+ */
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include "ara/core/core_error_domain.h"
+#include "ara/log/logging.h"
+#include "bench_util.h"
+#include "log_manager.h"
+
+using namespace ara::log;
+using ara::bench::Samples;
+using ara::bench::Ticks;
+
+namespace
+{
+    std::size_t FormatBinary(char *out, std::uint32_t value) noexcept
+    {
+        out[0] = '0';
+        out[1] = 'b';
+        for (int bit = 31; bit >= 0; --bit)
+        {
+            out[2 + (31 - bit)] = (((value >> bit) & 1U) != 0U) ? '1' : '0';
+        }
+        return 34U;
+    }
+
+    void Deferred(Logger &logger, std::uint32_t value, ara::core::ErrorCode const &error)
+    {
+        logger.LogInfo() << "crc" << HexFormat(value) << "flags" << BinFormat(value) << error;
+    }
+
+    void Eager(Logger &logger, std::uint32_t value, ara::core::ErrorCode const &error)
+    {
+        char text[256];
+        int length = std::snprintf(text, sizeof(text), "crc 0x%08x flags ", value);
+        length += static_cast<int>(FormatBinary(text + length, value));
+        ara::core::StringView const message = error.Message();
+        length += std::snprintf(text + length, sizeof(text) - static_cast<std::size_t>(length), " %s:%lld %.*s",
+                                error.Domain().Name(), static_cast<long long>(error.Value()),
+                                static_cast<int>(message.size()), message.data());
+        logger.LogInfo() << ara::core::StringView(text, static_cast<std::size_t>(length));
+    }
+
+    template <typename Line>
+    void Report(char const *name, Logger &logger, std::size_t iterations, Line line)
+    {
+        ara::core::ErrorCode const error(ara::core::CoreErrc::kInvalidArgument);
+        Samples samples(iterations);
+        for (std::size_t i = 0U; i < iterations; ++i)
+        {
+            std::uint32_t const value = static_cast<std::uint32_t>(i) * 2654435761U;
+            std::uint64_t const before = Ticks();
+            line(logger, value, error);
+            samples.Add(Ticks() - before);
+        }
+        std::printf("%-9s %8llu %8llu %9llu\n", name, static_cast<unsigned long long>(samples.Percentile(0.5)),
+                    static_cast<unsigned long long>(samples.Percentile(0.99)),
+                    static_cast<unsigned long long>(samples.Percentile(0.999)));
+    }
+} // namespace
+
+int main(int argc, char **argv)
+{
+    std::size_t const iterations = ara::bench::Option(argc, argv, "iterations", 200000U);
+
+    ara::bench::TempDirectory const directory("ara_log_format");
+    internal::LogConfig config;
+    config.appId = "BNCH";
+    config.mode = LogMode::kFile;
+    config.filePath = directory.Path();
+    config.fileSegmentSize = 1024U * 1024U;
+    config.fileRetention = 2U;
+    config.backpressure = internal::BackpressurePolicy::kDropNewest;
+    internal::LogManager::Instance().Configure(config);
+
+    Logger &logger = CreateLogger("FMT", "format benchmark", LogLevel::kVerbose);
+    std::printf("%zu lines, caller cost in %s\n", iterations, ara::bench::TicksUnit());
+    std::printf("%-9s %8s %8s %9s\n", "format", "p50", "p99", "p99.9");
+    // warm up the buffer of this thread and the error domain tables
+    Report("warm-up", logger, iterations / 10U, &Deferred);
+    Report("deferred", logger, iterations, &Deferred);
+    Report("eager", logger, iterations, &Eager);
+
+    internal::LogManager::Instance().Shutdown();
+    return 0;
+}
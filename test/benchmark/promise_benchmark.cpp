@@ -0,0 +1,109 @@
+/**
+ * \file promise_benchmark.cpp
+ * \author Vincent WANG (vin@misday.com)
+ * \brief Heap allocations and time per Promise/Future round-trip, with and without the shared state pool.
+ *
+ * Built twice: promise_benchmark uses the pool as configured by ARA_CORE_SHARED_STATE_POOL,
+ * promise_benchmark_heap always allocates every shared state from the heap (the naive design). Two cases:
+ *  - local:  Promise, Future, set_value() and GetResult() on one thread
+ *  - remote: a client thread hands each Promise to a server thread, which sets the value while the client
+ *            waits, as in a method call; the shared state is freed by either thread
+ *
+ * Usage:
+ *     promise_benchmark [--iterations=200000]
+ *
+ * \version 0.1
+ * \date 2021-11-12
+ *
+ * \copyright Copyright (c) 2021
+ *
+ */
+#include <atomic>
+#include <cstdint>
+#include <cstdio>
+#include <thread>
+#include "ara/core/future.h"
+#include "ara/core/promise.h"
+#include "bench_util.h"
+
+using ara::bench::HeapAllocations;
+using ara::bench::NowNs;
+using ara::core::Future;
+using ara::core::Promise;
+
+namespace
+{
+    template <typename Body>
+    void Measure(char const *name, std::size_t iterations, Body body)
+    {
+        // the first calls fill the per-thread pools
+        body(iterations / 10U);
+        std::uint64_t const allocations = HeapAllocations();
+        std::uint64_t const start = NowNs();
+        body(iterations);
+        double const ns = static_cast<double>(NowNs() - start) / static_cast<double>(iterations);
+        double const perCall = static_cast<double>(HeapAllocations() - allocations) / static_cast<double>(iterations);
+        std::printf("%-8s %-8s %10.1f %12.3f\n", ARA_CORE_SHARED_STATE_POOL ? "pool" : "heap", name, ns, perCall);
+    }
+
+    void Local(std::size_t iterations)
+    {
+        std::uint64_t sum = 0U;
+        for (std::size_t i = 0U; i < iterations; ++i)
+        {
+            Promise<std::uint32_t> promise;
+            Future<std::uint32_t> future = promise.get_future();
+            promise.set_value(static_cast<std::uint32_t>(i));
+            sum += future.GetResult().Value();
+        }
+        ara::bench::DoNotOptimize(sum);
+    }
+
+    // Single slot mailbox from the client to the server thread.
+    struct Mailbox
+    {
+        std::atomic<Promise<std::uint32_t> *> request{nullptr};
+        std::atomic<bool> stop{false};
+    };
+
+    void Remote(std::size_t iterations)
+    {
+        Mailbox mailbox;
+        std::thread server([&mailbox] {
+            while (!mailbox.stop.load(std::memory_order_acquire))
+            {
+                Promise<std::uint32_t> *const request = mailbox.request.exchange(nullptr, std::memory_order_acq_rel);
+                if (request == nullptr)
+                {
+                    std::this_thread::yield();
+                    continue;
+                }
+                Promise<std::uint32_t> promise(std::move(*request));
+                promise.set_value(7U);
+            }
+        });
+
+        std::uint64_t sum = 0U;
+        for (std::size_t i = 0U; i < iterations; ++i)
+        {
+            Promise<std::uint32_t> promise;
+            Future<std::uint32_t> future = promise.get_future();
+            mailbox.request.store(&promise, std::memory_order_release);
+            sum += future.GetResult().Value();
+            // the server moved out of promise before setting the value, so it is safe to destroy now
+        }
+        mailbox.stop.store(true, std::memory_order_release);
+        server.join();
+        ara::bench::DoNotOptimize(sum);
+    }
+} // namespace
+
+int main(int argc, char **argv)
+{
+    std::size_t const iterations = ara::bench::Option(argc, argv, "iterations", 200000U);
+
+    std::printf("%zu round-trips\n%-8s %-8s %10s %12s\n", iterations, "states", "case", "ns/call", "allocs/call");
+    Measure("local", iterations, &Local);
+    Measure("remote", iterations, &Remote);
+    return 0;
+}
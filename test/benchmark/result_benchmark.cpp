@@ -0,0 +1,116 @@
+/**
+ * \file result_benchmark.cpp
+ * \author Vincent WANG (vin@misday.com)
+ * \brief Codegen check and call cost of functions returning ara::core::Result.
+ *
+ * x86-64 (System V) and AArch64 return trivially copyable objects of up to 16 bytes in two registers, larger
+ * ones through a hidden pointer to caller memory. The static_asserts below pin the layout that decides this;
+ * the run compares the cost of calls that return a plain integer and the same integer as a Result. To see
+ * the generated code:
+ *     objdump -dC --no-show-raw-insn result_benchmark | grep -A12 '<(anonymous namespace)::Parse'
+ *
+ * Usage:
+ *     result_benchmark [--iterations=10000000]
+ *
+ * \version 0.1
+ * \date 2021-11-12
+ *
+ * \copyright Copyright (c) 2021
+ *
+ */
+#include <cstdint>
+#include <cstdio>
+#include <type_traits>
+#include "ara/core/core_error_domain.h"
+#include "ara/core/result.h"
+#include "bench_util.h"
+
+using ara::bench::DoNotOptimize;
+using ara::bench::NowNs;
+using ara::core::ErrorCode;
+using ara::core::Result;
+
+namespace
+{
+    enum class ParseErrc : std::uint8_t
+    {
+        kOutOfRange = 1U,
+    };
+
+    template <typename R>
+    constexpr bool ReturnedInRegisters() noexcept
+    {
+        return (sizeof(R) <= 16U) && std::is_trivially_copyable<R>::value;
+    }
+
+    template <typename T, typename E>
+    constexpr std::size_t PackedSize() noexcept
+    {
+        // max(sizeof T, sizeof E) + 1 byte discriminator, rounded up to the alignment
+        return ((((sizeof(T) > sizeof(E)) ? sizeof(T) : sizeof(E)) + 1U + alignof(Result<T, E>) - 1U) /
+                alignof(Result<T, E>)) * alignof(Result<T, E>);
+    }
+
+    static_assert(sizeof(Result<std::uint32_t, ParseErrc>) == PackedSize<std::uint32_t, ParseErrc>(),
+                  "Result<uint32_t, enum> is not packed");
+    static_assert(sizeof(Result<std::uint32_t>) == PackedSize<std::uint32_t, ErrorCode>(),
+                  "Result<uint32_t> is not packed");
+    static_assert(ReturnedInRegisters<Result<std::uint32_t, ParseErrc>>(),
+                  "Result<uint32_t, enum> is no longer returned in registers");
+    static_assert(ReturnedInRegisters<Result<std::uint64_t, ParseErrc>>(),
+                  "Result<uint64_t, enum> is no longer returned in registers");
+    static_assert(std::is_trivially_copyable<Result<std::uint32_t>>::value &&
+                      std::is_trivially_destructible<Result<std::uint32_t>>::value,
+                  "Result<uint32_t> is no longer trivially copyable and destructible");
+
+    __attribute__((noinline)) std::uint32_t ParsePlain(std::uint32_t raw) noexcept
+    {
+        return ((raw & 63U) == 0U) ? 0U : raw * 3U;
+    }
+
+    __attribute__((noinline)) Result<std::uint32_t, ParseErrc> ParseEnum(std::uint32_t raw) noexcept
+    {
+        return ((raw & 63U) == 0U) ? Result<std::uint32_t, ParseErrc>::FromError(ParseErrc::kOutOfRange)
+                                   : Result<std::uint32_t, ParseErrc>::FromValue(raw * 3U);
+    }
+
+    __attribute__((noinline)) Result<std::uint32_t> ParseErrorCode(std::uint32_t raw) noexcept
+    {
+        return ((raw & 63U) == 0U)
+                   ? Result<std::uint32_t>::FromError(ErrorCode(ara::core::CoreErrc::kInvalidArgument))
+                   : Result<std::uint32_t>::FromValue(raw * 3U);
+    }
+
+    template <typename R>
+    void Describe(char const *name)
+    {
+        std::printf("%-36s %5zu %10s", name, sizeof(R), ReturnedInRegisters<R>() ? "registers" : "memory");
+    }
+
+    template <typename Call>
+    void Measure(std::size_t iterations, Call call)
+    {
+        std::uint64_t sum = 0U;
+        std::uint64_t const start = NowNs();
+        for (std::size_t i = 0U; i < iterations; ++i)
+        {
+            sum += call(static_cast<std::uint32_t>(i));
+        }
+        DoNotOptimize(sum);
+        std::printf(" %10.2f\n", static_cast<double>(NowNs() - start) / static_cast<double>(iterations));
+    }
+} // namespace
+
+int main(int argc, char **argv)
+{
+    std::size_t const iterations = ara::bench::Option(argc, argv, "iterations", 10000000U);
+
+    std::printf("%zu calls\n%-36s %5s %10s %10s\n", iterations, "return type", "size", "returned in", "ns/call");
+    Describe<std::uint32_t>("uint32_t");
+    Measure(iterations, [](std::uint32_t raw) { return ParsePlain(raw); });
+    Describe<Result<std::uint32_t, ParseErrc>>("Result<uint32_t, enum>");
+    Measure(iterations, [](std::uint32_t raw) { return ParseEnum(raw).ValueOr(0U); });
+    Describe<Result<std::uint32_t>>("Result<uint32_t> (ErrorCode)");
+    Measure(iterations, [](std::uint32_t raw) { return ParseErrorCode(raw).ValueOr(0U); });
+    return 0;
+}
@@ -0,0 +1,97 @@
+/**
+ * \file string_benchmark.cpp
+ * \author Vincent WANG (vin@misday.com)
+ * \brief ara::core::String versus std::string on shortName paths and key-value storage keys.
+ *
+ * Reports nanoseconds and heap allocations per operation. Strings of up to 63 characters stay inline in
+ * ara::core::String, libstdc++ keeps only 15. Longer strings are also measured with the allocator over a
+ * MonotonicBufferResource. Usage:
+ *     string_benchmark [--iterations=1000000]
+ *
+ * \version 0.1
+ * \date 2021-11-12
+ *
+ * \copyright Copyright (c) 2021
+ *
+ */
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include "ara/core/memory_resource.h"
+#include "ara/core/string.h"
+#include "bench_util.h"
+
+using ara::bench::DoNotOptimize;
+using ara::bench::HeapAllocations;
+using ara::bench::NowNs;
+
+namespace
+{
+    char const kPath[] = "/Vehicle/Chassis/Brake/FrontLeft/WheelSpeed";   // 43 characters
+    char const kKey[] = "calibration.brake.front_left.offset";          // 35 characters
+    char const kLong[] = "/Vehicle/Chassis/Brake/FrontLeft/WheelSpeedSensor/RawSignal/Timestamp/Nanoseconds/Value";
+    char const *const kComponents[] = {"Vehicle", "Chassis", "Brake", "FrontLeft", "WheelSpeed"};
+
+    template <typename Operation>
+    void Measure(char const *name, std::size_t iterations, Operation operation)
+    {
+        std::uint64_t const allocations = HeapAllocations();
+        std::uint64_t const start = NowNs();
+        for (std::size_t i = 0U; i < iterations; ++i)
+        {
+            operation();
+        }
+        double const ns = static_cast<double>(NowNs() - start) / static_cast<double>(iterations);
+        double const perOperation =
+            static_cast<double>(HeapAllocations() - allocations) / static_cast<double>(iterations);
+        std::printf("%-34s %10.1f %12.2f\n", name, ns, perOperation);
+    }
+
+    template <typename String>
+    String BuildPath()
+    {
+        String path;
+        for (char const *component : kComponents)
+        {
+            path += "/";
+            path += component;
+        }
+        return path;
+    }
+} // namespace
+
+int main(int argc, char **argv)
+{
+    std::size_t const iterations = ara::bench::Option(argc, argv, "iterations", 1000000U);
+
+    std::printf("%zu iterations\n%-34s %10s %12s\n", iterations, "operation", "ns/op", "allocs/op");
+
+    Measure("std::string construct path", iterations, [] { DoNotOptimize(std::string(kPath)); });
+    Measure("ara::core::String construct path", iterations, [] { DoNotOptimize(ara::core::String(kPath)); });
+
+    std::string const stdKey(kKey);
+    ara::core::String const araKey(kKey);
+    Measure("std::string copy key", iterations, [&stdKey] { DoNotOptimize(std::string(stdKey)); });
+    Measure("ara::core::String copy key", iterations, [&araKey] { DoNotOptimize(ara::core::String(araKey)); });
+
+    Measure("std::string append path", iterations, [] { DoNotOptimize(BuildPath<std::string>()); });
+    Measure("ara::core::String append path", iterations, [] { DoNotOptimize(BuildPath<ara::core::String>()); });
+
+    Measure("std::string key to view", iterations, [&stdKey] {
+        DoNotOptimize(ara::core::StringView(stdKey.data(), stdKey.size()));
+    });
+    Measure("ara::core::String key to view", iterations, [&araKey] {
+        DoNotOptimize(static_cast<ara::core::StringView>(araKey));
+    });
+
+    Measure("std::string construct long", iterations, [] { DoNotOptimize(std::string(kLong)); });
+    Measure("ara::core::String construct long", iterations, [] { DoNotOptimize(ara::core::String(kLong)); });
+
+    alignas(std::max_align_t) static char arena[4096];
+    ara::core::MonotonicBufferResource resource(arena, sizeof(arena));
+    Measure("ara::core::String long, arena", iterations, [&resource] {
+        DoNotOptimize(ara::core::String(kLong, ara::core::PolymorphicAllocator<char>(&resource)));
+        resource.Release();
+    });
+    return 0;
+}
@@ -0,0 +1,114 @@
+/**
+ * \file timed_wait_jitter.cpp
+ * \author Vincent WANG (vin@misday.com)
+ * \brief Wake-up jitter of Future::wait_for() and wait_until() on steady_clock and system_clock.
+ *
+ * Every wait times out on a Future that never becomes ready. The overshoot is the time between the
+ * deadline and the return of the wait, measured on the clock of the deadline; std::this_thread::sleep_until()
+ * is measured the same way as the baseline of the kernel timer slack. A wait that returns before its
+ * deadline is an error and fails the run. Usage:
+ *     timed_wait_jitter [--waits=2000] [--period-us=1000]
+ *
+ * \version 0.1
+ * \date 2021-11-12
+ *
+ * \copyright Copyright (c) 2021
+ *
+ */
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <thread>
+#include "ara/core/future.h"
+#include "ara/core/promise.h"
+#include "bench_util.h"
+
+using ara::bench::Samples;
+using ara::core::Future;
+using ara::core::future_status;
+using ara::core::Promise;
+
+namespace
+{
+    bool early = false;
+
+    template <typename Clock>
+    std::uint64_t Overshoot(typename Clock::time_point deadline)
+    {
+        auto const late = Clock::now() - deadline;
+        if (late < Clock::duration::zero())
+        {
+            early = true;
+            return 0U;
+        }
+        return static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(late).count());
+    }
+
+    void Report(char const *name, Samples &samples)
+    {
+        std::uint64_t const max = samples.Percentile(1.0);
+        std::printf("%-28s %9.1f %9.1f %9.1f %9.1f\n", name, static_cast<double>(samples.Percentile(0.5)) / 1e3,
+                    static_cast<double>(samples.Percentile(0.99)) / 1e3,
+                    static_cast<double>(samples.Percentile(0.999)) / 1e3, static_cast<double>(max) / 1e3);
+    }
+
+    template <typename Wait>
+    void Measure(char const *name, std::size_t waits, Wait wait)
+    {
+        Samples samples(waits);
+        for (std::size_t i = 0U; i < waits; ++i)
+        {
+            samples.Add(wait());
+        }
+        Report(name, samples);
+    }
+} // namespace
+
+int main(int argc, char **argv)
+{
+    std::size_t const waits = ara::bench::Option(argc, argv, "waits", 2000U);
+    std::chrono::microseconds const period(ara::bench::Option(argc, argv, "period-us", 1000U));
+
+    Promise<int> promise;
+    Future<int> future = promise.get_future();
+
+    std::printf("%zu waits of %lld us, overshoot in us\n%-28s %9s %9s %9s %9s\n", waits,
+                static_cast<long long>(period.count()), "wait", "p50", "p99", "p99.9", "max");
+    Measure("sleep_until steady", waits, [period] {
+        auto const deadline = std::chrono::steady_clock::now() + period;
+        std::this_thread::sleep_until(deadline);
+        return Overshoot<std::chrono::steady_clock>(deadline);
+    });
+    Measure("wait_for", waits, [&future, period] {
+        auto const deadline = std::chrono::steady_clock::now() + period;
+        if (future.wait_for(period) != future_status::timeout)
+        {
+            early = true;
+        }
+        return Overshoot<std::chrono::steady_clock>(deadline);
+    });
+    Measure("wait_until steady_clock", waits, [&future, period] {
+        auto const deadline = std::chrono::steady_clock::now() + period;
+        if (future.wait_until(deadline) != future_status::timeout)
+        {
+            early = true;
+        }
+        return Overshoot<std::chrono::steady_clock>(deadline);
+    });
+    Measure("wait_until system_clock", waits, [&future, period] {
+        auto const deadline = std::chrono::system_clock::now() + period;
+        if (future.wait_until(deadline) != future_status::timeout)
+        {
+            early = true;
+        }
+        return Overshoot<std::chrono::system_clock>(deadline);
+    });
+
+    promise.set_value(0);
+    if (early)
+    {
+        std::printf("a wait returned before its deadline\n");
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,161 @@
+/**
+ * \file coroutine_test.cpp
+ * \author Vincent WANG (vin@misday.com)
+ * \brief Tests of coroutines returning and awaiting Future. Built as C++20.
+ * \version 0.1
+ * \date 2021-11-12
+ *
+ * \copyright Copyright (c) 2021
+ *
+ */
+#include <chrono>
+#include <stdexcept>
+#include <gtest/gtest.h>
+#include "ara/core/core_error_domain.h"
+#include "ara/core/coroutine.h"
+#include "ara/core/promise.h"
+
+#if defined(ARA_CORE_HAS_COROUTINES)
+
+using namespace ara::core;
+using namespace std::chrono_literals;
+
+namespace
+{
+    // Counts its destructions, to see that a coroutine frame is freed.
+    struct FrameGuard
+    {
+        explicit FrameGuard(int &destroyed) noexcept : destroyed_(destroyed)
+        {
+        }
+
+        ~FrameGuard()
+        {
+            ++destroyed_;
+        }
+
+        int &destroyed_;
+    };
+
+    // An error type that can report future errors but cannot hold an ErrorCode.
+    struct FutureErrorOnly
+    {
+        FutureErrorOnly(future_errc code) noexcept : code(code)
+        {
+        }
+
+        future_errc code;
+    };
+
+    Future<int> Immediate()
+    {
+        co_return 42;
+    }
+
+    Future<int> Increment(Future<int> input, int &destroyed)
+    {
+        FrameGuard const guard(destroyed);
+        Result<int> const value = co_await std::move(input);
+        co_return value.Value() + 1;
+    }
+
+    Future<void> Forward(Future<int> input, int &seen)
+    {
+        Result<int> const value = co_await std::move(input);
+        seen = value.ValueOr(-1);
+    }
+
+#if ARA_CORE_EXCEPTIONS
+    Future<int> ThrowCoreError(Future<int> input, int &destroyed)
+    {
+        FrameGuard const guard(destroyed);
+        (void)co_await std::move(input);
+        ErrorCode(CoreErrc::kInvalidArgument).ThrowAsException();
+        co_return 0;
+    }
+
+    Future<int> ThrowForeign(Future<int> input, int &destroyed)
+    {
+        FrameGuard const guard(destroyed);
+        (void)co_await std::move(input);
+        throw std::runtime_error("not an ara::core::Exception");
+    }
+
+    Future<int, FutureErrorOnly> ThrowWithoutErrorCode(Future<int> input, int &destroyed)
+    {
+        FrameGuard const guard(destroyed);
+        (void)co_await std::move(input);
+        ErrorCode(CoreErrc::kInvalidArgument).ThrowAsException();
+        co_return 0;
+    }
+#endif
+} // namespace
+
+TEST(CoroutineTest, ReturnsValueWithoutSuspending)
+{
+    Future<int> future = Immediate();
+    ASSERT_TRUE(future.is_ready());
+    EXPECT_EQ(future.GetResult().Value(), 42);
+}
+
+TEST(CoroutineTest, ResumesWhenAwaitedFutureIsSet)
+{
+    int destroyed = 0;
+    Promise<int> promise;
+    Future<int> future = Increment(promise.get_future(), destroyed);
+    EXPECT_FALSE(future.is_ready());
+    EXPECT_EQ(destroyed, 0);
+
+    promise.set_value(1);
+    ASSERT_TRUE(future.is_ready());
+    EXPECT_EQ(future.GetResult().Value(), 2);
+    EXPECT_EQ(destroyed, 1);
+}
+
+TEST(CoroutineTest, CompletesVoidCoroutine)
+{
+    int seen = 0;
+    Promise<int> promise;
+    Future<void> future = Forward(promise.get_future(), seen);
+    promise.set_value(7);
+    ASSERT_TRUE(future.is_ready());
+    EXPECT_TRUE(future.GetResult().HasValue());
+    EXPECT_EQ(seen, 7);
+}
+
+#if ARA_CORE_EXCEPTIONS
+TEST(CoroutineTest, StoresCoreExceptionAsError)
+{
+    int destroyed = 0;
+    Promise<int> promise;
+    Future<int> future = ThrowCoreError(promise.get_future(), destroyed);
+    promise.set_value(1);
+    ASSERT_EQ(future.wait_for(100ms), future_status::ready);
+    EXPECT_EQ(future.GetResult().Error(), ErrorCode(CoreErrc::kInvalidArgument));
+    EXPECT_EQ(destroyed, 1);
+}
+
+TEST(CoroutineTest, BreaksPromiseOnForeignException)
+{
+    int destroyed = 0;
+    Promise<int> promise;
+    Future<int> future = ThrowForeign(promise.get_future(), destroyed);
+    EXPECT_NO_THROW(promise.set_value(1));
+    ASSERT_EQ(future.wait_for(100ms), future_status::ready);
+    EXPECT_EQ(future.GetResult().Error(), ErrorCode(future_errc::broken_promise));
+    EXPECT_EQ(destroyed, 1);
+}
+
+TEST(CoroutineTest, BreaksPromiseIfErrorTypeCannotHoldErrorCode)
+{
+    int destroyed = 0;
+    Promise<int> promise;
+    Future<int, FutureErrorOnly> future = ThrowWithoutErrorCode(promise.get_future(), destroyed);
+    EXPECT_NO_THROW(promise.set_value(1));
+    ASSERT_EQ(future.wait_for(100ms), future_status::ready);
+    EXPECT_EQ(future.GetResult().Error().code, future_errc::broken_promise);
+    EXPECT_EQ(destroyed, 1);
+}
+#endif
+
+#endif
@@ -0,0 +1,119 @@
+/**
+ * \file shared_state_pool_test.cpp
+ * \author Vincent WANG (vin@misday.com)
+ * \brief Tests of the per-thread recycling of Promise/Future shared states.
+ * \version 0.1
+ * \date 2021-11-12
+ *
+ * \copyright Copyright (c) 2021
+ *
+ */
+#include <atomic>
+#include <cstdlib>
+#include <new>
+#include <thread>
+#include <vector>
+#include <gtest/gtest.h>
+#include "ara/core/future.h"
+#include "ara/core/promise.h"
+#include "ara/core/shared_state_pool.h"
+
+namespace
+{
+    std::atomic<std::size_t> heapAllocations{0U};
+
+    using Pool = ara::core::internal::SharedStatePool<64U, alignof(std::max_align_t)>;
+} // namespace
+
+// counts every allocation of the process
+void* operator new(std::size_t size)
+{
+    heapAllocations.fetch_add(1U, std::memory_order_relaxed);
+    void *const p = std::malloc((size != 0U) ? size : 1U);
+    if (p == nullptr)
+    {
+#if ARA_CORE_EXCEPTIONS
+        throw std::bad_alloc();
+#else
+        std::abort();
+#endif
+    }
+    return p;
+}
+
+void operator delete(void *p) noexcept
+{
+    std::free(p);
+}
+
+void operator delete(void *p, std::size_t) noexcept
+{
+    std::free(p);
+}
+
+TEST(SharedStatePoolTest, RecyclesOnTheAllocatingThread)
+{
+    void *const first = Pool::Allocate();
+    Pool::Deallocate(first);
+    std::size_t const before = heapAllocations.load();
+    void *const second = Pool::Allocate();
+    EXPECT_EQ(second, first);
+    EXPECT_EQ(heapAllocations.load(), before);
+    Pool::Deallocate(second);
+}
+
+TEST(SharedStatePoolTest, TakesBackBlocksFreedByOtherThreads)
+{
+    constexpr int kBlocks = 16;
+    std::vector<void *> blocks;
+    for (int i = 0; i < kBlocks; ++i)
+    {
+        blocks.push_back(Pool::Allocate());
+    }
+    std::thread([&blocks] {
+        for (void *block : blocks)
+        {
+            Pool::Deallocate(block);
+        }
+    }).join();
+
+    std::size_t const before = heapAllocations.load();
+    for (int i = 0; i < kBlocks; ++i)
+    {
+        blocks[static_cast<std::size_t>(i)] = Pool::Allocate();
+    }
+    EXPECT_EQ(heapAllocations.load(), before);
+    for (void *block : blocks)
+    {
+        Pool::Deallocate(block);
+    }
+}
+
+TEST(SharedStatePoolTest, FreesBlocksReleasedAfterTheOwnerExited)
+{
+    // run under ASan/valgrind to see the blocks go back to the heap
+    void *orphan = nullptr;
+    std::thread([&orphan] { orphan = Pool::Allocate(); }).join();
+    Pool::Deallocate(orphan);
+}
+
+#if ARA_CORE_SHARED_STATE_POOL
+TEST(SharedStatePoolTest, PromisesStopAllocatingOnceWarm)
+{
+    constexpr int kRounds = 1000;
+    {
+        ara::core::Promise<int> warm;
+        (void)warm.get_future();
+    }
+
+    std::size_t const before = heapAllocations.load();
+    for (int i = 0; i < kRounds; ++i)
+    {
+        ara::core::Promise<int> promise;
+        ara::core::Future<int> future = promise.get_future();
+        promise.set_value(i);
+        EXPECT_EQ(future.GetResult().Value(), i);
+    }
+    EXPECT_EQ(heapAllocations.load(), before);
+}
+#endif
@@ -0,0 +1,156 @@
+/**
+ * \file shared_state_test.cpp
+ * \author Vincent WANG (vin@misday.com)
+ * \brief Tests of the futex-backed shared state behind Promise and Future.
+ * \version 0.1
+ * \date 2021-11-12
+ *
+ * \copyright Copyright (c) 2021
+ *
+ */
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+#include <gtest/gtest.h>
+#include "ara/core/core_error_domain.h"
+#include "ara/core/future.h"
+#include "ara/core/promise.h"
+
+using namespace ara::core;
+using namespace std::chrono_literals;
+
+namespace
+{
+    ErrorCode FutureError(future_errc code)
+    {
+        return ErrorCode(code);
+    }
+} // namespace
+
+TEST(SharedStateTest, PublishesValue)
+{
+    Promise<int> promise;
+    Future<int> future = promise.get_future();
+    EXPECT_FALSE(future.is_ready());
+    promise.set_value(42);
+    ASSERT_TRUE(future.is_ready());
+    EXPECT_EQ(future.GetResult().Value(), 42);
+    EXPECT_FALSE(future.valid());
+}
+
+TEST(SharedStateTest, PublishesError)
+{
+    Promise<void> promise;
+    Future<void> future = promise.get_future();
+    promise.SetError(ErrorCode(CoreErrc::kInvalidArgument));
+    Result<void> result = future.GetResult();
+    ASSERT_FALSE(result.HasValue());
+    EXPECT_EQ(result.Error(), ErrorCode(CoreErrc::kInvalidArgument));
+}
+
+TEST(SharedStateTest, BreaksPromiseOnDestruction)
+{
+    Future<int> future;
+    {
+        Promise<int> promise;
+        future = promise.get_future();
+    }
+    Result<int> result = future.GetResult();
+    ASSERT_FALSE(result.HasValue());
+    EXPECT_EQ(result.Error(), FutureError(future_errc::broken_promise));
+}
+
+TEST(SharedStateTest, WakesSleepingWaiters)
+{
+    // long enough for every waiter to get past spinning and sleep on the futex
+    constexpr int kWaiters = 4;
+    Promise<int> promise;
+    Future<int> future = promise.get_future();
+    std::atomic<int> woken{0};
+
+    std::vector<std::thread> waiters;
+    for (int i = 0; i < kWaiters; ++i)
+    {
+        waiters.emplace_back([&future, &woken] {
+            future.wait();
+            woken.fetch_add(1);
+        });
+    }
+    std::this_thread::sleep_for(20ms);
+    EXPECT_EQ(woken.load(), 0);
+
+    promise.set_value(1);
+    for (auto &waiter : waiters)
+    {
+        waiter.join();
+    }
+    EXPECT_EQ(woken.load(), kWaiters);
+}
+
+TEST(SharedStateTest, WaitForTimesOutOnSteadyClock)
+{
+    Promise<int> promise;
+    Future<int> future = promise.get_future();
+    auto const start = std::chrono::steady_clock::now();
+    EXPECT_EQ(future.wait_for(10ms), future_status::timeout);
+    EXPECT_GE(std::chrono::steady_clock::now() - start, 10ms);
+
+    promise.set_value(1);
+    EXPECT_EQ(future.wait_for(10ms), future_status::ready);
+}
+
+TEST(SharedStateTest, WaitUntilTimesOutOnSystemClock)
+{
+    Promise<int> promise;
+    Future<int> future = promise.get_future();
+    auto const deadline = std::chrono::system_clock::now() + 10ms;
+    EXPECT_EQ(future.wait_until(deadline), future_status::timeout);
+    EXPECT_GE(std::chrono::system_clock::now(), deadline);
+
+    std::thread setter([&promise] {
+        std::this_thread::sleep_for(5ms);
+        promise.set_value(1);
+    });
+    EXPECT_EQ(future.wait_until(std::chrono::system_clock::now() + 10s), future_status::ready);
+    setter.join();
+}
+
+TEST(SharedStateTest, RunsContinuationOnceWhateverSideIsLast)
+{
+    constexpr int kRounds = 2000;
+    std::atomic<int> runs{0};
+    for (int i = 0; i < kRounds; ++i)
+    {
+        Promise<int> promise;
+        Future<int> future = promise.get_future();
+        std::thread setter([&promise, i] { promise.set_value(i); });
+        Future<int> next = future.then([&runs](Future<int> ready) {
+            runs.fetch_add(1);
+            return ready.GetResult().Value() + 1;
+        });
+        EXPECT_EQ(next.GetResult().Value(), i + 1);
+        setter.join();
+    }
+    EXPECT_EQ(runs.load(), kRounds);
+}
+
+#if ARA_CORE_EXCEPTIONS
+TEST(SharedStateTest, KeepsContinuationExceptionsOutOfSetValue)
+{
+    Promise<int> promise;
+    Future<int> coded = promise.get_future().then([](Future<int>) -> int {
+        ErrorCode(CoreErrc::kInvalidArgument).ThrowAsException();
+        return 0;
+    });
+    EXPECT_NO_THROW(promise.set_value(1));
+    EXPECT_EQ(coded.GetResult().Error(), ErrorCode(CoreErrc::kInvalidArgument));
+
+    Future<int> other;
+    {
+        Promise<int> abandoned;
+        other = abandoned.get_future().then([](Future<int>) -> int { throw 1; });
+    }
+    EXPECT_EQ(other.GetResult().Error(), FutureError(future_errc::broken_promise));
+}
+#endif
@@ -0,0 +1,176 @@
+/**
+ * \file span_algorithms_test.cpp
+ * \author Vincent WANG (vin@misday.com)
+ * \brief Tests of the Span byte kernels against plain reference code and known CRC check values.
+ *
+ * The kernels picked for this CPU are compared with byte-by-byte reference code over every size up to a few
+ * vector widths and every misalignment, so that the vector loops and their scalar tails are both covered.
+ *
+ * \version 0.1
+ * \date 2021-11-12
+ *
+ * \copyright Copyright (c) 2021
+ *
+ */
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+#include <gtest/gtest.h>
+#include "ara/core/span_algorithms.h"
+
+using namespace ara::core;
+
+namespace
+{
+    constexpr std::size_t kMaxSize = 200U;
+    constexpr std::size_t kMaxOffset = 32U;
+
+    std::vector<std::uint8_t> Pattern(std::size_t size, std::uint32_t seed)
+    {
+        std::vector<std::uint8_t> bytes(size);
+        for (auto &byte : bytes)
+        {
+            seed = (seed * 1664525U) + 1013904223U;
+            byte = static_cast<std::uint8_t>(seed >> 24);
+        }
+        return bytes;
+    }
+
+    std::uint32_t ReferenceCrc(std::uint32_t polynomial, std::uint8_t const *p, std::size_t size)
+    {
+        std::uint32_t crc = ~0U;
+        for (std::size_t i = 0U; i < size; ++i)
+        {
+            crc ^= p[i];
+            for (int bit = 0; bit < 8; ++bit)
+            {
+                crc = (crc >> 1) ^ (((crc & 1U) != 0U) ? polynomial : 0U);
+            }
+        }
+        return ~crc;
+    }
+
+    Span<std::uint8_t const> Bytes(char const *text)
+    {
+        return Span<std::uint8_t const>(reinterpret_cast<std::uint8_t const *>(text), std::strlen(text));
+    }
+} // namespace
+
+TEST(SpanAlgorithmsTest, MatchesCrcCheckValues)
+{
+    EXPECT_EQ(Crc32(Bytes("123456789")), 0xCBF43926U);
+    EXPECT_EQ(Crc32C(Bytes("123456789")), 0xE3069283U);
+    EXPECT_EQ(Crc32(Bytes("")), 0U);
+    EXPECT_EQ(Crc32C(Bytes("")), 0U);
+}
+
+TEST(SpanAlgorithmsTest, ChainsCrcOverPieces)
+{
+    EXPECT_EQ(Crc32(Bytes("6789"), Crc32(Bytes("12345"))), 0xCBF43926U);
+    EXPECT_EQ(Crc32C(Bytes("6789"), Crc32C(Bytes("12345"))), 0xE3069283U);
+}
+
+TEST(SpanAlgorithmsTest, CrcMatchesReferenceForAllSizesAndAlignments)
+{
+    auto const data = Pattern(kMaxSize + kMaxOffset, 1U);
+    for (std::size_t offset = 0U; offset < kMaxOffset; offset += 3U)
+    {
+        for (std::size_t size = 0U; size <= kMaxSize; ++size)
+        {
+            Span<std::uint8_t const> const bytes(data.data() + offset, size);
+            ASSERT_EQ(Crc32(bytes), ReferenceCrc(0xEDB88320U, bytes.data(), size)) << offset << " " << size;
+            ASSERT_EQ(Crc32C(bytes), ReferenceCrc(0x82F63B78U, bytes.data(), size)) << offset << " " << size;
+        }
+    }
+}
+
+TEST(SpanAlgorithmsTest, SwapsByteOrderLikeReference)
+{
+    auto const data = Pattern(kMaxSize + kMaxOffset, 2U);
+    for (std::size_t width : {2U, 4U, 8U})
+    {
+        for (std::size_t offset = 0U; offset < kMaxOffset; offset += 5U)
+        {
+            for (std::size_t size = 0U; size <= kMaxSize; ++size)
+            {
+                std::vector<std::uint8_t> actual(data.begin() + static_cast<std::ptrdiff_t>(offset),
+                                                 data.begin() + static_cast<std::ptrdiff_t>(offset + size));
+                std::vector<std::uint8_t> expected = actual;
+                for (std::size_t word = 0U; (word + width) <= size; word += width)
+                {
+                    std::reverse(expected.begin() + static_cast<std::ptrdiff_t>(word),
+                                 expected.begin() + static_cast<std::ptrdiff_t>(word + width));
+                }
+                SwapByteOrder(Span<std::uint8_t>(actual.data(), actual.size()), width);
+                ASSERT_EQ(actual, expected) << width << " " << offset << " " << size;
+            }
+        }
+    }
+}
+
+TEST(SpanAlgorithmsTest, IgnoresUnsupportedWordWidths)
+{
+    auto data = Pattern(64U, 3U);
+    auto const original = data;
+    SwapByteOrder(Span<std::uint8_t>(data.data(), data.size()), 3U);
+    SwapByteOrder(Span<std::uint8_t>(data.data(), data.size()), 16U);
+    EXPECT_EQ(data, original);
+}
+
+TEST(SpanAlgorithmsTest, XorsLikeReference)
+{
+    auto const target = Pattern(kMaxSize + kMaxOffset, 4U);
+    auto const source = Pattern(kMaxSize + kMaxOffset, 5U);
+    for (std::size_t offset = 0U; offset < kMaxOffset; offset += 7U)
+    {
+        for (std::size_t size = 0U; size <= kMaxSize; ++size)
+        {
+            std::vector<std::uint8_t> actual(target.begin(), target.begin() + static_cast<std::ptrdiff_t>(size));
+            std::vector<std::uint8_t> expected = actual;
+            for (std::size_t i = 0U; i < size; ++i)
+            {
+                expected[i] = static_cast<std::uint8_t>(expected[i] ^ source[offset + i]);
+            }
+            XorBytes(Span<std::uint8_t>(actual.data(), size), Span<std::uint8_t const>(source.data() + offset, size));
+            ASSERT_EQ(actual, expected) << offset << " " << size;
+        }
+    }
+}
+
+TEST(SpanAlgorithmsTest, XorsOnlyTheCommonLength)
+{
+    std::vector<std::uint8_t> target(40U, 0xFFU);
+    std::vector<std::uint8_t> const source(24U, 0x0FU);
+    XorBytes(Span<std::uint8_t>(target.data(), target.size()), Span<std::uint8_t const>(source.data(), source.size()));
+    EXPECT_EQ(std::count(target.begin(), target.end(), 0xF0U), 24);
+    EXPECT_EQ(std::count(target.begin(), target.end(), 0xFFU), 16);
+}
+
+TEST(SpanAlgorithmsTest, FindsFirstByte)
+{
+    std::vector<std::uint8_t> data(100U, 0U);
+    data[42] = 7U;
+    data[77] = 7U;
+    Span<std::uint8_t const> const bytes(data.data(), data.size());
+    EXPECT_EQ(FindByte(bytes, 7U), 42U);
+    EXPECT_EQ(FindByte(bytes, 9U), data.size());
+    EXPECT_EQ(FindByte(Span<std::uint8_t const>(), 7U), 0U);
+}
+
+TEST(SpanAlgorithmsTest, ComparesAsUnsignedBytes)
+{
+    std::uint8_t const low[] = {1U, 2U, 0x7FU};
+    std::uint8_t const high[] = {1U, 2U, 0x80U};
+    Span<std::uint8_t const> const a(low, 3U);
+    Span<std::uint8_t const> const b(high, 3U);
+    EXPECT_LT(CompareBytes(a, b), 0);
+    EXPECT_GT(CompareBytes(b, a), 0);
+    EXPECT_EQ(CompareBytes(a, a), 0);
+    EXPECT_LT(CompareBytes(a.first(2U), a), 0);
+    EXPECT_GT(CompareBytes(a, a.first(2U)), 0);
+    EXPECT_TRUE(EqualBytes(a, Span<std::uint8_t const>(low, 3U)));
+    EXPECT_FALSE(EqualBytes(a, b));
+    EXPECT_FALSE(EqualBytes(a, a.first(2U)));
+    EXPECT_TRUE(EqualBytes(Span<std::uint8_t const>(), Span<std::uint8_t const>()));
+}
@@ -0,0 +1,254 @@
+/**
+ * \file dlt_remote_sink_test.cpp
+ * \author Vincent WANG (you@domain.com)
+ * \brief Loopback test of the DLT remote sink against a local receiver stand-in.
+ *
+ * Besides checking what arrives, every transport reports the messages per second handed to the kernel and
+ * the sendmmsg()/writev() calls per message.
+ *
+ * \version 0.1
+ * \date 2020-12-08
+ *
+ * \copyright Copyright (c) 2020
+ *
+ */
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <thread>
+#include <vector>
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#include <gtest/gtest.h>
+#include "dlt_remote_sink.h"
+
+using namespace ara::log;
+using namespace ara::log::internal;
+
+namespace
+{
+    constexpr std::size_t kMessages = 20000U;
+
+    // Stand-in for a DLT receiver on a free loopback port: counts the DLT messages it gets.
+    class Receiver final
+    {
+    public:
+        explicit Receiver(RemoteTransport transport) : transport_(transport)
+        {
+            bool const tcp = (transport_ == RemoteTransport::kTcp);
+            socket_ = socket(AF_INET, tcp ? SOCK_STREAM : SOCK_DGRAM, 0);
+            int const bufferSize = 4 * 1024 * 1024;
+            (void)setsockopt(socket_, SOL_SOCKET, SO_RCVBUF, &bufferSize, sizeof(bufferSize));
+            sockaddr_in address{};
+            address.sin_family = AF_INET;
+            address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+            socklen_t length = sizeof(address);
+            EXPECT_EQ(bind(socket_, reinterpret_cast<sockaddr *>(&address), sizeof(address)), 0);
+            EXPECT_EQ(getsockname(socket_, reinterpret_cast<sockaddr *>(&address), &length), 0);
+            port_ = ntohs(address.sin_port);
+            if (tcp)
+            {
+                EXPECT_EQ(listen(socket_, 1), 0);
+            }
+            thread_ = std::thread(tcp ? &Receiver::ReceiveStream : &Receiver::ReceiveDatagrams, this);
+        }
+
+        ~Receiver()
+        {
+            Stop();
+            (void)close(socket_);
+        }
+
+        std::uint16_t Port() const noexcept
+        {
+            return port_;
+        }
+
+        // Wait until expected messages arrived or nothing arrived for a while, then stop receiving.
+        std::size_t WaitFor(std::size_t expected)
+        {
+            std::size_t last = 0U;
+            for (int idle = 0; idle < 20; ++idle)
+            {
+                std::this_thread::sleep_for(std::chrono::milliseconds(10));
+                std::size_t const now = messages_.load();
+                if (now >= expected)
+                {
+                    break;
+                }
+                idle = (now != last) ? 0 : idle;
+                last = now;
+            }
+            Stop();
+            return messages_.load();
+        }
+
+    private:
+        void Stop()
+        {
+            stop_.store(true);
+            if (thread_.joinable())
+            {
+                thread_.join();
+            }
+        }
+
+        bool Readable(int fd)
+        {
+            pollfd entry{fd, POLLIN, 0};
+            return (poll(&entry, 1, 10) == 1);
+        }
+
+        void ReceiveDatagrams()
+        {
+            std::vector<std::uint8_t> datagram(65536U);
+            while (!stop_.load())
+            {
+                if (Readable(socket_) && (recv(socket_, datagram.data(), datagram.size(), 0) >= 4))
+                {
+                    messages_.fetch_add(1U);
+                }
+            }
+        }
+
+        // Splits the stream into messages by the big-endian LEN field of the DLT standard header.
+        void ReceiveStream()
+        {
+            int connection = -1;
+            while ((connection < 0) && !stop_.load())
+            {
+                connection = Readable(socket_) ? accept(socket_, nullptr, nullptr) : -1;
+            }
+            std::vector<std::uint8_t> stream;
+            std::uint8_t chunk[65536];
+            while (!stop_.load())
+            {
+                ssize_t const n = Readable(connection) ? recv(connection, chunk, sizeof(chunk), 0) : 0;
+                if (n <= 0)
+                {
+                    continue;
+                }
+                stream.insert(stream.end(), chunk, chunk + n);
+                std::size_t offset = 0U;
+                while ((stream.size() - offset) >= 4U)
+                {
+                    std::size_t const length = (static_cast<std::size_t>(stream[offset + 2U]) << 8) | stream[offset + 3U];
+                    if ((length < 4U) || ((stream.size() - offset) < length))
+                    {
+                        break;
+                    }
+                    offset += length;
+                    messages_.fetch_add(1U);
+                }
+                stream.erase(stream.begin(), stream.begin() + static_cast<std::ptrdiff_t>(offset));
+            }
+            if (connection >= 0)
+            {
+                (void)close(connection);
+            }
+        }
+
+        RemoteTransport const transport_;
+        int socket_;
+        std::uint16_t port_;
+        std::atomic<bool> stop_{false};
+        std::atomic<std::size_t> messages_{0U};
+        std::thread thread_;
+    };
+
+    // A record with a string and an integer argument.
+    struct Record
+    {
+        Record()
+        {
+            char const text[] = "vehicle speed";
+            std::uint16_t const length = sizeof(text) - 1U;
+            std::uint32_t const value = 88U;
+            std::uint8_t *p = payload;
+            *p++ = static_cast<std::uint8_t>(ArgType::kString);
+            std::memcpy(p, &length, sizeof(length));
+            p += sizeof(length);
+            std::memcpy(p, text, length);
+            p += length;
+            *p++ = static_cast<std::uint8_t>(ArgType::kUint32);
+            std::memcpy(p, &value, sizeof(value));
+            p += sizeof(value);
+
+            header.timestamp = 0U;
+            std::memcpy(header.ctxId, "TEST", sizeof(header.ctxId));
+            header.payloadSize = static_cast<std::uint16_t>(p - payload);
+            header.level = LogLevel::kInfo;
+            header.argCount = 2U;
+        }
+
+        RecordHeader header;
+        std::uint8_t payload[64];
+    };
+
+    void RunLoopback(RemoteTransport transport, char const *name)
+    {
+        Receiver receiver(transport);
+        Record record;
+        DltRemoteSink sink("ECU1", "TEST", transport, "127.0.0.1", receiver.Port());
+
+        auto const start = std::chrono::steady_clock::now();
+        for (std::size_t i = 0U; i < kMessages; ++i)
+        {
+            record.header.timestamp = i;
+            sink.Write(record.header, record.payload);
+        }
+        sink.Flush();
+        std::chrono::duration<double> const elapsed = std::chrono::steady_clock::now() - start;
+        RemoteSinkStatistics const statistics = sink.Statistics();
+        std::size_t const received = receiver.WaitFor(kMessages);
+
+        std::printf("%s: %.0f msgs/s, %.4f syscalls/msg, %zu of %llu messages received\n", name,
+                    static_cast<double>(statistics.messages) / elapsed.count(),
+                    static_cast<double>(statistics.syscalls) / static_cast<double>(statistics.messages), received,
+                    static_cast<unsigned long long>(statistics.messages));
+
+        EXPECT_EQ(statistics.messages, kMessages);
+        EXPECT_EQ(statistics.dropped, 0U);
+        EXPECT_EQ(statistics.truncated, 0U);
+        // whole batches of 64 messages per call, plus the occasional partial send of a stream
+        EXPECT_LE(statistics.syscalls * 32U, statistics.messages);
+        if (transport == RemoteTransport::kTcp)
+        {
+            EXPECT_EQ(received, kMessages);
+        }
+        else
+        {
+            // the kernel may drop datagrams when the receiver falls behind
+            EXPECT_GT(received, 0U);
+            EXPECT_LE(received, kMessages);
+        }
+    }
+} // namespace
+
+TEST(DltRemoteSinkTest, BatchesDatagramsOverUdp)
+{
+    RunLoopback(RemoteTransport::kUdp, "udp");
+}
+
+TEST(DltRemoteSinkTest, BatchesStreamOverTcp)
+{
+    RunLoopback(RemoteTransport::kTcp, "tcp");
+}
+
+TEST(DltRemoteSinkTest, DropsWithoutReceiver)
+{
+    Record record;
+    // port 1 on loopback has no listener, so the TCP connection is refused
+    DltRemoteSink sink("ECU1", "TEST", RemoteTransport::kTcp, "127.0.0.1", 1U);
+    sink.Write(record.header, record.payload);
+    sink.Flush();
+    RemoteSinkStatistics const statistics = sink.Statistics();
+    EXPECT_EQ(statistics.messages, 0U);
+    EXPECT_EQ(statistics.dropped, 1U);
+    EXPECT_EQ(RemoteClientState(), ClientState::kNotConnected);
+}
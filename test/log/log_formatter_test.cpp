@@ -0,0 +1,36 @@
+/**
+ * \file log_formatter_test.cpp
+ * \author Vincent WANG (you@domain.com)
+ * \brief Tests of the registry of well-known error domains of the log formatter.
+ * \version 0.1
+ * \date 2020-12-08
+ *
+ * \copyright Copyright (c) 2020
+ *
+ */
+#include <cstdint>
+#include <gtest/gtest.h>
+#include "ara/com/com_error_domain.h"
+#include "ara/com/e2e/e2e_error_domain.h"
+#include "ara/com/raw/raw_error_domain.h"
+#include "log_formatter.h"
+
+using ara::log::internal::KnownDomainMessages;
+using ara::log::internal::KnownDomainName;
+
+TEST(LogFormatterTest, ResolvesComDomainsById)
+{
+    EXPECT_STREQ(KnownDomainName(0x8000000000001267ULL), "Com");
+    EXPECT_STREQ(KnownDomainName(0x8000000000001268ULL), "E2E");
+    EXPECT_STREQ(KnownDomainName(0x8000000000001269ULL), "Raw");
+    EXPECT_EQ(KnownDomainName(0x800000000000126AULL), nullptr);
+
+    auto const *e2e = KnownDomainMessages(0x8000000000001268ULL);
+    ASSERT_NE(e2e, nullptr);
+    EXPECT_STREQ(e2e->Message(static_cast<std::int32_t>(ara::com::e2e::E2EError::no_new_data)), "no new data");
+    auto const *raw = KnownDomainMessages(0x8000000000001269ULL);
+    ASSERT_NE(raw, nullptr);
+    EXPECT_STREQ(raw->Message(static_cast<std::int32_t>(ara::com::raw::RawErrc::kConnectionRefused)),
+                 "connection refused");
+    EXPECT_STREQ(raw->Message(0), "unknown raw error");
+}
@@ -0,0 +1,68 @@
+/**
+ * \file log_manager_test.cpp
+ * \author Vincent WANG (you@domain.com)
+ * \brief Tests of the backpressure policies of the logging back-end.
+ * \version 0.1
+ * \date 2020-12-08
+ *
+ * \copyright Copyright (c) 2020
+ *
+ */
+#include <cstdint>
+#include <thread>
+#include <vector>
+#include <gtest/gtest.h>
+#include "ara/log/logging.h"
+#include "bench_util.h"
+#include "log_manager.h"
+
+using namespace ara::log;
+using ara::log::internal::BackpressurePolicy;
+using ara::log::internal::LogConfig;
+using ara::log::internal::LogManager;
+
+// Floods a small buffer with kWarn and kError records from several threads: lower severities are dropped,
+// kError never is, not even after Shutdown().
+TEST(LogManagerTest, NeverDropsSevereRecordsBySeverity)
+{
+    constexpr int kThreads = 3;
+    constexpr int kLines = 5000;
+    if (!IsCompiledIn(LogLevel::kWarn))
+    {
+        GTEST_SKIP() << "kWarn is compiled out by ARA_LOG_MIN_LEVEL";
+    }
+    ara::bench::TempDirectory const directory("ara_log_manager_test");
+    LogConfig config;
+    config.mode = LogMode::kFile;
+    config.filePath = directory.Path();
+    config.bufferSize = 1024U;
+    config.backpressure = BackpressurePolicy::kBySeverity;
+    LogManager::Instance().Configure(config);
+
+    Logger &filler = CreateLogger("LMTW", "", LogLevel::kVerbose);
+    Logger &error = CreateLogger("LMTE", "", LogLevel::kVerbose);
+    std::vector<std::thread> producers;
+    for (int t = 0; t < kThreads; ++t)
+    {
+        producers.emplace_back([&filler, &error] {
+            for (int i = 0; i < kLines; ++i)
+            {
+                filler.LogWarn() << "filler" << i << "to fill the buffer";
+                error.LogError() << "severe" << i;
+            }
+        });
+    }
+    for (auto &producer : producers)
+    {
+        producer.join();
+    }
+
+    LogManager::Instance().Shutdown();
+    error.LogError() << "after shutdown";
+
+    EXPECT_EQ(error.Counters().dropped.load(), 0U);
+    EXPECT_EQ(error.Counters().enqueued.load(), static_cast<std::uint64_t>(kThreads * kLines) + 1U);
+    // records discarded from the buffer were counted as enqueued before
+    EXPECT_GE(filler.Counters().enqueued.load() + filler.Counters().dropped.load(),
+              static_cast<std::uint64_t>(kThreads * kLines));
+}
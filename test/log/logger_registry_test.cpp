@@ -0,0 +1,123 @@
+/**
+ * \file logger_registry_test.cpp
+ * \author Vincent WANG (you@domain.com)
+ * \brief Tests of the registry of Logger contexts.
+ * \version 0.1
+ * \date 2020-12-08
+ *
+ * \copyright Copyright (c) 2020
+ *
+ */
+#include <cstdint>
+#include <string>
+#include <thread>
+#include <vector>
+#include <gtest/gtest.h>
+#include "logger_registry.h"
+
+using namespace ara::log;
+using ara::log::internal::ContextKey;
+using ara::log::internal::LoggerRegistry;
+
+namespace
+{
+    // A distinct 4 character context ID per index, all starting with prefix.
+    std::string ContextId(char prefix, std::size_t index)
+    {
+        std::string id(1U, prefix);
+        for (int i = 0; i < 3; ++i)
+        {
+            id += static_cast<char>('A' + (index % 26U));
+            index /= 26U;
+        }
+        return id;
+    }
+
+    ara::core::StringView View(std::string const &id)
+    {
+        return ara::core::StringView(id.data(), id.size());
+    }
+} // namespace
+
+TEST(LoggerRegistryTest, KeysOnFirstFourCharacters)
+{
+    EXPECT_EQ(ContextKey("ABCD"), ContextKey("ABCDEF"));
+    EXPECT_NE(ContextKey("ABC"), ContextKey("ABCD"));
+    EXPECT_EQ(ContextKey(""), 0U);
+}
+
+TEST(LoggerRegistryTest, ReturnsSameLoggerForSameContext)
+{
+    LoggerRegistry &registry = LoggerRegistry::Instance();
+    Logger &first = registry.GetOrCreate("RG01", "first", LogLevel::kWarn);
+    Logger &second = registry.GetOrCreate("RG01xx", "ignored", LogLevel::kVerbose);
+    EXPECT_EQ(&first, &second);
+    EXPECT_FALSE(second.IsEnabled(LogLevel::kInfo));
+    EXPECT_EQ(registry.Find(ContextKey("RG01")), &first);
+    EXPECT_EQ(registry.Find(ContextKey("RG02")), nullptr);
+}
+
+TEST(LoggerRegistryTest, ChangesLevelOfOneOrAllContexts)
+{
+    LoggerRegistry &registry = LoggerRegistry::Instance();
+    Logger &a = registry.GetOrCreate("RG10", "", LogLevel::kError);
+    Logger &b = registry.GetOrCreate("RG11", "", LogLevel::kError);
+
+    // levels filtered out by ARA_LOG_MIN_LEVEL are never enabled, whatever the context level
+    EXPECT_TRUE(registry.SetLogLevel(ContextKey("RG10"), LogLevel::kWarn));
+    EXPECT_EQ(a.IsEnabled(LogLevel::kWarn), IsCompiledIn(LogLevel::kWarn));
+    EXPECT_FALSE(b.IsEnabled(LogLevel::kWarn));
+    EXPECT_FALSE(registry.SetLogLevel(ContextKey("RG19"), LogLevel::kWarn));
+
+    registry.SetLogLevel(LogLevel::kFatal);
+    EXPECT_FALSE(a.IsEnabled(LogLevel::kError));
+    EXPECT_FALSE(b.IsEnabled(LogLevel::kError));
+    EXPECT_EQ(b.IsEnabled(LogLevel::kFatal), IsCompiledIn(LogLevel::kFatal));
+}
+
+TEST(LoggerRegistryTest, CreatesContextOnceAcrossThreads)
+{
+    constexpr int kThreads = 4;
+    std::vector<Logger *> loggers(kThreads, nullptr);
+    std::vector<std::thread> threads;
+    for (int i = 0; i < kThreads; ++i)
+    {
+        threads.emplace_back([&loggers, i] {
+            for (std::size_t n = 0U; n < 100U; ++n)
+            {
+                Logger &logger = LoggerRegistry::Instance().GetOrCreate(View(ContextId('T', n)), "", LogLevel::kInfo);
+                if (n == 99U)
+                {
+                    loggers[static_cast<std::size_t>(i)] = &logger;
+                }
+            }
+        });
+    }
+    for (auto &thread : threads)
+    {
+        thread.join();
+    }
+    for (Logger *logger : loggers)
+    {
+        EXPECT_EQ(logger, loggers.front());
+    }
+}
+
+// More contexts than the index holds: the ones beyond it must still be found, and nothing moves.
+TEST(LoggerRegistryTest, FindsContextsBeyondIndexCapacity)
+{
+    constexpr std::size_t kContexts = 4000U;
+    LoggerRegistry &registry = LoggerRegistry::Instance();
+    std::vector<Logger *> loggers;
+    for (std::size_t i = 0U; i < kContexts; ++i)
+    {
+        loggers.push_back(&registry.GetOrCreate(View(ContextId('X', i)), "", LogLevel::kInfo));
+    }
+    for (std::size_t i = 0U; i < kContexts; ++i)
+    {
+        std::string const id = ContextId('X', i);
+        ASSERT_EQ(registry.Find(ContextKey(View(id))), loggers[i]) << id;
+        EXPECT_EQ(&registry.GetOrCreate(View(id), "", LogLevel::kInfo), loggers[i]);
+        EXPECT_TRUE(registry.SetLogLevel(ContextKey(View(id)), LogLevel::kWarn));
+    }
+}
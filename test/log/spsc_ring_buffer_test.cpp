@@ -0,0 +1,203 @@
+/**
+ * \file spsc_ring_buffer_test.cpp
+ * \author Vincent WANG (you@domain.com)
+ * \brief Tests of the ring buffer between the logging callers and the logging thread.
+ * \version 0.1
+ * \date 2020-12-08
+ *
+ * \copyright Copyright (c) 2020
+ *
+ */
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <thread>
+#include <vector>
+#include <gtest/gtest.h>
+#include "spsc_ring_buffer.h"
+
+using ara::log::internal::SpscRingBuffer;
+
+namespace
+{
+    // A record of size bytes carrying its sequence number, so that the reader can check order and contents.
+    std::vector<std::uint8_t> MakeRecord(std::uint32_t sequence, std::size_t size)
+    {
+        std::vector<std::uint8_t> record(size, static_cast<std::uint8_t>(sequence));
+        std::memcpy(record.data(), &sequence, sizeof(sequence));
+        return record;
+    }
+
+    bool CheckRecord(std::uint8_t const *data, std::size_t size, std::uint32_t &sequence)
+    {
+        if (size < sizeof(sequence))
+        {
+            return false;
+        }
+        std::memcpy(&sequence, data, sizeof(sequence));
+        for (std::size_t i = sizeof(sequence); i < size; ++i)
+        {
+            if (data[i] != static_cast<std::uint8_t>(sequence))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    bool Always(std::uint8_t const *, std::size_t) noexcept
+    {
+        return true;
+    }
+
+    void Ignore(std::uint8_t const *, std::size_t) noexcept
+    {
+    }
+} // namespace
+
+TEST(SpscRingBufferTest, RoundsCapacityUpToPowerOfTwo)
+{
+    EXPECT_EQ(SpscRingBuffer(1U, 8U).Capacity(), 64U);
+    EXPECT_EQ(SpscRingBuffer(1000U, 8U).Capacity(), 1024U);
+    EXPECT_EQ(SpscRingBuffer(4096U, 8U).Capacity(), 4096U);
+}
+
+TEST(SpscRingBufferTest, ReadsRecordsInOrder)
+{
+    SpscRingBuffer buffer(256U, 32U);
+    EXPECT_TRUE(buffer.Empty());
+    for (std::uint32_t i = 0U; i < 4U; ++i)
+    {
+        auto const record = MakeRecord(i, 5U + i);
+        ASSERT_TRUE(buffer.TryWrite(record.data(), record.size()));
+    }
+    EXPECT_FALSE(buffer.Empty());
+
+    std::uint32_t expected = 0U;
+    std::size_t const count = buffer.Read([&expected](std::uint8_t const *data, std::size_t size) {
+        std::uint32_t sequence;
+        ASSERT_TRUE(CheckRecord(data, size, sequence));
+        EXPECT_EQ(size, 5U + expected);
+        EXPECT_EQ(sequence, expected++);
+    });
+    EXPECT_EQ(count, 4U);
+    EXPECT_TRUE(buffer.Empty());
+}
+
+TEST(SpscRingBufferTest, RejectsRecordsThatDoNotFit)
+{
+    SpscRingBuffer buffer(64U, 24U);
+    std::vector<std::uint8_t> const tooLarge(25U, 0U);
+    EXPECT_FALSE(buffer.TryWrite(tooLarge.data(), tooLarge.size()));
+
+    // slots of 8 + 24 bytes: two fill the buffer
+    std::vector<std::uint8_t> const record(24U, 0U);
+    EXPECT_TRUE(buffer.TryWrite(record.data(), record.size()));
+    EXPECT_TRUE(buffer.TryWrite(record.data(), record.size()));
+    EXPECT_FALSE(buffer.TryWrite(record.data(), record.size()));
+
+    EXPECT_EQ(buffer.Read(&Ignore), 2U);
+    EXPECT_TRUE(buffer.TryWrite(record.data(), record.size()));
+}
+
+TEST(SpscRingBufferTest, PadsRecordsThatWouldWrapAround)
+{
+    SpscRingBuffer buffer(64U, 32U);
+    std::uint32_t sequence = 0U;
+    // 24 byte slots leave 16 bytes at the end after two records, which do not hold the third
+    for (int round = 0; round < 10; ++round)
+    {
+        auto const record = MakeRecord(sequence, 16U);
+        ASSERT_TRUE(buffer.TryWrite(record.data(), record.size()));
+        std::uint32_t const expected = sequence++;
+        EXPECT_EQ(buffer.Read([expected](std::uint8_t const *data, std::size_t size) {
+            std::uint32_t read;
+            ASSERT_TRUE(CheckRecord(data, size, read));
+            EXPECT_EQ(read, expected);
+        }), 1U);
+    }
+}
+
+TEST(SpscRingBufferTest, DiscardsOldestRecordOnRequest)
+{
+    SpscRingBuffer buffer(128U, 16U);
+    for (std::uint32_t i = 0U; i < 3U; ++i)
+    {
+        auto const record = MakeRecord(i, 8U);
+        ASSERT_TRUE(buffer.TryWrite(record.data(), record.size()));
+    }
+
+    EXPECT_FALSE(buffer.DiscardOldest([](std::uint8_t const *, std::size_t) { return false; }, &Ignore));
+
+    std::uint32_t discarded = ~0U;
+    EXPECT_TRUE(buffer.DiscardOldest(&Always, [&discarded](std::uint8_t const *data, std::size_t size) {
+        ASSERT_TRUE(CheckRecord(data, size, discarded));
+    }));
+    EXPECT_EQ(discarded, 0U);
+
+    std::vector<std::uint32_t> read;
+    buffer.Read([&read](std::uint8_t const *data, std::size_t size) {
+        std::uint32_t sequence;
+        ASSERT_TRUE(CheckRecord(data, size, sequence));
+        read.push_back(sequence);
+    });
+    EXPECT_EQ(read, (std::vector<std::uint32_t>{1U, 2U}));
+    EXPECT_FALSE(buffer.DiscardOldest(&Always, &Ignore));
+}
+
+// The producer discards the oldest records whenever the buffer is full while the consumer reads: every
+// record must arrive intact, in order, exactly once, or be reported as discarded.
+TEST(SpscRingBufferTest, DeliversOrDiscardsEveryRecordUnderContention)
+{
+    constexpr std::uint32_t kRecords = 200000U;
+    SpscRingBuffer buffer(512U, 64U);
+    std::atomic<bool> done{false};
+    std::uint32_t discarded = 0U;
+    std::uint32_t read = 0U;
+    bool intact = true;
+    bool ordered = true;
+
+    std::thread consumer([&] {
+        std::uint32_t last = 0U;
+        bool first = true;
+        auto const consume = [&](std::uint8_t const *data, std::size_t size) {
+            std::uint32_t sequence = 0U;
+            intact = intact && CheckRecord(data, size, sequence);
+            ordered = ordered && (first || (sequence > last));
+            first = false;
+            last = sequence;
+            ++read;
+        };
+        while (!done.load(std::memory_order_acquire))
+        {
+            if (buffer.Read(consume) == 0U)
+            {
+                std::this_thread::yield();
+            }
+        }
+        buffer.Read(consume);
+    });
+
+    for (std::uint32_t i = 0U; i < kRecords; ++i)
+    {
+        auto const record = MakeRecord(i, 4U + (i % 61U));
+        while (!buffer.TryWrite(record.data(), record.size()))
+        {
+            // leave the consumer a chance to drain, so that both paths are taken
+            if ((i % 4U) != 0U)
+            {
+                std::this_thread::yield();
+            }
+            else if (buffer.DiscardOldest(&Always, &Ignore))
+            {
+                ++discarded;
+            }
+        }
+    }
+    done.store(true, std::memory_order_release);
+    consumer.join();
+
+    EXPECT_TRUE(intact);
+    EXPECT_TRUE(ordered);
+    EXPECT_EQ(read + discarded, kRecords);
+}